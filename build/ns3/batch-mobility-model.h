@@ -0,0 +1,249 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef BATCH_MOBILITY_MODEL_H
+#define BATCH_MOBILITY_MODEL_H
+
+#include "mobility-model.h"
+#include "position-allocator.h"
+#include "ns3/event-id.h"
+#include "ns3/nstime.h"
+#include "ns3/ptr.h"
+#include "ns3/random-variable-stream.h"
+#include <functional>
+#include <queue>
+#include <vector>
+
+namespace ns3 {
+
+class BatchMobilityModel;
+
+/**
+ * \ingroup mobility
+ * \brief Kinematic state of all the BatchMobilityModel objects of a
+ * simulation.
+ *
+ * The manager stores the positions and velocities of its models in a
+ * structure of arrays.  All the positions are expressed at a single
+ * reference time, so that the position of a model at any later time is
+ * a single multiply-add, without any per-model event or bookkeeping.
+ * Every "Interval", and only while some models have a pending waypoint
+ * transition, one event moves the reference time forward and advances
+ * all the positions in a single pass over the arrays.
+ *
+ * The waypoint transitions (end of a pause, arrival at a waypoint) of
+ * all the models are kept in a single queue.  They are processed, in
+ * time order and at their exact time, by the periodic event and
+ * lazily whenever a position or a velocity is read, so that the
+ * trajectories do not depend on "Interval".  Only the CourseChange
+ * notification of a transition may be delayed, by at most
+ * "Interval", until the transition is processed.
+ *
+ * There is a single manager per simulation, which is released by
+ * Simulator::Destroy.
+ */
+class BatchMobilityManager : public Object
+{
+public:
+  /**
+   * Register this type with the TypeId system.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+  BatchMobilityManager ();
+  virtual ~BatchMobilityManager ();
+
+  /**
+   * \return the manager of the current simulation, created on first use.
+   */
+  static Ptr<BatchMobilityManager> Get (void);
+
+  /**
+   * \param model the model to add, at position (0,0,0) with a zero velocity.
+   * \return the index of the model in the manager.
+   */
+  uint32_t Add (BatchMobilityModel *model);
+  /**
+   * \param index the index of the model to remove.
+   */
+  void Remove (uint32_t index);
+  /**
+   * \return the number of models in the manager.
+   */
+  uint32_t GetN (void) const;
+
+  /**
+   * Process all the waypoint transitions due up to now.
+   *
+   * This is done before any position or velocity is returned, so there
+   * is no need to call this method explicitly.
+   */
+  void Update (void);
+
+  /**
+   * \param index the index of the model.
+   * \return the current position of the model.
+   */
+  Vector GetPosition (uint32_t index);
+  /**
+   * \param index the index of the model.
+   * \param t a time not before the last batch update.
+   * \return the position of the model at time \p t, without processing
+   * the pending waypoint transitions.
+   */
+  Vector GetPositionAt (uint32_t index, Time t) const;
+  /**
+   * \param index the index of the model.
+   * \return the current velocity of the model.
+   */
+  Vector GetVelocity (uint32_t index);
+  /**
+   * \param index the index of the model.
+   * \param position the position of the model at time \p t.
+   * \param t the time of the change, which must not be in the future.
+   */
+  void SetPosition (uint32_t index, const Vector &position, Time t);
+  /**
+   * \param index the index of the model.
+   * \param velocity the velocity of the model from time \p t.
+   * \param t the time of the change, which must not be in the future.
+   */
+  void SetVelocity (uint32_t index, const Vector &velocity, Time t);
+  /**
+   * \param index the index of the model.
+   * \param t the time of the next waypoint transition of the model.
+   *
+   * This replaces any pending transition of the model.
+   */
+  void ScheduleTransition (uint32_t index, Time t);
+  /**
+   * \param index the index of the model.
+   *
+   * Cancel the pending waypoint transition of the model, if any.
+   */
+  void CancelTransition (uint32_t index);
+
+private:
+  virtual void DoDispose (void);
+
+  /**
+   * \return the storage of the manager of the current simulation.
+   */
+  static Ptr<BatchMobilityManager> *DoGet (void);
+  /**
+   * Release the manager of the current simulation.
+   */
+  static void Delete (void);
+
+  /**
+   * Schedule the periodic batch update, unless it is already scheduled.
+   */
+  void ScheduleStep (void);
+  /**
+   * Process the due transitions and advance all the positions to now.
+   */
+  void Step (void);
+
+  /// A pending transition: its time in time steps and the model index.
+  typedef std::pair<int64_t, uint32_t> Transition;
+
+  Time m_interval;    //!< interval between two batch updates
+  EventId m_step;     //!< the next batch update
+  Time m_reference;   //!< the time at which the positions are expressed
+  std::vector<double> m_x;  //!< x coordinates at the reference time
+  std::vector<double> m_y;  //!< y coordinates at the reference time
+  std::vector<double> m_z;  //!< z coordinates at the reference time
+  std::vector<double> m_vx; //!< x components of the velocities
+  std::vector<double> m_vy; //!< y components of the velocities
+  std::vector<double> m_vz; //!< z components of the velocities
+  /// time of the pending transition of each model, or -1
+  std::vector<int64_t> m_due;
+  /// the models, or 0 for the unused indices
+  std::vector<BatchMobilityModel *> m_models;
+  std::vector<uint32_t> m_free; //!< unused indices
+  /// pending transitions, earliest first, possibly stale
+  std::priority_queue<Transition, std::vector<Transition>, std::greater<Transition> > m_transitions;
+};
+
+/**
+ * \ingroup mobility
+ * \brief Mobility model whose state is advanced in batch by the
+ * BatchMobilityManager.
+ *
+ * Without a "PositionAllocator", the model keeps its velocity until
+ * SetVelocity is called again, as ConstantVelocityMobilityModel does.
+ * With a "PositionAllocator", it moves as RandomWaypointMobilityModel
+ * does: it starts by pausing for "Pause", then repeatedly moves in a
+ * straight line at "Speed" to the next position of the allocator and
+ * pauses again.  Unlike RandomWaypointMobilityModel, it does not
+ * schedule any event of its own: the waypoint transitions of all the
+ * models of the simulation are handled by the BatchMobilityManager.
+ */
+class BatchMobilityModel : public MobilityModel
+{
+public:
+  /**
+   * Register this type with the TypeId system.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+  BatchMobilityModel ();
+  virtual ~BatchMobilityModel ();
+
+  /**
+   * \param velocity the new velocity.
+   *
+   * Set the current velocity, in m/s.  This is meant for the models
+   * without a "PositionAllocator"; the velocity of a random waypoint
+   * model is changed again at its next waypoint transition.
+   */
+  void SetVelocity (const Vector &velocity);
+
+protected:
+  virtual void DoInitialize (void);
+  virtual void DoDispose (void);
+
+private:
+  friend class BatchMobilityManager;
+
+  /**
+   * Perform the waypoint transition due at time \p t: start walking to
+   * the next waypoint after a pause, or start a pause at a waypoint.
+   * \param t the time of the transition.
+   */
+  void DoTransition (Time t);
+  /**
+   * Start a pause at time \p t.
+   * \param t the start of the pause.
+   */
+  void Pause (Time t);
+
+  virtual Vector DoGetPosition (void) const;
+  virtual void DoSetPosition (const Vector &position);
+  virtual Vector DoGetVelocity (void) const;
+  virtual int64_t DoAssignStreams (int64_t);
+
+  Ptr<BatchMobilityManager> m_manager; //!< the manager storing the state
+  uint32_t m_index; //!< index of this model in the manager
+  bool m_walking; //!< whether the model is moving towards m_destination
+  Vector m_destination; //!< the current waypoint
+  Ptr<PositionAllocator> m_position; //!< pointer to position allocator
+  Ptr<RandomVariableStream> m_speed; //!< random variable to generate speeds
+  Ptr<RandomVariableStream> m_pause; //!< random variable to generate pauses
+};
+
+} // namespace ns3
+
+#endif /* BATCH_MOBILITY_MODEL_H */
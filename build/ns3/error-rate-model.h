@@ -0,0 +1,185 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2005,2006 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Mathieu Lacage <mathieu.lacage@sophia.inria.fr>
+ */
+
+#ifndef ERROR_RATE_MODEL_H
+#define ERROR_RATE_MODEL_H
+
+#include <unordered_map>
+#include <vector>
+#include "ns3/object.h"
+#include "wifi-mode.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup wifi
+ * \brief the interface for Wifi's error models
+ *
+ * The chunk success rates of the subclasses can be looked up in tables
+ * rather than computed, see the LookupTableResolution attribute.  A
+ * table is kept for each (mode, channel width, number of spatial
+ * streams, number of RX antennas, PPDU field, LDPC, chunk size bucket),
+ * the buckets holding the chunks of 2^k to 2^(k+1) - 1 bits.  Tables
+ * are filled lazily, one cell of LookupTableResolution dB at a time:
+ * a cell stores the logarithm of the success rate of a bit at both of
+ * its ends, and is only used if the interpolation at its ends and its
+ * middle is within LookupTableMaxError of the computed success rate,
+ * for the smallest and the largest chunks of the bucket, and, in the
+ * middle, for the chunk size whose success rate is the most sensitive
+ * to an error on the logarithm, and if the success rate does not drop
+ * to zero at one end only.  Otherwise, the success rates of the cell
+ * keep being computed.
+ */
+class ErrorRateModel : public Object
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  ErrorRateModel ();
+
+  /**
+   * \param txVector a specific transmission vector including WifiMode
+   * \param ber a target BER
+   *
+   * \return the SNR which corresponds to the requested BER
+   */
+  double CalculateSnr (const WifiTxVector& txVector, double ber) const;
+
+  /**
+   * \return true if the model is for AWGN channels,
+   *         false otherwise
+   */
+  virtual bool IsAwgn (void) const;
+
+  /**
+   * This method returns the probability that the given 'chunk' of the
+   * packet will be successfully received by the PHY.
+   *
+   * A chunk can be viewed as a part of a packet with equal SNR.
+   * The probability of successfully receiving the chunk depends on
+   * the mode, the SNR, and the size of the chunk.
+   *
+   * Note that both a WifiMode and a WifiTxVector (which contains a WifiMode)
+   * are passed into this method.  The WifiTxVector may be from a signal that
+   * contains multiple modes (e.g. PHY header sent differently from PHY
+   * payload).  Consequently, the mode parameter is what the method uses
+   * to calculate the chunk error rate, and the txVector is used for
+   * other information as needed.
+   *
+   * This method handles 802.11b rates by using the DSSS error rate model.
+   * For all other rates, the method implemented by the subclass is called.
+   *
+   * \param mode the Wi-Fi mode applicable to this chunk
+   * \param txVector TXVECTOR of the overall transmission
+   * \param snr the SNR of the chunk
+   * \param nbits the number of bits in this chunk
+   * \param numRxAntennas the number of active RX antennas (1 if not provided)
+   * \param field the PPDU field to which the chunk belongs to (assumes this is for the payload part if not provided)
+   * \param staId the station ID for MU
+   *
+   * \return probability of successfully receiving the chunk
+   */
+  double GetChunkSuccessRate (WifiMode mode, const WifiTxVector& txVector, double snr, uint64_t nbits,
+                              uint8_t numRxAntennas = 1, WifiPpduField field = WIFI_PPDU_FIELD_DATA,
+                              uint16_t staId = SU_STA_ID) const;
+
+  /**
+   * Assign a fixed random variable stream number to the random variables
+   * used by this model. Return the number of streams (possibly zero) that
+   * have been assigned.
+   *
+   * \param stream first stream index to use
+   * \return the number of stream indices assigned by this model
+   */
+  virtual int64_t AssignStreams (int64_t stream);
+
+
+private:
+  /**
+   * A lookup table of chunk success rates.
+   */
+  struct LookupTable
+  {
+    /// The state of a cell
+    enum CellState : uint8_t
+    {
+      UNKNOWN = 0, //!< not checked yet
+      TABULATED,   //!< interpolated from the table
+      COMPUTED     //!< computed by the subclass
+    };
+    std::vector<double> perBitLog; //!< log of the success rate of a bit at each SNR, NaN if not computed yet
+    std::vector<uint8_t> cells;    //!< state of each cell between two SNRs
+  };
+
+  /**
+   * Get the chunk success rate from the lookup tables, filling them
+   * as needed.  The arguments are those of DoGetChunkSuccessRate.
+   *
+   * \param mode the Wi-Fi mode applicable to this chunk
+   * \param txVector TXVECTOR of the overall transmission
+   * \param snr the SNR of the chunk
+   * \param nbits the number of bits in this chunk
+   * \param numRxAntennas the number of active RX antennas
+   * \param field the PPDU field to which the chunk belongs to
+   * \param staId the station ID for MU
+   *
+   * \return probability of successfully receiving the chunk
+   */
+  double LookupChunkSuccessRate (WifiMode mode, const WifiTxVector& txVector, double snr, uint64_t nbits,
+                                 uint8_t numRxAntennas, WifiPpduField field, uint16_t staId) const;
+
+  /**
+   * A pure virtual method that must be implemented in the subclass.
+   *
+   * \param mode the Wi-Fi mode applicable to this chunk
+   * \param txVector TXVECTOR of the overall transmission
+   * \param snr the SNR of the chunk
+   * \param nbits the number of bits in this chunk
+   * \param numRxAntennas the number of active RX antennas
+   * \param field the PPDU field to which the chunk belongs to
+   * \param staId the station ID for MU
+   *
+   * \return probability of successfully receiving the chunk
+   */
+  virtual double DoGetChunkSuccessRate (WifiMode mode, const WifiTxVector& txVector, double snr, uint64_t nbits,
+                                        uint8_t numRxAntennas, WifiPpduField field, uint16_t staId) const = 0;
+
+  double m_tableResolution;  //!< SNR step of the lookup tables in dB, 0 to compute every success rate
+  double m_tableMinSnr;      //!< smallest SNR of the lookup tables in dB
+  double m_tableMaxSnr;      //!< largest SNR of the lookup tables in dB
+  double m_tableMaxError;    //!< largest error of a lookup table cell
+  /**
+   * Lookup tables, by key.  The key packs the mode UID, the channel
+   * width, the number of spatial streams, the number of RX antennas,
+   * the PPDU field, LDPC and log2 of the smallest chunk of the bucket.
+   */
+  mutable std::unordered_map<uint64_t, LookupTable> m_tables;
+  mutable uint64_t m_lastTableKey;  //!< key of the last table used
+  mutable LookupTable *m_lastTable; //!< last table used, if any
+};
+
+} //namespace ns3
+
+#endif /* ERROR_RATE_MODEL_H */
+
@@ -0,0 +1,149 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef FF_MAC_SCHEDULER_EXECUTOR_H
+#define FF_MAC_SCHEDULER_EXECUTOR_H
+
+#include <ns3/object.h>
+#include <ns3/callback.h>
+#include <vector>
+#include "ns3/core-config.h"
+#ifdef HAVE_PTHREAD_H
+#include <ns3/system-condition.h>
+#include <ns3/system-mutex.h>
+#include <ns3/system-thread.h>
+#endif
+
+namespace ns3 {
+
+/**
+ * \ingroup ff-api
+ *
+ * \brief Evaluates the FF MAC schedulers of all the cells of a TTI in
+ * parallel.
+ *
+ * Within a TTI, the schedulers of the different eNBs and component
+ * carriers do not share any state, hence their resource allocations
+ * can be computed concurrently.  The executor collects the jobs
+ * submitted by the MACs at the start of a subframe and evaluates them
+ * in a single event, run once the simulator has processed all the
+ * events of the current time which were scheduled before the first
+ * job: the compute part of all the jobs is run by "Threads" threads,
+ * then the apply part of each job is run on the simulation thread, in
+ * the order of submission.  An apply part may submit a new job, which
+ * is evaluated in a next round of the same event; the MAC uses it to
+ * run the uplink scheduling after the downlink one.
+ *
+ * Since the compute parts only read and write the state of their own
+ * scheduler, and the apply parts are run in a fixed order, the results
+ * do not depend on the number of threads.  A compute part must not
+ * schedule events, fire trace sources, copy a Ptr shared with another
+ * job or log anything: the schedulers must be run with their log
+ * components disabled.
+ *
+ * There is a single executor per simulation, which is released by
+ * Simulator::Destroy.  With the default "Threads" of 0, the MACs call
+ * their scheduler directly and the executor is not used.
+ */
+class FfMacSchedulerExecutor : public Object
+{
+public:
+  /**
+   * Register this type with the TypeId system.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+  FfMacSchedulerExecutor ();
+  virtual ~FfMacSchedulerExecutor ();
+
+  /**
+   * \return the executor of the current simulation, created on first use.
+   */
+  static Ptr<FfMacSchedulerExecutor> Get (void);
+
+  /**
+   * \return the number of threads computing the jobs, including the
+   * simulation thread, or 0 if the schedulers are called directly
+   */
+  uint32_t GetThreads (void) const;
+
+  /**
+   * Submit a job.  The job is evaluated at the current time, after
+   * the events already scheduled for it.
+   *
+   * \param compute the part of the job which may run on any thread
+   * \param apply the part of the job which runs on the simulation
+   * thread, after the compute part of all the jobs of the round
+   */
+  void Submit (Callback<void> compute, Callback<void> apply);
+
+protected:
+  virtual void DoDispose (void);
+
+private:
+  /// A job
+  struct Job
+  {
+    Callback<void> m_compute; //!< the part run by any thread
+    Callback<void> m_apply;   //!< the part run by the simulation thread
+  };
+
+  /**
+   * Get a pointer to the executor of the current simulation.
+   * \return a pointer to the executor
+   */
+  static Ptr<FfMacSchedulerExecutor> *DoGet (void);
+  /**
+   * Release the executor of the current simulation.
+   */
+  static void Delete (void);
+
+  /**
+   * Evaluate the submitted jobs, round after round.
+   */
+  void Run (void);
+  /**
+   * Run the compute part of the jobs of a round.
+   * \param jobs the jobs of the round
+   */
+  void Compute (std::vector<Job> &jobs);
+
+#ifdef HAVE_PTHREAD_H
+  /**
+   * The main loop of the worker threads
+   */
+  void Worker (void);
+#endif
+
+  uint32_t m_threads; //!< the number of threads computing the jobs, 0 if disabled
+  std::vector<Job> m_jobs; //!< the jobs of the next round
+  bool m_scheduled; //!< true when the evaluation of the jobs is scheduled
+
+#ifdef HAVE_PTHREAD_H
+  std::vector<Ptr<SystemThread> > m_poolThreads; //!< the worker threads
+  std::vector<Job> *m_round; //!< the jobs of the current round, or 0
+  uint32_t m_next; //!< the index of the next job of the round to compute
+  uint32_t m_pending; //!< the number of jobs of the round not computed yet
+  bool m_poolStop; //!< true when the worker threads have to exit
+  SystemMutex m_poolMutex; //!< protects the round, m_next, m_pending and m_poolStop
+  SystemCondition m_poolWork; //!< signaled when a round starts
+  SystemCondition m_poolDone; //!< signaled when a job is computed
+#endif
+};
+
+} // namespace ns3
+
+#endif /* FF_MAC_SCHEDULER_EXECUTOR_H */
@@ -0,0 +1,82 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+
+#ifndef GSO_TAG_H
+#define GSO_TAG_H
+
+#include "ns3/tag.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup tcp
+ *
+ * \brief Marks a TCP super-segment handed down with generic segmentation
+ * offload, i.e. several segments sharing a single TCP header, as in
+ * Linux skb_shinfo gso_size and gso_segs.
+ *
+ * The super-segment stays aggregated through IP and traffic control, and
+ * is split into wire packets of at most GetSegmentSize () bytes of
+ * payload by Ipv4L3Protocol, either right before its transmission by a
+ * device supporting it (e.g. PointToPointNetDevice with Gso set) or
+ * before it is queued for the other devices.
+ */
+class GsoTag : public Tag
+{
+public:
+  GsoTag ();
+
+  /**
+   * \brief Set the size of the payload of the segments
+   * \param segmentSize the size, in bytes
+   */
+  void SetSegmentSize (uint16_t segmentSize);
+  /**
+   * \brief Get the size of the payload of the segments
+   * \returns the size, in bytes; the last segment may be smaller
+   */
+  uint16_t GetSegmentSize (void) const;
+  /**
+   * \brief Set the number of segments
+   * \param segments the number of segments
+   */
+  void SetSegments (uint16_t segments);
+  /**
+   * \brief Get the number of segments
+   * \returns the number of segments
+   */
+  uint16_t GetSegments (void) const;
+
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+  virtual TypeId GetInstanceTypeId (void) const;
+  virtual uint32_t GetSerializedSize (void) const;
+  virtual void Serialize (TagBuffer i) const;
+  virtual void Deserialize (TagBuffer i);
+  virtual void Print (std::ostream &os) const;
+
+private:
+  uint16_t m_segmentSize; //!< Size of the payload of the segments
+  uint16_t m_segments;    //!< Number of segments
+};
+
+} // namespace ns3
+
+#endif /* GSO_TAG_H */
@@ -0,0 +1,159 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef SPATIAL_GRID_H
+#define SPATIAL_GRID_H
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include "ns3/ptr.h"
+#include "ns3/vector.h"
+
+namespace ns3 {
+
+class MobilityModel;
+
+/**
+ * \ingroup mobility
+ * \brief Find the mobility models within range of a position.
+ *
+ * The mobility models are identified by the id they are added with.
+ * Models which do not move are stored in the cells of a square grid
+ * in the x-y plane, so that a range query only looks at the cells the
+ * range overlaps; models which move are kept aside and always looked
+ * at.  The grid follows the CourseChange trace of each model, which
+ * all the mobility models fire whenever their velocity changes.
+ *
+ * The cell size should be close to the range of the queries.
+ */
+class SpatialGrid
+{
+public:
+  /**
+   * Create an empty grid.
+   *
+   * \param cellSize The side of a cell, in meters.
+   */
+  SpatialGrid (double cellSize = 100);
+  ~SpatialGrid ();
+
+  /**
+   * Set the side of a cell; the grid must be empty.
+   *
+   * \param cellSize The side of a cell, in meters.
+   */
+  void SetCellSize (double cellSize);
+
+  /**
+   * Add a mobility model to the grid.
+   *
+   * \param id The id of the model, which must not be in the grid.
+   * \param mobility The mobility model.
+   */
+  void Add (uint32_t id, Ptr<MobilityModel> mobility);
+
+  /**
+   * \param id The id of a model.
+   * \return True if a model was added with this id.
+   */
+  bool Contains (uint32_t id) const;
+
+  /**
+   * Remove all the models and stop following their course changes.
+   */
+  void Clear (void);
+
+  /**
+   * Get the ids of the models within range of a position.
+   *
+   * \param position The position.
+   * \param range The range, in meters.
+   * \param [out] ids The ids of the models whose distance to the
+   * position is at most the range, in increasing order.
+   */
+  void GetInRange (const Vector &position, double range, std::vector<uint32_t> &ids) const;
+
+private:
+  /// The cell of a model.
+  struct Entry
+  {
+    Ptr<MobilityModel> mobility;  //!< The mobility model.
+    bool moving;                  //!< Whether the model is outside the grid.
+    uint64_t cell;                //!< The cell of the model, unless it moves.
+  };
+
+  /// A model which does not move, with its position.
+  typedef std::pair<uint32_t, Vector> CellEntry;
+
+  // Not copyable: the trace sources of the models call this object back
+  SpatialGrid (const SpatialGrid &) = delete;
+  SpatialGrid &operator = (const SpatialGrid &) = delete;
+
+  /**
+   * \param x The cell index along the x axis.
+   * \param y The cell index along the y axis.
+   * \return The key of the cell.
+   */
+  static uint64_t GetCellKey (int64_t x, int64_t y);
+
+  /**
+   * \param coordinate A coordinate.
+   * \return The index of the cell containing the coordinate.
+   */
+  int64_t GetCellIndex (double coordinate) const;
+
+  /**
+   * Put a model in the cell of its position, or aside if it moves.
+   *
+   * \param id The id of the model.
+   */
+  void Place (uint32_t id);
+
+  /**
+   * Remove a model from its cell, or from the moving models.
+   *
+   * \param id The id of the model.
+   */
+  void Unplace (uint32_t id);
+
+  /**
+   * Append the ids of the models of a cell within range of a position.
+   *
+   * \param cell The models of the cell.
+   * \param position The position.
+   * \param range The range, in meters.
+   * \param [out] ids The ids of the models within range.
+   */
+  static void GetInRange (const std::vector<CellEntry> &cell, const Vector &position, double range, std::vector<uint32_t> &ids);
+
+  /**
+   * Move the models of a mobility model after a course change.
+   *
+   * \param mobility The mobility model.
+   */
+  void CourseChanged (Ptr<const MobilityModel> mobility);
+
+  double m_cellSize;                                              //!< Side of a cell.
+  std::unordered_map<uint32_t, Entry> m_entries;                  //!< Models, by id.
+  std::unordered_map<uint64_t, std::vector<CellEntry> > m_cells;  //!< Models in each cell.
+  std::vector<uint32_t> m_moving;                                 //!< Ids of the moving models.
+  std::map<const MobilityModel *, std::vector<uint32_t> > m_ids;  //!< Ids of each mobility model.
+};
+
+} // namespace ns3
+
+#endif /* SPATIAL_GRID_H */
@@ -0,0 +1,75 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef STREAMING_WAYPOINT_MOBILITY_MODEL_H
+#define STREAMING_WAYPOINT_MOBILITY_MODEL_H
+
+#include "waypoint-mobility-model.h"
+#include "waypoint-trace-file.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup mobility
+ * \brief Waypoint-based mobility model which reads its waypoints from a
+ * binary waypoint trace as it moves.
+ *
+ * The model behaves as a WaypointMobilityModel fed with all the
+ * waypoints of one node of a WaypointTraceFile, but it only keeps
+ * "Lookahead" waypoints beyond the next one in its queue: whenever the
+ * model is updated, it appends the waypoints of the trace which are due
+ * by now, then the following ones until the queue holds "Lookahead"
+ * waypoints again.  The memory used by a node, and the number of
+ * pending events, are thus bounded whatever the length of its trace.
+ * Note that the "WaypointsLeft" attribute only counts the waypoints
+ * already read from the trace.
+ */
+class StreamingWaypointMobilityModel : public WaypointMobilityModel
+{
+public:
+  /**
+   * Register this type with the TypeId system.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+  StreamingWaypointMobilityModel ();
+  virtual ~StreamingWaypointMobilityModel ();
+
+  /**
+   * Follow the waypoints of a node of a trace, from the current time.
+   * \param trace the trace
+   * \param node the index of the node in the trace
+   */
+  void SetTrace (Ptr<const WaypointTraceFile> trace, uint32_t node);
+
+protected:
+  virtual void Update (void) const;
+
+private:
+  /**
+   * Append the waypoints of the trace due by now, then the following
+   * ones up to the lookahead.
+   */
+  void Refill (void);
+
+  Ptr<const WaypointTraceFile> m_trace; //!< the trace
+  const WaypointTraceRecord *m_cursor; //!< the next waypoint to read
+  const WaypointTraceRecord *m_end; //!< the end of the waypoints of the node
+  uint32_t m_lookahead; //!< number of waypoints to keep beyond the next one
+};
+
+} // namespace ns3
+
+#endif /* STREAMING_WAYPOINT_MOBILITY_MODEL_H */
@@ -27,6 +27,7 @@
 #include "log.h"
 
 #include <sstream>
+#include <map>
 
 /**
  * \file
@@ -199,6 +200,13 @@ public:
    * \returns \c true if the index matches the Config Path.
    */
   bool Matches (std::size_t i) const;
+  /**
+   * Test if the Config path specification is a single index.
+   *
+   * \param [out] i The index.
+   * \returns \c true if the specification matches only the index \pname{i}.
+   */
+  bool IsIndex (uint32_t *i) const;
 
 private:
   /**
@@ -284,6 +292,17 @@ ArrayMatcher::Matches (std::size_t i) const
   return false;
 }
 
+bool
+ArrayMatcher::IsIndex (uint32_t *i) const
+{
+  NS_LOG_FUNCTION (this << i);
+  if (m_element == "*" || m_element.find ("|") != std::string::npos)
+    {
+      return false;
+    }
+  return StringToUint32 (m_element, i);
+}
+
 bool
 ArrayMatcher::StringToUint32 (std::string str, uint32_t *value) const
 {
@@ -297,6 +316,10 @@ ArrayMatcher::StringToUint32 (std::string str, uint32_t *value) const
 /**
  * \ingroup config-impl
  * Abstract class to parse Config paths into object references.
+ *
+ * The Config path is split into its tokens once, at construction,
+ * and the tokens are then walked by index, so resolving a path
+ * does not create a new substring for each level of the object graph.
  */
 class Resolver
 {
@@ -322,21 +345,25 @@ public:
 private:
   /** Ensure the Config path starts and ends with a '/'. */
   void Canonicalize (void);
+  /** Split the canonical Config path into its tokens. */
+  void Compile (void);
   /**
    * Parse the next element in the Config path.
    *
-   * \param [in] path The remaining portion of the Config path.
+   * \param [in] token The index of the next token of the Config path.
    * \param [in] root The object corresponding to the current position
    *                  in the Config path.
    */
-  void DoResolve (std::string path, Ptr<Object> root);
+  void DoResolve (std::size_t token, Ptr<Object> root);
   /**
    * Parse an index on the Config path.
    *
-   * \param [in] path The remaining Config path.
-   * \param [in,out] vector The resulting list of matching objects.
+   * \param [in] token The index of the array token of the Config path.
+   * \param [in] object The object holding the container attribute.
+   * \param [in] info The container attribute.
    */
-  void DoArrayResolve (std::string path, const ObjectPtrContainerValue &vector);
+  void DoArrayResolve (std::size_t token, Ptr<Object> object,
+                       const struct TypeId::AttributeInformation &info);
   /**
    * Handle one object found on the path.
    *
@@ -361,6 +388,8 @@ private:
   std::vector<std::string> m_workStack;
   /** The Config path. */
   std::string m_path;
+  /** The tokens of the Config path. */
+  std::vector<std::string> m_tokens;
 
 };  // class Resolver
 
@@ -369,6 +398,7 @@ Resolver::Resolver (std::string path)
 {
   NS_LOG_FUNCTION (this << path);
   Canonicalize ();
+  Compile ();
 }
 Resolver::~Resolver ()
 {
@@ -394,12 +424,27 @@ Resolver::Canonicalize (void)
     }
 }
 
+void
+Resolver::Compile (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  std::string::size_type cur = 1;
+  std::string::size_type next = m_path.find ("/", cur);
+  while (next != std::string::npos)
+    {
+      m_tokens.push_back (m_path.substr (cur, next - cur));
+      cur = next + 1;
+      next = m_path.find ("/", cur);
+    }
+}
+
 void
 Resolver::Resolve (Ptr<Object> root)
 {
   NS_LOG_FUNCTION (this << root);
 
-  DoResolve (m_path, root);
+  DoResolve (0, root);
 }
 
 std::string
@@ -425,13 +470,11 @@ Resolver::DoResolveOne (Ptr<Object> object)
 }
 
 void
-Resolver::DoResolve (std::string path, Ptr<Object> root)
+Resolver::DoResolve (std::size_t token, Ptr<Object> root)
 {
-  NS_LOG_FUNCTION (this << path << root);
-  NS_ASSERT ((path.find ("/")) == 0);
-  std::string::size_type next = path.find ("/", 1);
+  NS_LOG_FUNCTION (this << token << root);
 
-  if (next == std::string::npos)
+  if (token == m_tokens.size ())
     {
       //
       // If root is zero, we're beginning to see if we can use the object name
@@ -447,8 +490,7 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
         }
       return;
     }
-  std::string item = path.substr (1, next - 1);
-  std::string pathLeft = path.substr (next, path.size () - next);
+  const std::string &item = m_tokens[token];
 
   //
   // If root is zero, we're beginning to see if we can use the object name
@@ -459,11 +501,11 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
   //
   if (root == 0)
     {
-      std::string::size_type offset = path.find ("/Names");
+      std::string::size_type offset = item.find ("Names");
       if (offset == 0)
         {
           m_workStack.push_back (item);
-          DoResolve (pathLeft, root);
+          DoResolve (token + 1, root);
           m_workStack.pop_back ();
           return;
         }
@@ -480,7 +522,7 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
     {
       NS_LOG_DEBUG ("Name system resolved item = " << item << " to " << namedObject);
       m_workStack.push_back (item);
-      DoResolve (pathLeft, namedObject);
+      DoResolve (token + 1, namedObject);
       m_workStack.pop_back ();
       return;
     }
@@ -510,7 +552,7 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
           return;
         }
       m_workStack.push_back (item);
-      DoResolve (pathLeft, object);
+      DoResolve (token + 1, object);
       m_workStack.pop_back ();
     }
   else
@@ -549,7 +591,7 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
                     }
                   foundMatch = true;
                   m_workStack.push_back (info.name);
-                  DoResolve (pathLeft, object);
+                  DoResolve (token + 1, object);
                   m_workStack.pop_back ();
                 }
               // attempt to cast to an object vector.
@@ -557,12 +599,10 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
                 dynamic_cast<const ObjectPtrContainerChecker *> (PeekPointer (info.checker));
               if (vectorChecker != 0)
                 {
-                  NS_LOG_DEBUG ("GetAttribute(vector)=" << info.name << " on path=" << GetResolvedPath () << pathLeft);
+                  NS_LOG_DEBUG ("GetAttribute(vector)=" << info.name << " on path=" << GetResolvedPath ());
                   foundMatch = true;
-                  ObjectPtrContainerValue vector;
-                  root->GetAttribute (info.name, vector);
                   m_workStack.push_back (info.name);
-                  DoArrayResolve (pathLeft, vector);
+                  DoArrayResolve (token + 1, root, info);
                   m_workStack.pop_back ();
                 }
               // this could be anything else and we don't know what to do with it.
@@ -582,19 +622,41 @@ Resolver::DoResolve (std::string path, Ptr<Object> root)
 }
 
 void
-Resolver::DoArrayResolve (std::string path, const ObjectPtrContainerValue &container)
+Resolver::DoArrayResolve (std::size_t token, Ptr<Object> object,
+                          const struct TypeId::AttributeInformation &info)
 {
-  NS_LOG_FUNCTION (this << path << &container);
-  NS_ASSERT (path != "");
-  NS_ASSERT ((path.find ("/")) == 0);
-  std::string::size_type next = path.find ("/", 1);
-  if (next == std::string::npos)
+  NS_LOG_FUNCTION (this << token << object << info.name);
+  if (token == m_tokens.size ())
+    {
+      return;
+    }
+  const std::string &item = m_tokens[token];
+
+  //
+  // A plain index selects at most one element: fetch it directly
+  // rather than copying the whole container, so that paths such as
+  // "/NodeList/N/..." resolve in constant time however many nodes
+  // there are.
+  //
+  uint32_t index;
+  const ObjectPtrContainerAccessor *accessor =
+    dynamic_cast<const ObjectPtrContainerAccessor *> (PeekPointer (info.accessor));
+  if (accessor != 0 && ArrayMatcher (item).IsIndex (&index))
     {
+      Ptr<Object> element = accessor->GetOne (PeekPointer (object), index);
+      if (element != 0)
+        {
+          std::ostringstream oss;
+          oss << index;
+          m_workStack.push_back (oss.str ());
+          DoResolve (token + 1, element);
+          m_workStack.pop_back ();
+        }
       return;
     }
-  std::string item = path.substr (1, next - 1);
-  std::string pathLeft = path.substr (next, path.size () - next);
 
+  ObjectPtrContainerValue container;
+  object->GetAttribute (info.name, container);
   ArrayMatcher matcher = ArrayMatcher (item);
   ObjectPtrContainerValue::Iterator it;
   for (it = container.Begin (); it != container.End (); ++it)
@@ -604,7 +666,7 @@ Resolver::DoArrayResolve (std::string path, const ObjectPtrContainerValue &conta
           std::ostringstream oss;
           oss << (*it).first;
           m_workStack.push_back (oss.str ());
-          DoResolve (pathLeft, (*it).second);
+          DoResolve (token + 1, (*it).second);
           m_workStack.pop_back ();
         }
     }
@@ -631,6 +693,10 @@ public:
   void DisconnectWithoutContext (std::string path, const CallbackBase &cb);
   /** \copydoc Config::Disconnect() */
   void Disconnect (std::string path, const CallbackBase &cb);
+  /** \copydoc Config::ConnectBulk() */
+  std::size_t ConnectBulk (const std::vector<std::string> &paths, const CallbackBase &cb);
+  /** \copydoc Config::ConnectWithoutContextBulk() */
+  std::size_t ConnectWithoutContextBulk (const std::vector<std::string> &paths, const CallbackBase &cb);
   /** \copydoc Config::LookupMatches() */
   MatchContainer LookupMatches (std::string path);
 
@@ -653,6 +719,15 @@ private:
    * \param [in,out] leaf The trailing part of the \pname{path}.
    */
   void ParsePath (std::string path, std::string *root, std::string *leaf) const;
+  /**
+   * Connect a callback to the trace sources matching a set of Config paths.
+   * \param [in] paths The Config paths.
+   * \param [in] cb The callback to connect.
+   * \param [in] context Whether \pname{cb} receives the context string.
+   * \returns The number of trace sources connected.
+   */
+  std::size_t DoConnectBulk (const std::vector<std::string> &paths,
+                             const CallbackBase &cb, bool context);
 
   /** Container type to hold the root Config path tokens. */
   typedef std::vector<Ptr<Object> > Roots;
@@ -747,6 +822,66 @@ ConfigImpl::Disconnect (std::string path, const CallbackBase &cb)
   container.Disconnect (leaf, cb);
 }
 
+std::size_t
+ConfigImpl::DoConnectBulk (const std::vector<std::string> &paths,
+                           const CallbackBase &cb, bool context)
+{
+  NS_LOG_FUNCTION (this << paths.size () << &cb << context);
+
+  //
+  // Group the paths by their leading part, so that the objects
+  // exporting several of the requested trace sources (for example
+  // CongestionWindow and RTT of the same socket) are looked up once.
+  //
+  std::map<std::string, std::vector<std::string> > leaves;
+  for (std::vector<std::string>::const_iterator i = paths.begin (); i != paths.end (); ++i)
+    {
+      std::string root, leaf;
+      ParsePath (*i, &root, &leaf);
+      leaves[root].push_back (leaf);
+    }
+  std::size_t n = 0;
+  for (std::map<std::string, std::vector<std::string> >::const_iterator i = leaves.begin ();
+       i != leaves.end (); ++i)
+    {
+      MatchContainer container = LookupMatches (i->first);
+      for (std::size_t j = 0; j < container.GetN (); ++j)
+        {
+          Ptr<Object> object = container.Get (j);
+          for (std::vector<std::string>::const_iterator leaf = i->second.begin ();
+               leaf != i->second.end (); ++leaf)
+            {
+              bool ok;
+              if (context)
+                {
+                  ok = object->TraceConnect (*leaf, container.GetMatchedPath (j) + *leaf, cb);
+                }
+              else
+                {
+                  ok = object->TraceConnectWithoutContext (*leaf, cb);
+                }
+              if (ok)
+                {
+                  n++;
+                }
+            }
+        }
+    }
+  return n;
+}
+std::size_t
+ConfigImpl::ConnectBulk (const std::vector<std::string> &paths, const CallbackBase &cb)
+{
+  NS_LOG_FUNCTION (this << paths.size () << &cb);
+  return DoConnectBulk (paths, cb, true);
+}
+std::size_t
+ConfigImpl::ConnectWithoutContextBulk (const std::vector<std::string> &paths, const CallbackBase &cb)
+{
+  NS_LOG_FUNCTION (this << paths.size () << &cb);
+  return DoConnectBulk (paths, cb, false);
+}
+
 MatchContainer
 ConfigImpl::LookupMatches (std::string path)
 {
@@ -937,6 +1072,18 @@ Disconnect (std::string path, const CallbackBase &cb)
   NS_LOG_FUNCTION (path << &cb);
   ConfigImpl::Get ()->Disconnect (path, cb);
 }
+std::size_t
+ConnectBulk (const std::vector<std::string> &paths, const CallbackBase &cb)
+{
+  NS_LOG_FUNCTION (paths.size () << &cb);
+  return ConfigImpl::Get ()->ConnectBulk (paths, cb);
+}
+std::size_t
+ConnectWithoutContextBulk (const std::vector<std::string> &paths, const CallbackBase &cb)
+{
+  NS_LOG_FUNCTION (paths.size () << &cb);
+  return ConfigImpl::Get ()->ConnectWithoutContextBulk (paths, cb);
+}
 MatchContainer LookupMatches (std::string path)
 {
   NS_LOG_FUNCTION (path);
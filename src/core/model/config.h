@@ -168,6 +168,31 @@ bool ConnectFailSafe (std::string path, const CallbackBase &cb);
  * This function undoes the work of Config::ConnectWithContext.
  */
 void Disconnect (std::string path, const CallbackBase &cb);
+/**
+ * \ingroup config
+ * \param [in] paths The paths to match trace sources.
+ * \param [in] cb The callback to connect to the matching trace sources.
+ * \returns The number of trace sources connected.
+ *
+ * This function connects the input callback to all the trace sources
+ * matching any of the input paths, in such a way that the callback
+ * will receive an extra context string upon trace event notification.
+ * Paths which differ only by their trace source name share a single
+ * lookup of the matching objects, which makes this function much
+ * cheaper than one call to ConnectFailSafe per path when tracing
+ * several sources of many objects.  Paths with no matching trace
+ * source are ignored.
+ */
+std::size_t ConnectBulk (const std::vector<std::string> &paths, const CallbackBase &cb);
+/**
+ * \ingroup config
+ * \param [in] paths The paths to match trace sources.
+ * \param [in] cb The callback to connect to the matching trace sources.
+ * \returns The number of trace sources connected.
+ *
+ * This function is the ConnectWithoutContext version of ConnectBulk.
+ */
+std::size_t ConnectWithoutContextBulk (const std::vector<std::string> &paths, const CallbackBase &cb);
 
 /**
  * \ingroup config
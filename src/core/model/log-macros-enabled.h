@@ -198,6 +198,32 @@
         }                                                       \
     } while (false)
 
+#ifdef NS3_LOG_FUNCTION_DISABLE
+
+/**
+ * \ingroup logging
+ *
+ * Function logging is compiled out:  NS_LOG_FUNCTION_NOARGS()
+ * expands to nothing.
+ */
+#define NS_LOG_FUNCTION_NOARGS()
+
+/**
+ * \ingroup logging
+ *
+ * Function logging is compiled out:  the parameters of
+ * NS_LOG_FUNCTION() are still type-checked, but never evaluated.
+ *
+ * \param [in] parameters The parameters to output.
+ */
+#define NS_LOG_FUNCTION(parameters)                             \
+  do if (false)                                                 \
+    {                                                           \
+      ns3::ParameterLogger (std::clog) << parameters;           \
+    } while (false)
+
+#else /* NS3_LOG_FUNCTION_DISABLE */
+
 /**
  * \ingroup logging
  *
@@ -258,6 +284,8 @@
     }                                                           \
   while (false)
 
+#endif /* NS3_LOG_FUNCTION_DISABLE */
+
 
 /**
  * \ingroup logging
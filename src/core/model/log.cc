@@ -278,19 +278,6 @@ LogComponent::EnvVarCheck (void)
 }
 
 
-bool
-LogComponent::IsEnabled (const enum LogLevel level) const
-{
-  //  LogComponentEnableEnvVar ();
-  return (level & m_levels) ? 1 : 0;
-}
-
-bool
-LogComponent::IsNoneEnabled (void) const
-{
-  return m_levels == 0;
-}
-
 void
 LogComponent::SetMask (const enum LogLevel level)
 {
@@ -300,13 +287,13 @@ LogComponent::SetMask (const enum LogLevel level)
 void
 LogComponent::Enable (const enum LogLevel level)
 {
-  m_levels |= (level & ~m_mask);
+  m_levels.fetch_or (level & ~m_mask, std::memory_order_relaxed);
 }
 
 void
 LogComponent::Disable (const enum LogLevel level)
 {
-  m_levels &= ~level;
+  m_levels.fetch_and (~level, std::memory_order_relaxed);
 }
 
 char const *
@@ -26,6 +26,7 @@
 #include <stdint.h>
 #include <map>
 #include <vector>
+#include <atomic>
 
 #include "node-printer.h"
 #include "time-printer.h"
@@ -203,7 +204,7 @@ void LogComponentDisableAll (enum LogLevel level);
  * \param [in] name The log component name.
  */
 #define NS_LOG_COMPONENT_DEFINE(name)                           \
-  static ns3::LogComponent g_log = ns3::LogComponent (name, __FILE__)
+  static ns3::LogComponent g_log (name, __FILE__)
 
 /**
  * Define a logging component with a mask.
@@ -214,7 +215,7 @@ void LogComponentDisableAll (enum LogLevel level);
  * \param [in] mask The default mask.
  */
 #define NS_LOG_COMPONENT_DEFINE_MASK(name, mask)                \
-  static ns3::LogComponent g_log = ns3::LogComponent (name, __FILE__, mask)
+  static ns3::LogComponent g_log (name, __FILE__, mask)
 
 /**
  * Declare a reference to a Log component.
@@ -427,7 +428,14 @@ private:
    */
   void EnvVarCheck (void);
 
-  int32_t     m_levels;  //!< Enabled LogLevels.
+  /**
+   * Enabled LogLevels.
+   *
+   * This is read by every logging macro before any argument is
+   * evaluated, so it is an atomic bitmask checked inline with a
+   * relaxed load.
+   */
+  std::atomic<int32_t> m_levels;
   int32_t     m_mask;    //!< Blocked LogLevels.
   std::string m_name;    //!< LogComponent name.
   std::string m_file;    //!< File defining this LogComponent.
@@ -479,6 +487,18 @@ public:
 
 };
 
+inline bool
+LogComponent::IsEnabled (const enum LogLevel level) const
+{
+  return (level & m_levels.load (std::memory_order_relaxed)) ? 1 : 0;
+}
+
+inline bool
+LogComponent::IsNoneEnabled (void) const
+{
+  return m_levels.load (std::memory_order_relaxed) == 0;
+}
+
 template<typename T>
 ParameterLogger&
 ParameterLogger::operator<< (T param)
@@ -228,6 +228,15 @@ public:
   virtual bool Get (const ObjectBase * object, AttributeValue &value) const;
   virtual bool HasGetter (void) const;
   virtual bool HasSetter (void) const;
+  /**
+   * Get a single instance from the container, identified by index,
+   * without building an ObjectPtrContainerValue of all the instances.
+   *
+   * \param [in] object The container object.
+   * \param [in] index The index of the requested instance.
+   * \returns The requested instance, or null if there is none.
+   */
+  Ptr<Object> GetOne (const ObjectBase * object, std::size_t index) const;
 
 private:
   /**
@@ -21,7 +21,7 @@
 #ifndef TRACED_CALLBACK_H
 #define TRACED_CALLBACK_H
 
-#include <list>
+#include <vector>
 #include "callback.h"
 
 /**
@@ -42,6 +42,11 @@ namespace ns3 {
  * of Callback.  Connect adds a Callback at the end of the chain
  * of callbacks.  Disconnect removes a Callback from the chain of callbacks.
  *
+ * Most trace sources have either no sink or a single sink connected,
+ * so the first Callback of the chain is stored inline and only the
+ * following ones go to a separate vector.  Invoking a TracedCallback
+ * with no sink connected costs a single null pointer test.
+ *
  * This is a functor: the chain of Callbacks is invoked by
  * calling the \c operator() form with the appropriate
  * number of arguments.
@@ -89,6 +94,12 @@ public:
    * \param [in] args The arguments to the functor
    */
   void operator() (Ts... args) const;
+  /**
+   * Check whether any Callback is connected.
+   *
+   * \return \c true if the chain of Callbacks is empty.
+   */
+  bool IsEmpty (void) const;
 
   /**
    *  TracedCallback signature for POD.
@@ -103,12 +114,23 @@ public:
 
 private:
   /**
-   * Container type for holding the chain of Callbacks.
+   * Container type for holding the Callbacks following the first one.
    *
    * \tparam Ts \deduced Types of the functor arguments.
    */
-  typedef std::list<Callback<void,Ts...> > CallbackList;
-  /** The chain of Callbacks. */
+  typedef std::vector<Callback<void,Ts...> > CallbackList;
+  /**
+   * Append a Callback to the chain.
+   *
+   * \param [in] callback Callback to add to chain.
+   */
+  void Append (const Callback<void,Ts...> & callback);
+  /**
+   * The first Callback of the chain, null if the chain is empty.
+   * The chain is empty if and only if this Callback is null.
+   */
+  Callback<void,Ts...> m_first;
+  /** The rest of the chain of Callbacks. */
   CallbackList m_callbackList;
 };
 
@@ -123,10 +145,24 @@ namespace ns3 {
 
 template<typename... Ts>
 TracedCallback<Ts...>::TracedCallback ()
-  : m_callbackList ()
+  : m_first (),
+    m_callbackList ()
 {}
 template<typename... Ts>
 void
+TracedCallback<Ts...>::Append (const Callback<void,Ts...> & callback)
+{
+  if (m_first.IsNull ())
+    {
+      m_first = callback;
+    }
+  else
+    {
+      m_callbackList.push_back (callback);
+    }
+}
+template<typename... Ts>
+void
 TracedCallback<Ts...>::ConnectWithoutContext (const CallbackBase & callback)
 {
   Callback<void,Ts...> cb;
@@ -134,7 +170,7 @@ TracedCallback<Ts...>::ConnectWithoutContext (const CallbackBase & callback)
     {
       NS_FATAL_ERROR_NO_MSG ();
     }
-  m_callbackList.push_back (cb);
+  Append (cb);
 }
 template<typename... Ts>
 void
@@ -146,7 +182,7 @@ TracedCallback<Ts...>::Connect (const CallbackBase & callback, std::string path)
       NS_FATAL_ERROR ("when connecting to " << path);
     }
   Callback<void,Ts...> realCb = cb.Bind (path);
-  m_callbackList.push_back (realCb);
+  Append (realCb);
 }
 template<typename... Ts>
 void
@@ -164,6 +200,18 @@ TracedCallback<Ts...>::DisconnectWithoutContext (const CallbackBase & callback)
           i++;
         }
     }
+  if (!m_first.IsNull () && m_first.IsEqual (callback))
+    {
+      if (m_callbackList.empty ())
+        {
+          m_first.Nullify ();
+        }
+      else
+        {
+          m_first = m_callbackList.front ();
+          m_callbackList.erase (m_callbackList.begin ());
+        }
+    }
 }
 template<typename... Ts>
 void
@@ -181,12 +229,24 @@ template<typename... Ts>
 void
 TracedCallback<Ts...>::operator() (Ts... args) const
 {
-  for (typename CallbackList::const_iterator i = m_callbackList.begin ();
-       i != m_callbackList.end (); i++)
+  if (m_first.IsNull ())
+    {
+      return;
+    }
+  m_first (args...);
+  // Index-based iteration: a sink may connect further sinks while
+  // the chain is being invoked, which can reallocate the vector.
+  for (std::size_t i = 0; i < m_callbackList.size (); i++)
     {
-      (*i)(args...);
+      m_callbackList[i] (args...);
     }
 }
+template<typename... Ts>
+bool
+TracedCallback<Ts...>::IsEmpty (void) const
+{
+  return m_first.IsNull ();
+}
 
 } // namespace ns3
 
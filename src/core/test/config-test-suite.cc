@@ -785,6 +785,97 @@ ObjectVectorTraceConfigTestCase::DoRun (void)
   NS_TEST_ASSERT_MSG_EQ (m_path, "/NodeA/NodeB/NodesB/1/Source", "Trace 1 did not provide expected context");
 }
 
+/**
+ * \ingroup config-tests
+ * Test for the ability to connect many trace sources at once and to
+ * resolve single indices of vectors of Object.
+ */
+class BulkTraceConfigTestCase : public TestCase
+{
+public:
+  /** Constructor. */
+  BulkTraceConfigTestCase ();
+  /** Destructor. */
+  virtual ~BulkTraceConfigTestCase ()
+  {}
+
+  /**
+   * Trace callback with context path.
+   * \param path The context path.
+   * \param old The old value.
+   * \param newValue The new value.
+   */
+  void TraceWithPath (std::string path, int16_t old, int16_t newValue)
+  {
+    NS_UNUSED (old);
+    m_newValue = newValue;
+    m_path = path;
+    m_calls++;
+  }
+
+private:
+  virtual void DoRun (void);
+
+  int16_t m_newValue; //!< Flag to detect tracing result.
+  std::string m_path; //!< The context path.
+  uint32_t m_calls;   //!< Number of trace callback invocations.
+};
+
+BulkTraceConfigTestCase::BulkTraceConfigTestCase ()
+  : TestCase ("Check ability to bulk connect trace sources through vectors of Object")
+{}
+
+void
+BulkTraceConfigTestCase::DoRun (void)
+{
+  Ptr<ConfigTestObject> root = CreateObject<ConfigTestObject> ();
+  Config::RegisterRootNamespaceObject (root);
+
+  std::vector<Ptr<ConfigTestObject> > objects;
+  for (uint32_t i = 0; i < 100; i++)
+    {
+      objects.push_back (CreateObject<ConfigTestObject> ());
+      root->AddNodeA (objects.back ());
+    }
+
+  //
+  // A single index must select exactly one object, and an index past
+  // the end of the vector none.
+  //
+  Config::MatchContainer matches = Config::LookupMatches ("/NodesA/42");
+  NS_TEST_ASSERT_MSG_EQ (matches.GetN (), 1, "Wrong number of objects matching a single index");
+  NS_TEST_ASSERT_MSG_EQ (matches.Get (0), objects[42], "Wrong object matching a single index");
+  NS_TEST_ASSERT_MSG_EQ (matches.GetMatchedPath (0), "/NodesA/42/", "Wrong matched path");
+  matches = Config::LookupMatches ("/NodesA/100");
+  NS_TEST_ASSERT_MSG_EQ (matches.GetN (), 0, "Object matching an index past the end");
+
+  //
+  // Connect one trace source of every other object, plus a path
+  // matching nothing, which must be ignored.
+  //
+  std::vector<std::string> paths;
+  for (uint32_t i = 0; i < 100; i += 2)
+    {
+      std::ostringstream oss;
+      oss << "/NodesA/" << i << "/Source";
+      paths.push_back (oss.str ());
+    }
+  paths.push_back ("/NodesA/1000/Source");
+  std::size_t n = Config::ConnectBulk (paths, MakeCallback (&BulkTraceConfigTestCase::TraceWithPath, this));
+  NS_TEST_ASSERT_MSG_EQ (n, 50, "Wrong number of trace sources connected");
+
+  m_calls = 0;
+  m_newValue = 0;
+  objects[42]->SetAttribute ("Source", IntegerValue (-2));
+  NS_TEST_ASSERT_MSG_EQ (m_newValue, -2, "Trace 42 did not fire as expected");
+  NS_TEST_ASSERT_MSG_EQ (m_path, "/NodesA/42/Source", "Trace 42 did not provide expected context");
+  objects[43]->SetAttribute ("Source", IntegerValue (-3));
+  NS_TEST_ASSERT_MSG_EQ (m_newValue, -2, "Trace 43 fired unexpectedly");
+  NS_TEST_ASSERT_MSG_EQ (m_calls, 1, "Wrong number of trace callback invocations");
+
+  Config::UnregisterRootNamespaceObject (root);
+}
+
 /**
  * \ingroup config-tests
  * Test for the ability to search attributes of parent classes
@@ -858,6 +949,7 @@ ConfigTestSuite::ConfigTestSuite ()
   AddTestCase (new UnderRootNamespaceConfigTestCase);
   AddTestCase (new ObjectVectorConfigTestCase);
   AddTestCase (new SearchAttributesOfParentObjectsTestCase);
+  AddTestCase (new BulkTraceConfigTestCase);
 }
 
 /**
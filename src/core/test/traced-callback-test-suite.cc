@@ -19,6 +19,7 @@
 #include "ns3/test.h"
 #include "ns3/traced-callback.h"
 #include "ns3/unused.h"
+#include <vector>
 
 using namespace ns3;
 
@@ -113,6 +114,73 @@ BasicTracedCallbackTestCase::DoRun (void)
   NS_TEST_ASSERT_MSG_EQ (m_two, true, "Callback CbTwo not called");
 }
 
+class OrderTracedCallbackTestCase : public TestCase
+{
+public:
+  OrderTracedCallbackTestCase ();
+  virtual ~OrderTracedCallbackTestCase ()
+  {}
+
+private:
+  virtual void DoRun (void);
+
+  void Cb (uint32_t id);
+
+  std::vector<uint32_t> m_calls;
+};
+
+OrderTracedCallbackTestCase::OrderTracedCallbackTestCase ()
+  : TestCase ("Check TracedCallback invocation order and emptiness")
+{}
+
+void
+OrderTracedCallbackTestCase::Cb (uint32_t id)
+{
+  m_calls.push_back (id);
+}
+
+void
+OrderTracedCallbackTestCase::DoRun (void)
+{
+  TracedCallback<> trace;
+  NS_TEST_ASSERT_MSG_EQ (trace.IsEmpty (), true, "New TracedCallback not empty");
+  trace ();
+
+  //
+  // Connect three sinks: the first one is held inline, the other two
+  // in the overflow vector.  They must be invoked in connection order.
+  //
+  Callback<void> one = MakeCallback (&OrderTracedCallbackTestCase::Cb, this).Bind (1u);
+  Callback<void> two = MakeCallback (&OrderTracedCallbackTestCase::Cb, this).Bind (2u);
+  Callback<void> three = MakeCallback (&OrderTracedCallbackTestCase::Cb, this).Bind (3u);
+  trace.ConnectWithoutContext (one);
+  NS_TEST_ASSERT_MSG_EQ (trace.IsEmpty (), false, "TracedCallback with a sink is empty");
+  trace.ConnectWithoutContext (two);
+  trace.ConnectWithoutContext (three);
+  trace ();
+  NS_TEST_ASSERT_MSG_EQ (m_calls.size (), 3, "Wrong number of calls");
+  NS_TEST_ASSERT_MSG_EQ (m_calls[0], 1, "Wrong invocation order");
+  NS_TEST_ASSERT_MSG_EQ (m_calls[1], 2, "Wrong invocation order");
+  NS_TEST_ASSERT_MSG_EQ (m_calls[2], 3, "Wrong invocation order");
+
+  //
+  // Disconnecting the inline sink must promote the next one, keeping order.
+  //
+  trace.DisconnectWithoutContext (one);
+  m_calls.clear ();
+  trace ();
+  NS_TEST_ASSERT_MSG_EQ (m_calls.size (), 2, "Wrong number of calls");
+  NS_TEST_ASSERT_MSG_EQ (m_calls[0], 2, "Wrong invocation order");
+  NS_TEST_ASSERT_MSG_EQ (m_calls[1], 3, "Wrong invocation order");
+
+  trace.DisconnectWithoutContext (three);
+  trace.DisconnectWithoutContext (two);
+  NS_TEST_ASSERT_MSG_EQ (trace.IsEmpty (), true, "TracedCallback not empty");
+  m_calls.clear ();
+  trace ();
+  NS_TEST_ASSERT_MSG_EQ (m_calls.size (), 0, "Unexpected call");
+}
+
 class TracedCallbackTestSuite : public TestSuite
 {
 public:
@@ -123,6 +191,7 @@ TracedCallbackTestSuite::TracedCallbackTestSuite ()
   : TestSuite ("traced-callback", UNIT)
 {
   AddTestCase (new BasicTracedCallbackTestCase, TestCase::QUICK);
+  AddTestCase (new OrderTracedCallbackTestCase, TestCase::QUICK);
 }
 
 static TracedCallbackTestSuite tracedCallbackTestSuite;
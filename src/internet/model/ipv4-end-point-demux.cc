@@ -22,6 +22,7 @@
 #include "ipv4-end-point.h"
 #include "ipv4-interface-address.h"
 #include "ns3/log.h"
+#include <algorithm>
 
 
 namespace ns3 {
@@ -40,23 +41,21 @@ Ipv4EndPointDemux::~Ipv4EndPointDemux ()
   for (EndPointsI i = m_endPoints.begin (); i != m_endPoints.end (); i++) 
     {
       Ipv4EndPoint *endPoint = *i;
+      endPoint->m_demux = 0;
       delete endPoint;
     }
   m_endPoints.clear ();
+  m_positions.clear ();
+  m_connected.clear ();
+  m_wildcards.clear ();
+  m_ports.clear ();
 }
 
 bool
 Ipv4EndPointDemux::LookupPortLocal (uint16_t port)
 {
   NS_LOG_FUNCTION (this << port);
-  for (EndPointsI i = m_endPoints.begin (); i != m_endPoints.end (); i++) 
-    {
-      if ((*i)->GetLocalPort  () == port) 
-        {
-          return true;
-        }
-    }
-  return false;
+  return m_ports.find (port) != m_ports.end ();
 }
 
 bool
@@ -86,7 +85,7 @@ Ipv4EndPointDemux::Allocate (void)
       return 0;
     }
   Ipv4EndPoint *endPoint = new Ipv4EndPoint (Ipv4Address::GetAny (), port);
-  m_endPoints.push_back (endPoint);
+  Insert (endPoint);
   NS_LOG_DEBUG ("Now have >>" << m_endPoints.size () << "<< endpoints.");
   return endPoint;
 }
@@ -102,7 +101,7 @@ Ipv4EndPointDemux::Allocate (Ipv4Address address)
       return 0;
     }
   Ipv4EndPoint *endPoint = new Ipv4EndPoint (address, port);
-  m_endPoints.push_back (endPoint);
+  Insert (endPoint);
   NS_LOG_DEBUG ("Now have >>" << m_endPoints.size () << "<< endpoints.");
   return endPoint;
 }
@@ -125,7 +124,7 @@ Ipv4EndPointDemux::Allocate (Ptr<NetDevice> boundNetDevice, Ipv4Address address,
       return 0;
     }
   Ipv4EndPoint *endPoint = new Ipv4EndPoint (address, port);
-  m_endPoints.push_back (endPoint);
+  Insert (endPoint);
   NS_LOG_DEBUG ("Now have >>" << m_endPoints.size () << "<< endpoints.");
   return endPoint;
 }
@@ -136,7 +135,16 @@ Ipv4EndPointDemux::Allocate (Ptr<NetDevice> boundNetDevice,
                              Ipv4Address peerAddress, uint16_t peerPort)
 {
   NS_LOG_FUNCTION (this << localAddress << localPort << peerAddress << peerPort << boundNetDevice);
-  for (EndPointsI i = m_endPoints.begin (); i != m_endPoints.end (); i++) 
+  // the end points with this four-tuple are either connected or wildcards
+  Key key = { localAddress, peerAddress, localPort, peerPort };
+  std::vector<Ipv4EndPoint *> endPoints;
+  FindConnected (key, endPoints);
+  std::unordered_map<uint16_t, std::vector<Ipv4EndPoint *> >::iterator wildcards = m_wildcards.find (localPort);
+  if (wildcards != m_wildcards.end ())
+    {
+      endPoints.insert (endPoints.end (), wildcards->second.begin (), wildcards->second.end ());
+    }
+  for (std::vector<Ipv4EndPoint *>::iterator i = endPoints.begin (); i != endPoints.end (); i++)
     {
       if ((*i)->GetLocalPort () == localPort &&
           (*i)->GetLocalAddress () == localAddress &&
@@ -150,7 +158,7 @@ Ipv4EndPointDemux::Allocate (Ptr<NetDevice> boundNetDevice,
     }
   Ipv4EndPoint *endPoint = new Ipv4EndPoint (localAddress, localPort);
   endPoint->SetPeer (peerAddress, peerPort);
-  m_endPoints.push_back (endPoint);
+  Insert (endPoint);
 
   NS_LOG_DEBUG ("Now have >>" << m_endPoints.size () << "<< endpoints.");
 
@@ -161,14 +169,14 @@ void
 Ipv4EndPointDemux::DeAllocate (Ipv4EndPoint *endPoint)
 {
   NS_LOG_FUNCTION (this << endPoint);
-  for (EndPointsI i = m_endPoints.begin (); i != m_endPoints.end (); i++) 
+  std::unordered_map<Ipv4EndPoint *, EndPointsI>::iterator position = m_positions.find (endPoint);
+  if (position != m_positions.end ())
     {
-      if (*i == endPoint)
-        {
-          delete endPoint;
-          m_endPoints.erase (i);
-          break;
-        }
+      Unindex (endPoint);
+      m_endPoints.erase (position->second);
+      m_positions.erase (position);
+      endPoint->m_demux = 0;
+      delete endPoint;
     }
 }
 
@@ -208,7 +216,36 @@ Ipv4EndPointDemux::Lookup (Ipv4Address daddr, uint16_t dport,
   EndPoints retval4; // Exact match on all 4
 
   NS_LOG_DEBUG ("Looking up endpoint for destination address " << daddr << ":" << dport);
-  for (EndPointsI i = m_endPoints.begin (); i != m_endPoints.end (); i++) 
+
+  // The connected end points can only match the four-tuple of the packet,
+  // or the four-tuple with a subnet-directed local address (case 3 below);
+  // the other end points are looked up by local port.
+  std::vector<Ipv4EndPoint *> candidates;
+  Key key = { daddr, saddr, dport, sport };
+  FindConnected (key, candidates);
+  for (uint32_t i = 0; incomingInterface && i < incomingInterface->GetNAddresses (); i++)
+    {
+      Ipv4InterfaceAddress addr = incomingInterface->GetAddress (i);
+      Ipv4Address addrNetpart = addr.GetLocal ().CombineMask (addr.GetMask ());
+      bool seen = addrNetpart == daddr;
+      for (uint32_t j = 0; j < i && !seen; j++)
+        {
+          Ipv4InterfaceAddress other = incomingInterface->GetAddress (j);
+          seen = other.GetLocal ().CombineMask (other.GetMask ()) == addrNetpart;
+        }
+      if (!seen && daddr.CombineMask (addr.GetMask ()) == addrNetpart)
+        {
+          key.m_localAddress = addrNetpart;
+          FindConnected (key, candidates);
+        }
+    }
+  std::unordered_map<uint16_t, std::vector<Ipv4EndPoint *> >::iterator wildcards = m_wildcards.find (dport);
+  if (wildcards != m_wildcards.end ())
+    {
+      candidates.insert (candidates.end (), wildcards->second.begin (), wildcards->second.end ());
+    }
+
+  for (std::vector<Ipv4EndPoint *>::iterator i = candidates.begin (); i != candidates.end (); i++)
     {
       Ipv4EndPoint* endP = *i;
 
@@ -377,6 +414,102 @@ Ipv4EndPointDemux::SimpleLookup (Ipv4Address daddr,
     }
   return generic;
 }
+
+void
+Ipv4EndPointDemux::Insert (Ipv4EndPoint *endPoint)
+{
+  NS_LOG_FUNCTION (this << endPoint);
+  m_endPoints.push_back (endPoint);
+  m_positions[endPoint] = --m_endPoints.end ();
+  endPoint->m_demux = this;
+  Index (endPoint);
+}
+
+void
+Ipv4EndPointDemux::Index (Ipv4EndPoint *endPoint)
+{
+  NS_LOG_FUNCTION (this << endPoint);
+  m_ports[endPoint->GetLocalPort ()]++;
+  if (IsConnected (endPoint))
+    {
+      Key key = { endPoint->GetLocalAddress (), endPoint->GetPeerAddress (),
+                  endPoint->GetLocalPort (), endPoint->GetPeerPort () };
+      m_connected[key].push_back (endPoint);
+    }
+  else
+    {
+      m_wildcards[endPoint->GetLocalPort ()].push_back (endPoint);
+    }
+}
+
+void
+Ipv4EndPointDemux::Unindex (Ipv4EndPoint *endPoint)
+{
+  NS_LOG_FUNCTION (this << endPoint);
+  std::unordered_map<uint16_t, uint32_t>::iterator port = m_ports.find (endPoint->GetLocalPort ());
+  NS_ASSERT (port != m_ports.end ());
+  if (--port->second == 0)
+    {
+      m_ports.erase (port);
+    }
+  if (IsConnected (endPoint))
+    {
+      Key key = { endPoint->GetLocalAddress (), endPoint->GetPeerAddress (),
+                  endPoint->GetLocalPort (), endPoint->GetPeerPort () };
+      std::unordered_map<Key, std::vector<Ipv4EndPoint *>, KeyHash>::iterator connected = m_connected.find (key);
+      NS_ASSERT (connected != m_connected.end ());
+      connected->second.erase (std::find (connected->second.begin (), connected->second.end (), endPoint));
+      if (connected->second.empty ())
+        {
+          m_connected.erase (connected);
+        }
+    }
+  else
+    {
+      std::unordered_map<uint16_t, std::vector<Ipv4EndPoint *> >::iterator wildcards =
+        m_wildcards.find (endPoint->GetLocalPort ());
+      NS_ASSERT (wildcards != m_wildcards.end ());
+      wildcards->second.erase (std::find (wildcards->second.begin (), wildcards->second.end (), endPoint));
+      if (wildcards->second.empty ())
+        {
+          m_wildcards.erase (wildcards);
+        }
+    }
+}
+
+bool
+Ipv4EndPointDemux::IsConnected (Ipv4EndPoint *endPoint)
+{
+  return endPoint->GetLocalAddress () != Ipv4Address::GetAny ()
+         && endPoint->GetPeerAddress () != Ipv4Address::GetAny ()
+         && endPoint->GetPeerPort () != 0;
+}
+
+void
+Ipv4EndPointDemux::FindConnected (const Key &key, std::vector<Ipv4EndPoint *> &endPoints)
+{
+  std::unordered_map<Key, std::vector<Ipv4EndPoint *>, KeyHash>::iterator connected = m_connected.find (key);
+  if (connected != m_connected.end ())
+    {
+      endPoints.insert (endPoints.end (), connected->second.begin (), connected->second.end ());
+    }
+}
+
+bool
+Ipv4EndPointDemux::Key::operator== (const Key &other) const
+{
+  return m_localAddress == other.m_localAddress && m_peerAddress == other.m_peerAddress
+         && m_localPort == other.m_localPort && m_peerPort == other.m_peerPort;
+}
+
+std::size_t
+Ipv4EndPointDemux::KeyHash::operator() (const Key &key) const
+{
+  uint64_t addresses = (static_cast<uint64_t> (key.m_localAddress.Get ()) << 32) | key.m_peerAddress.Get ();
+  uint64_t ports = (static_cast<uint64_t> (key.m_localPort) << 16) | key.m_peerPort;
+  return std::hash<uint64_t> () (addresses ^ (ports * 0x9e3779b97f4a7c15ULL));
+}
+
 uint16_t
 Ipv4EndPointDemux::AllocateEphemeralPort (void)
 {
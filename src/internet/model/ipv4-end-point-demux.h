@@ -23,6 +23,8 @@
 
 #include <stdint.h>
 #include <list>
+#include <unordered_map>
+#include <vector>
 #include "ns3/ipv4-address.h"
 #include "ipv4-interface.h"
 
@@ -40,6 +42,13 @@ class Ipv4EndPoint;
  * of endpoints, and has APIs to add and find endpoints in this demux.  This
  * code is shared in common to TCP and UDP protocols in ns3.  This demux
  * sits between ns3's layer four and the socket layer
+ *
+ * The connected endpoints, i.e., the endpoints with a local address and
+ * a peer address and port, are indexed by their four-tuple in a hash
+ * table, and the other endpoints (listeners and wildcard endpoints) by
+ * their local port, so that the lookups do not depend on the number of
+ * connections.  The endpoints notify the demux when their addresses or
+ * ports change.
  */
 
 class Ipv4EndPointDemux {
@@ -166,6 +175,61 @@ public:
   void DeAllocate (Ipv4EndPoint *endPoint);
 
 private:
+  friend class Ipv4EndPoint;
+
+  /// The four-tuple of a connected endpoint
+  struct Key
+  {
+    Ipv4Address m_localAddress; //!< the local address
+    Ipv4Address m_peerAddress;  //!< the peer address
+    uint16_t m_localPort;       //!< the local port
+    uint16_t m_peerPort;        //!< the peer port
+
+    /**
+     * \param other another key
+     * \return true if the keys are equal
+     */
+    bool operator== (const Key &other) const;
+  };
+
+  /// Hash function of the four-tuples
+  struct KeyHash
+  {
+    /**
+     * \param key a four-tuple
+     * \return the hash of the four-tuple
+     */
+    std::size_t operator() (const Key &key) const;
+  };
+
+  /**
+   * \brief Add a new end point to the list and to the indexes.
+   * \param endPoint the end point
+   */
+  void Insert (Ipv4EndPoint *endPoint);
+  /**
+   * \brief Add an end point to the indexes.
+   * \param endPoint the end point
+   */
+  void Index (Ipv4EndPoint *endPoint);
+  /**
+   * \brief Remove an end point from the indexes, e.g., before a change of
+   * its four-tuple.
+   * \param endPoint the end point
+   */
+  void Unindex (Ipv4EndPoint *endPoint);
+  /**
+   * \param endPoint an end point
+   * \return true if the end point has a local address and a peer address
+   * and port, i.e., is indexed by its four-tuple
+   */
+  static bool IsConnected (Ipv4EndPoint *endPoint);
+  /**
+   * \brief Find the connected end points with a given four-tuple.
+   * \param key the four-tuple
+   * \param endPoints the vector to which the end points are appended
+   */
+  void FindConnected (const Key &key, std::vector<Ipv4EndPoint *> &endPoints);
 
   /**
    * \brief Allocate an ephemeral port.
@@ -192,6 +256,26 @@ private:
    * \brief A list of IPv4 end points.
    */
   EndPoints m_endPoints;
+
+  /**
+   * \brief The positions of the end points in m_endPoints.
+   */
+  std::unordered_map<Ipv4EndPoint *, EndPointsI> m_positions;
+
+  /**
+   * \brief The connected end points, by four-tuple.
+   */
+  std::unordered_map<Key, std::vector<Ipv4EndPoint *>, KeyHash> m_connected;
+
+  /**
+   * \brief The other end points, by local port.
+   */
+  std::unordered_map<uint16_t, std::vector<Ipv4EndPoint *> > m_wildcards;
+
+  /**
+   * \brief The number of end points, by local port.
+   */
+  std::unordered_map<uint16_t, uint32_t> m_ports;
 };
 
 } // namespace ns3
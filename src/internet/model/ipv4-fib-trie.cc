@@ -0,0 +1,239 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ipv4-fib-trie.h"
+#include "ipv4-routing-table-entry.h"
+#include "ns3/assert.h"
+#include "ns3/log.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("Ipv4FibTrie");
+
+Ipv4FibTrie::Ipv4FibTrie ()
+  : m_nextOrder (0),
+    m_n (0)
+{
+  NS_LOG_FUNCTION (this);
+  Clear ();
+}
+
+void
+Ipv4FibTrie::Add (Ipv4RoutingTableEntry *route, uint32_t metric)
+{
+  NS_LOG_FUNCTION (this << route << metric);
+  Entry entry;
+  entry.m_route = route;
+  entry.m_metric = metric;
+  entry.m_order = m_nextOrder++;
+  GetRoutes (route->GetDestNetwork (), route->GetDestNetworkMask (), true)->push_back (entry);
+  m_n++;
+}
+
+void
+Ipv4FibTrie::Remove (Ipv4RoutingTableEntry *route)
+{
+  NS_LOG_FUNCTION (this << route);
+  std::vector<Entry> *routes = GetRoutes (route->GetDestNetwork (), route->GetDestNetworkMask (), false);
+  NS_ASSERT_MSG (routes != 0, "Route not found");
+  for (std::vector<Entry>::iterator it = routes->begin (); it != routes->end (); it++)
+    {
+      if (it->m_route == route)
+        {
+          routes->erase (it);
+          if (--m_n == 0)
+            {
+              // release the nodes, e.g. when the global routes are rebuilt
+              Clear ();
+            }
+          return;
+        }
+    }
+  NS_ASSERT_MSG (false, "Route not found");
+}
+
+void
+Ipv4FibTrie::Clear (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_nodes.assign (1, Node ());
+  m_nodes[0].m_child[0] = -1;
+  m_nodes[0].m_child[1] = -1;
+  m_hosts.clear ();
+  m_irregular.clear ();
+  m_n = 0;
+}
+
+uint32_t
+Ipv4FibTrie::GetN (void) const
+{
+  return m_n;
+}
+
+void
+Ipv4FibTrie::Lookup (Ipv4Address dest, std::vector<Entry *> &matches)
+{
+  NS_LOG_FUNCTION (this << dest);
+  std::size_t first = matches.size ();
+  uint32_t address = dest.Get ();
+  // walk down the prefixes of 0 to 31 bits of the destination
+  int32_t node = 0;
+  for (uint16_t length = 0; node >= 0; length++)
+    {
+      for (Entry &entry : m_nodes[node].m_entries)
+        {
+          matches.push_back (&entry);
+        }
+      if (length == 31)
+        {
+          break;
+        }
+      node = m_nodes[node].m_child[(address >> (31 - length)) & 1];
+    }
+  std::unordered_map<uint32_t, std::vector<Entry> >::iterator host = m_hosts.find (address);
+  if (host != m_hosts.end ())
+    {
+      for (Entry &entry : host->second)
+        {
+          matches.push_back (&entry);
+        }
+    }
+  for (Entry &entry : m_irregular)
+    {
+      if (entry.m_route->GetDestNetworkMask ().IsMatch (dest, entry.m_route->GetDestNetwork ()))
+        {
+          matches.push_back (&entry);
+        }
+    }
+  SortByOrder (matches, first);
+}
+
+void
+Ipv4FibTrie::LookupPrefix (Ipv4Address network, Ipv4Mask mask, std::vector<Entry *> &matches)
+{
+  NS_LOG_FUNCTION (this << network << mask);
+  std::vector<Entry> *routes = GetRoutes (network, mask, false);
+  if (routes == 0)
+    {
+      return;
+    }
+  for (Entry &entry : *routes)
+    {
+      if (entry.m_route->GetDestNetworkMask () == mask
+          && mask.IsMatch (entry.m_route->GetDestNetwork (), network))
+        {
+          matches.push_back (&entry);
+        }
+    }
+}
+
+void
+Ipv4FibTrie::InvalidateCache (void)
+{
+  NS_LOG_FUNCTION (this);
+  for (Node &node : m_nodes)
+    {
+      for (Entry &entry : node.m_entries)
+        {
+          entry.m_cache = 0;
+        }
+    }
+  for (auto &host : m_hosts)
+    {
+      for (Entry &entry : host.second)
+        {
+          entry.m_cache = 0;
+        }
+    }
+  for (Entry &entry : m_irregular)
+    {
+      entry.m_cache = 0;
+    }
+}
+
+std::vector<Ipv4FibTrie::Entry> *
+Ipv4FibTrie::GetPrefix (uint32_t network, uint16_t length, bool create)
+{
+  NS_ASSERT (length < 32);
+  int32_t node = 0;
+  for (uint16_t i = 0; i < length; i++)
+    {
+      uint32_t bit = (network >> (31 - i)) & 1;
+      int32_t child = m_nodes[node].m_child[bit];
+      if (child < 0)
+        {
+          if (!create)
+            {
+              return 0;
+            }
+          child = m_nodes.size ();
+          m_nodes.push_back (Node ());
+          m_nodes[child].m_child[0] = -1;
+          m_nodes[child].m_child[1] = -1;
+          m_nodes[node].m_child[bit] = child;
+        }
+      node = child;
+    }
+  return &m_nodes[node].m_entries;
+}
+
+std::vector<Ipv4FibTrie::Entry> *
+Ipv4FibTrie::GetRoutes (Ipv4Address network, Ipv4Mask mask, bool create)
+{
+  if (!IsContiguous (mask))
+    {
+      return &m_irregular;
+    }
+  uint16_t length = mask.GetPrefixLength ();
+  uint32_t masked = network.Get () & mask.Get ();
+  if (length == 32)
+    {
+      if (create)
+        {
+          return &m_hosts[masked];
+        }
+      std::unordered_map<uint32_t, std::vector<Entry> >::iterator host = m_hosts.find (masked);
+      return host == m_hosts.end () ? 0 : &host->second;
+    }
+  return GetPrefix (masked, length, create);
+}
+
+bool
+Ipv4FibTrie::IsContiguous (Ipv4Mask mask)
+{
+  uint16_t length = mask.GetPrefixLength ();
+  uint32_t ones = length == 0 ? 0 : 0xffffffff << (32 - length);
+  return mask.Get () == ones;
+}
+
+void
+Ipv4FibTrie::SortByOrder (std::vector<Entry *> &matches, std::size_t first)
+{
+  // insertion sort: there are few matches, mostly sorted already
+  for (std::size_t i = first + 1; i < matches.size (); i++)
+    {
+      Entry *entry = matches[i];
+      std::size_t j = i;
+      while (j > first && matches[j - 1]->m_order > entry->m_order)
+        {
+          matches[j] = matches[j - 1];
+          j--;
+        }
+      matches[j] = entry;
+    }
+}
+
+} // namespace ns3
@@ -0,0 +1,162 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#ifndef IPV4_FIB_TRIE_H
+#define IPV4_FIB_TRIE_H
+
+#include <stdint.h>
+#include <vector>
+#include <unordered_map>
+#include "ns3/ipv4-address.h"
+#include "ns3/ipv4-route.h"
+#include "ns3/net-device.h"
+#include "ns3/ptr.h"
+
+namespace ns3 {
+
+class Ipv4RoutingTableEntry;
+
+/**
+ * \ingroup ipv4Routing
+ *
+ * \brief Index of the unicast routes of Ipv4GlobalRouting and
+ * Ipv4StaticRouting by destination prefix.
+ *
+ * The routing protocols keep their route lists, which define the
+ * order and the indexes of the routes; the trie references the same
+ * Ipv4RoutingTableEntry objects and has to be kept in sync with the
+ * lists on every addition and removal.
+ *
+ * The routes are stored in a binary trie indexed by the bits of their
+ * destination network, except the /32 routes, which are stored in a
+ * hash table, and the routes with a non-contiguous mask, which are
+ * scanned.  A lookup returns all the routes matching a destination, in
+ * the order they were added, so that the routing protocols can apply
+ * their own selection rules to a handful of candidates instead of to
+ * the whole table.
+ *
+ * Each route of the trie holds a cache of the Ipv4Route built from it,
+ * which the routing protocols return instead of building a new one for
+ * every packet.  The cache has to be invalidated when the addresses or
+ * the state of the interfaces change.
+ */
+class Ipv4FibTrie
+{
+public:
+  /// A route of the trie
+  struct Entry
+  {
+    Ipv4RoutingTableEntry *m_route; //!< the routing table entry, owned by the routing protocol
+    uint32_t m_metric;              //!< the metric of the route
+    uint64_t m_order;               //!< the order of addition of the route
+    Ptr<Ipv4Route> m_cache;         //!< the Ipv4Route built from the entry, or 0
+  };
+
+  Ipv4FibTrie ();
+
+  /**
+   * \brief Add a route.
+   * \param route the routing table entry, which must outlive its
+   * presence in the trie
+   * \param metric the metric of the route
+   */
+  void Add (Ipv4RoutingTableEntry *route, uint32_t metric = 0);
+  /**
+   * \brief Remove a route.
+   * \param route the routing table entry previously added
+   */
+  void Remove (Ipv4RoutingTableEntry *route);
+  /**
+   * \brief Remove all the routes.
+   */
+  void Clear (void);
+  /**
+   * \return the number of routes
+   */
+  uint32_t GetN (void) const;
+
+  /**
+   * \brief Find the routes whose destination network matches an address.
+   *
+   * The pointers are valid until the next addition or removal.
+   *
+   * \param dest the destination address
+   * \param matches the vector to which the routes are appended, in
+   * their order of addition
+   */
+  void Lookup (Ipv4Address dest, std::vector<Entry *> &matches);
+  /**
+   * \brief Find the routes to a given network, whatever their gateway,
+   * interface and metric.
+   * \param network the destination network
+   * \param mask the mask of the destination network
+   * \param matches the vector to which the routes are appended, in
+   * their order of addition
+   */
+  void LookupPrefix (Ipv4Address network, Ipv4Mask mask, std::vector<Entry *> &matches);
+
+  /**
+   * \brief Drop the cached Ipv4Route of all the routes.
+   */
+  void InvalidateCache (void);
+
+private:
+  /// A node of the binary trie
+  struct Node
+  {
+    int32_t m_child[2];            //!< the index of the children, or -1
+    std::vector<Entry> m_entries;  //!< the routes whose network ends at this node
+  };
+
+  /**
+   * \brief Get the routes of a prefix of at most 31 bits.
+   * \param network the destination network, masked
+   * \param length the length of the prefix
+   * \param create whether to create the missing nodes
+   * \return the routes of the prefix, or 0 if missing
+   */
+  std::vector<Entry> *GetPrefix (uint32_t network, uint16_t length, bool create);
+  /**
+   * \brief Get the routes of a network, wherever they are stored.
+   * \param network the destination network
+   * \param mask the mask of the destination network
+   * \param create whether to create the missing containers
+   * \return the routes of the network (for non-contiguous masks, all of
+   * them), or 0 if missing
+   */
+  std::vector<Entry> *GetRoutes (Ipv4Address network, Ipv4Mask mask, bool create);
+  /**
+   * \param mask a network mask
+   * \return true if the ones of the mask are contiguous
+   */
+  static bool IsContiguous (Ipv4Mask mask);
+  /**
+   * \brief Sort the routes appended to a vector by order of addition.
+   * \param matches the vector
+   * \param first the index of the first appended route
+   */
+  static void SortByOrder (std::vector<Entry *> &matches, std::size_t first);
+
+  std::vector<Node> m_nodes;  //!< the nodes of the trie, the root first
+  std::unordered_map<uint32_t, std::vector<Entry> > m_hosts; //!< the /32 routes
+  std::vector<Entry> m_irregular; //!< the routes with a non-contiguous mask
+  uint64_t m_nextOrder;       //!< the order of the next route
+  uint32_t m_n;               //!< the number of routes
+};
+
+} // namespace ns3
+
+#endif /* IPV4_FIB_TRIE_H */
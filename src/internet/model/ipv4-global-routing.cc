@@ -16,6 +16,7 @@
 // Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
 //
 
+#include <algorithm>
 #include <vector>
 #include <iomanip>
 #include "ns3/names.h"
@@ -27,6 +28,8 @@
 #include "ns3/ipv4-route.h"
 #include "ns3/ipv4-routing-table-entry.h"
 #include "ns3/boolean.h"
+#include "ns3/enum.h"
+#include "ns3/uinteger.h"
 #include "ns3/node.h"
 #include "ipv4-global-routing.h"
 #include "global-route-manager.h"
@@ -48,18 +51,55 @@ Ipv4GlobalRouting::GetTypeId (void)
                    BooleanValue (false),
                    MakeBooleanAccessor (&Ipv4GlobalRouting::m_randomEcmpRouting),
                    MakeBooleanChecker ())
+    .AddAttribute ("EcmpMode",
+                   "The selection of a route among ECMP, unless RandomEcmpRouting is set",
+                   EnumValue (Ipv4GlobalRouting::ECMP_FIRST),
+                   MakeEnumAccessor (&Ipv4GlobalRouting::m_ecmpMode),
+                   MakeEnumChecker (Ipv4GlobalRouting::ECMP_FIRST, "First",
+                                    Ipv4GlobalRouting::ECMP_RANDOM, "Random",
+                                    Ipv4GlobalRouting::ECMP_FLOW, "Flow",
+                                    Ipv4GlobalRouting::ECMP_FLOWLET, "Flowlet"))
+    .AddAttribute ("EcmpHashSeed",
+                   "The seed of the hash of the flows in the Flow and Flowlet ECMP modes; "
+                   "use different seeds on successive switches to avoid the polarization of the flows",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&Ipv4GlobalRouting::m_ecmpHashSeed),
+                   MakeUintegerChecker<uint32_t> ())
+    .AddAttribute ("FlowletTimeout",
+                   "The idle time after which a flow is re-hashed in the Flowlet ECMP mode",
+                   TimeValue (MicroSeconds (500)),
+                   MakeTimeAccessor (&Ipv4GlobalRouting::m_flowletTimeout),
+                   MakeTimeChecker ())
     .AddAttribute ("RespondToInterfaceEvents",
                    "Set to true if you want to dynamically recompute the global routes upon Interface notification events (up/down, or add/remove address)",
                    BooleanValue (false),
                    MakeBooleanAccessor (&Ipv4GlobalRouting::m_respondToInterfaceEvents),
                    MakeBooleanChecker ())
+    .AddAttribute ("UseFib",
+                   "Set to true to look up the routes in tries indexed by destination prefix, "
+                   "and to reuse the Ipv4Route objects; set to false to scan the route lists",
+                   BooleanValue (true),
+                   MakeBooleanAccessor (&Ipv4GlobalRouting::m_useFib),
+                   MakeBooleanChecker ())
+    .AddAttribute ("RouteCacheSize",
+                   "The maximum number of destinations whose route is remembered when UseFib is "
+                   "true and the selected route does not depend on the packet; 0 disables the cache",
+                   UintegerValue (4096),
+                   MakeUintegerAccessor (&Ipv4GlobalRouting::m_routeCacheSize),
+                   MakeUintegerChecker<uint32_t> ())
   ;
   return tid;
 }
 
 Ipv4GlobalRouting::Ipv4GlobalRouting () 
   : m_randomEcmpRouting (false),
-    m_respondToInterfaceEvents (false)
+    m_ecmpMode (ECMP_FIRST),
+    m_ecmpHashSeed (0),
+    m_respondToInterfaceEvents (false),
+    m_useFib (true),
+    m_routeCacheSize (4096),
+    m_flowletPurgeSize (1024),
+    m_nextFlowlet (0)
 {
   NS_LOG_FUNCTION (this);
 
@@ -80,6 +120,8 @@ Ipv4GlobalRouting::AddHostRouteTo (Ipv4Address dest,
   Ipv4RoutingTableEntry *route = new Ipv4RoutingTableEntry ();
   *route = Ipv4RoutingTableEntry::CreateHostRouteTo (dest, nextHop, interface);
   m_hostRoutes.push_back (route);
+  m_hostFib.Add (route);
+  m_routeCache.clear ();
 }
 
 void 
@@ -90,6 +132,8 @@ Ipv4GlobalRouting::AddHostRouteTo (Ipv4Address dest,
   Ipv4RoutingTableEntry *route = new Ipv4RoutingTableEntry ();
   *route = Ipv4RoutingTableEntry::CreateHostRouteTo (dest, interface);
   m_hostRoutes.push_back (route);
+  m_hostFib.Add (route);
+  m_routeCache.clear ();
 }
 
 void 
@@ -105,6 +149,8 @@ Ipv4GlobalRouting::AddNetworkRouteTo (Ipv4Address network,
                                                         nextHop,
                                                         interface);
   m_networkRoutes.push_back (route);
+  m_networkFib.Add (route);
+  m_routeCache.clear ();
 }
 
 void 
@@ -118,6 +164,8 @@ Ipv4GlobalRouting::AddNetworkRouteTo (Ipv4Address network,
                                                         networkMask,
                                                         interface);
   m_networkRoutes.push_back (route);
+  m_networkFib.Add (route);
+  m_routeCache.clear ();
 }
 
 void 
@@ -133,13 +181,16 @@ Ipv4GlobalRouting::AddASExternalRouteTo (Ipv4Address network,
                                                         nextHop,
                                                         interface);
   m_ASexternalRoutes.push_back (route);
+  m_ASexternalFib.Add (route);
+  m_routeCache.clear ();
 }
 
 
 Ptr<Ipv4Route>
-Ipv4GlobalRouting::LookupGlobal (Ipv4Address dest, Ptr<NetDevice> oif)
+Ipv4GlobalRouting::LookupGlobal (const Ipv4Header &header, Ptr<const Packet> p, Ptr<NetDevice> oif)
 {
-  NS_LOG_FUNCTION (this << dest << oif);
+  NS_LOG_FUNCTION (this << header << p << oif);
+  Ipv4Address dest = header.GetDestination ();
   NS_LOG_LOGIC ("Looking for route for destination " << dest);
   Ptr<Ipv4Route> rtentry = 0;
   // store all available routes that bring packets to their destination
@@ -216,18 +267,7 @@ Ipv4GlobalRouting::LookupGlobal (Ipv4Address dest, Ptr<NetDevice> oif)
     }
   if (allRoutes.size () > 0 ) // if route(s) is found
     {
-      // pick up one of the routes uniformly at random if random
-      // ECMP routing is enabled, or always select the first route
-      // consistently if random ECMP routing is disabled
-      uint32_t selectIndex;
-      if (m_randomEcmpRouting)
-        {
-          selectIndex = m_rand->GetInteger (0, allRoutes.size ()-1);
-        }
-      else 
-        {
-          selectIndex = 0;
-        }
+      uint32_t selectIndex = SelectEcmpRoute (allRoutes.size (), header, p);
       Ipv4RoutingTableEntry* route = allRoutes.at (selectIndex); 
       // create a Ipv4Route object from the selected routing table entry
       rtentry = Create<Ipv4Route> ();
@@ -245,6 +285,178 @@ Ipv4GlobalRouting::LookupGlobal (Ipv4Address dest, Ptr<NetDevice> oif)
     }
 }
 
+Ptr<Ipv4Route>
+Ipv4GlobalRouting::LookupFib (const Ipv4Header &header, Ptr<const Packet> p, Ptr<NetDevice> oif)
+{
+  NS_LOG_FUNCTION (this << header << p << oif);
+  Ipv4Address dest = header.GetDestination ();
+  // the random selections draw a number per packet, and the output
+  // device restricts the routes
+  bool cacheable = m_routeCacheSize > 0 && oif == 0
+    && !m_randomEcmpRouting && m_ecmpMode != ECMP_RANDOM;
+  if (cacheable)
+    {
+      std::unordered_map<uint32_t, Ipv4FibTrie::Entry *>::iterator cached = m_routeCache.find (dest.Get ());
+      if (cached != m_routeCache.end ())
+        {
+          NS_LOG_LOGIC ("Found cached route to " << dest);
+          return cached->second->m_cache;
+        }
+    }
+  // same selection as LookupGlobal, on the routes matching dest only
+  m_matches.clear ();
+  m_hostFib.Lookup (dest, m_matches);
+  FilterMatches (oif);
+  if (m_matches.size () == 0) // if no host route is found
+    {
+      m_networkFib.Lookup (dest, m_matches);
+      FilterMatches (oif);
+    }
+  if (m_matches.size () == 0) // consider external if no host/network found
+    {
+      m_ASexternalFib.Lookup (dest, m_matches);
+      FilterMatches (oif);
+      m_matches.resize (std::min<std::size_t> (m_matches.size (), 1));
+    }
+  if (m_matches.size () == 0)
+    {
+      return 0;
+    }
+  uint32_t selectIndex = SelectEcmpRoute (m_matches.size (), header, p);
+  Ipv4FibTrie::Entry *entry = m_matches[selectIndex];
+  if (entry->m_cache == 0)
+    {
+      Ipv4RoutingTableEntry* route = entry->m_route;
+      entry->m_cache = Create<Ipv4Route> ();
+      entry->m_cache->SetDestination (route->GetDest ());
+      entry->m_cache->SetSource (m_ipv4->GetAddress (route->GetInterface (), 0).GetLocal ());
+      entry->m_cache->SetGateway (route->GetGateway ());
+      entry->m_cache->SetOutputDevice (m_ipv4->GetNetDevice (route->GetInterface ()));
+    }
+  // the flow-based selections only depend on the packet with several routes
+  if (cacheable && (m_matches.size () == 1 || m_ecmpMode == ECMP_FIRST))
+    {
+      if (m_routeCache.size () >= m_routeCacheSize)
+        {
+          m_routeCache.clear ();
+        }
+      m_routeCache[dest.Get ()] = entry;
+    }
+  return entry->m_cache;
+}
+
+uint32_t
+Ipv4GlobalRouting::SelectEcmpRoute (uint32_t n, const Ipv4Header &header, Ptr<const Packet> p)
+{
+  // pick up one of the routes uniformly at random if random
+  // ECMP routing is enabled, or always select the first route
+  // consistently if ECMP routing is disabled
+  if (m_randomEcmpRouting || m_ecmpMode == ECMP_RANDOM)
+    {
+      return m_rand->GetInteger (0, n - 1);
+    }
+  if (n == 1)
+    {
+      return 0;
+    }
+  switch (m_ecmpMode)
+    {
+    case ECMP_FLOW:
+      return HashFlow (header, p) % n;
+    case ECMP_FLOWLET:
+      {
+        uint32_t flow = HashFlow (header, p);
+        uint32_t key[2] = { flow, GetFlowlet (flow) };
+        m_hasher.clear ();
+        return m_hasher.GetHash32 (reinterpret_cast<const char *> (key), sizeof (key)) % n;
+      }
+    default:
+      return 0;
+    }
+}
+
+uint32_t
+Ipv4GlobalRouting::HashFlow (const Ipv4Header &header, Ptr<const Packet> p)
+{
+  uint32_t key[5] = { m_ecmpHashSeed,
+                      header.GetSource ().Get (),
+                      header.GetDestination ().Get (),
+                      header.GetProtocol (),
+                      0 };
+  // for both TCP and UDP the ports are carried in the first 4 octets;
+  // the fragments are hashed without them, so that they stay in order
+  if ((header.GetProtocol () == 6 || header.GetProtocol () == 17)
+      && p != 0 && p->GetSize () >= 4
+      && header.IsLastFragment () && header.GetFragmentOffset () == 0)
+    {
+      uint8_t ports[4];
+      p->CopyData (ports, 4);
+      key[4] = (ports[0] << 24) | (ports[1] << 16) | (ports[2] << 8) | ports[3];
+    }
+  m_hasher.clear ();
+  return m_hasher.GetHash32 (reinterpret_cast<const char *> (key), sizeof (key));
+}
+
+uint32_t
+Ipv4GlobalRouting::GetFlowlet (uint32_t flow)
+{
+  Time now = Simulator::Now ();
+  if (m_flowlets.size () >= m_flowletPurgeSize)
+    {
+      // the idle flows would start a new flowlet anyway
+      for (auto it = m_flowlets.begin (); it != m_flowlets.end (); )
+        {
+          if (now - it->second.m_lastSeen > m_flowletTimeout)
+            {
+              it = m_flowlets.erase (it);
+            }
+          else
+            {
+              it++;
+            }
+        }
+      m_flowletPurgeSize = std::max<std::size_t> (1024, 2 * m_flowlets.size ());
+    }
+  std::pair<std::unordered_map<uint32_t, Flowlet>::iterator, bool> inserted =
+    m_flowlets.insert (std::make_pair (flow, Flowlet ()));
+  Flowlet &flowlet = inserted.first->second;
+  if (inserted.second || now - flowlet.m_lastSeen > m_flowletTimeout)
+    {
+      NS_LOG_LOGIC ("New flowlet " << m_nextFlowlet << " of flow " << flow);
+      flowlet.m_id = m_nextFlowlet++;
+    }
+  flowlet.m_lastSeen = now;
+  return flowlet.m_id;
+}
+
+void
+Ipv4GlobalRouting::FilterMatches (Ptr<NetDevice> oif)
+{
+  if (oif == 0)
+    {
+      return;
+    }
+  std::size_t kept = 0;
+  for (std::size_t i = 0; i < m_matches.size (); i++)
+    {
+      if (oif == m_ipv4->GetNetDevice (m_matches[i]->m_route->GetInterface ()))
+        {
+          m_matches[kept++] = m_matches[i];
+        }
+    }
+  m_matches.resize (kept);
+}
+
+void
+Ipv4GlobalRouting::InvalidateFibCache (void)
+{
+  // the source addresses of the cached routes may have changed
+  m_hostFib.InvalidateCache ();
+  m_networkFib.InvalidateCache ();
+  m_ASexternalFib.InvalidateCache ();
+  m_routeCache.clear ();
+}
+
 uint32_t 
 Ipv4GlobalRouting::GetNRoutes (void) const
 {
@@ -319,6 +531,8 @@ Ipv4GlobalRouting::RemoveRoute (uint32_t index)
           if (tmp  == index)
             {
               NS_LOG_LOGIC ("Removing route " << index << "; size = " << m_hostRoutes.size ());
+              m_hostFib.Remove (*i);
+              m_routeCache.clear ();
               delete *i;
               m_hostRoutes.erase (i);
               NS_LOG_LOGIC ("Done removing host route " << index << "; host route remaining size = " << m_hostRoutes.size ());
@@ -336,6 +550,8 @@ Ipv4GlobalRouting::RemoveRoute (uint32_t index)
       if (tmp == index)
         {
           NS_LOG_LOGIC ("Removing route " << index << "; size = " << m_networkRoutes.size ());
+          m_networkFib.Remove (*j);
+          m_routeCache.clear ();
           delete *j;
           m_networkRoutes.erase (j);
           NS_LOG_LOGIC ("Done removing network route " << index << "; network route remaining size = " << m_networkRoutes.size ());
@@ -352,6 +568,8 @@ Ipv4GlobalRouting::RemoveRoute (uint32_t index)
       if (tmp == index)
         {
           NS_LOG_LOGIC ("Removing route " << index << "; size = " << m_ASexternalRoutes.size ());
+          m_ASexternalFib.Remove (*k);
+          m_routeCache.clear ();
           delete *k;
           m_ASexternalRoutes.erase (k);
           NS_LOG_LOGIC ("Done removing network route " << index << "; network route remaining size = " << m_networkRoutes.size ());
@@ -392,6 +610,11 @@ Ipv4GlobalRouting::DoDispose (void)
     {
       delete (*l);
     }
+  m_hostFib.Clear ();
+  m_networkFib.Clear ();
+  m_ASexternalFib.Clear ();
+  m_routeCache.clear ();
+  m_flowlets.clear ();
 
   Ipv4RoutingProtocol::DoDispose ();
 }
@@ -475,7 +698,14 @@ Ipv4GlobalRouting::RouteOutput (Ptr<Packet> p, const Ipv4Header &header, Ptr<Net
 // See if this is a unicast packet we have a route for.
 //
   NS_LOG_LOGIC ("Unicast destination- looking up");
-  Ptr<Ipv4Route> rtentry = LookupGlobal (header.GetDestination (), oif);
+  // only TCP adds its header before looking up its routes
+  Ptr<const Packet> l4 = 0;
+  if (header.GetProtocol () == 6)
+    {
+      l4 = p;
+    }
+  Ptr<Ipv4Route> rtentry = m_useFib ? LookupFib (header, l4, oif)
+    : LookupGlobal (header, l4, oif);
   if (rtentry)
     {
       sockerr = Socket::ERROR_NOTERROR;
@@ -524,7 +754,8 @@ Ipv4GlobalRouting::RouteInput  (Ptr<const Packet> p, const Ipv4Header &header, P
     }
   // Next, try to find a route
   NS_LOG_LOGIC ("Unicast destination- looking up global route");
-  Ptr<Ipv4Route> rtentry = LookupGlobal (header.GetDestination ());
+  Ptr<Ipv4Route> rtentry = m_useFib ? LookupFib (header, p)
+    : LookupGlobal (header, p);
   if (rtentry != 0)
     {
       NS_LOG_LOGIC ("Found unicast destination- calling unicast callback");
@@ -542,6 +773,7 @@ void
 Ipv4GlobalRouting::NotifyInterfaceUp (uint32_t i)
 {
   NS_LOG_FUNCTION (this << i);
+  InvalidateFibCache ();
   if (m_respondToInterfaceEvents && Simulator::Now ().GetSeconds () > 0)  // avoid startup events
     {
       GlobalRouteManager::DeleteGlobalRoutes ();
@@ -554,6 +786,7 @@ void
 Ipv4GlobalRouting::NotifyInterfaceDown (uint32_t i)
 {
   NS_LOG_FUNCTION (this << i);
+  InvalidateFibCache ();
   if (m_respondToInterfaceEvents && Simulator::Now ().GetSeconds () > 0)  // avoid startup events
     {
       GlobalRouteManager::DeleteGlobalRoutes ();
@@ -566,6 +799,7 @@ void
 Ipv4GlobalRouting::NotifyAddAddress (uint32_t interface, Ipv4InterfaceAddress address)
 {
   NS_LOG_FUNCTION (this << interface << address);
+  InvalidateFibCache ();
   if (m_respondToInterfaceEvents && Simulator::Now ().GetSeconds () > 0)  // avoid startup events
     {
       GlobalRouteManager::DeleteGlobalRoutes ();
@@ -578,6 +812,7 @@ void
 Ipv4GlobalRouting::NotifyRemoveAddress (uint32_t interface, Ipv4InterfaceAddress address)
 {
   NS_LOG_FUNCTION (this << interface << address);
+  InvalidateFibCache ();
   if (m_respondToInterfaceEvents && Simulator::Now ().GetSeconds () > 0)  // avoid startup events
     {
       GlobalRouteManager::DeleteGlobalRoutes ();
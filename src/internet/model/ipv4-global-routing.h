@@ -22,12 +22,16 @@
 
 #include <list>
 #include <stdint.h>
+#include <unordered_map>
 #include "ns3/ipv4-address.h"
 #include "ns3/ipv4-header.h"
 #include "ns3/ptr.h"
 #include "ns3/ipv4.h"
 #include "ns3/ipv4-routing-protocol.h"
 #include "ns3/random-variable-stream.h"
+#include "ns3/hash.h"
+#include "ns3/nstime.h"
+#include "ns3/ipv4-fib-trie.h"
 
 namespace ns3 {
 
@@ -65,6 +69,19 @@ class Node;
  *
  * This class deals with Ipv4 unicast routes only.
  *
+ * When several routes of equal cost lead to a destination, the route is
+ * selected according to the EcmpMode attribute: always the first route,
+ * a random route per packet, a route per flow, selected by a hash of
+ * the addresses, protocol and ports of the packet, or a route per
+ * flowlet, i.e., per burst of packets of a flow separated by more than
+ * FlowletTimeout.  The hash of the flows is seeded by the EcmpHashSeed
+ * attribute, which should differ from switch to switch, so that the
+ * flows sent to a port by a switch are still spread over the ports of
+ * the next one.  The ports are only hashed for TCP and UDP packets which
+ * are not fragments; the routes of the locally generated UDP packets
+ * are looked up before their header is added, so that the ports of the
+ * UDP flows are only hashed by the routers forwarding them.
+ *
  * \see Ipv4RoutingProtocol
  * \see GlobalRouteManager
  */
@@ -87,6 +104,15 @@ public:
   Ipv4GlobalRouting ();
   virtual ~Ipv4GlobalRouting ();
 
+  /// Selection of a route among several equal-cost routes
+  enum EcmpMode
+  {
+    ECMP_FIRST,    //!< Always the first route
+    ECMP_RANDOM,   //!< A random route per packet
+    ECMP_FLOW,     //!< A route per flow, selected by a hash of the 5-tuple
+    ECMP_FLOWLET   //!< A route per flowlet, re-hashed after an idle time
+  };
+
   // These methods inherited from base class
   virtual Ptr<Ipv4Route> RouteOutput (Ptr<Packet> p, const Ipv4Header &header, Ptr<NetDevice> oif, Socket::SocketErrno &sockerr);
 
@@ -234,6 +260,12 @@ protected:
 private:
   /// Set to true if packets are randomly routed among ECMP; set to false for using only one route consistently
   bool m_randomEcmpRouting;
+  /// The selection of a route among ECMP, unless m_randomEcmpRouting is set
+  EcmpMode m_ecmpMode;
+  /// The seed of the hash of the flows
+  uint32_t m_ecmpHashSeed;
+  /// The idle time after which a flow starts a new flowlet
+  Time m_flowletTimeout;
   /// Set to true if this interface should respond to interface events by globallly recomputing routes 
   bool m_respondToInterfaceEvents;
   /// A uniform random number generator for randomly routing packets among ECMP 
@@ -260,18 +292,94 @@ private:
   /// iterator of container of Ipv4RoutingTableEntry (routes to external AS)
   typedef std::list<Ipv4RoutingTableEntry *>::iterator ASExternalRoutesI;
 
+  /// The state of a flow in flowlet mode
+  struct Flowlet
+  {
+    Time m_lastSeen; //!< the time of the last packet of the flow
+    uint32_t m_id;   //!< the identifier of the current flowlet
+  };
+
   /**
    * \brief Lookup in the forwarding table for destination.
-   * \param dest destination address
+   * \param header the IPv4 header of the packet
+   * \param p the packet, starting with its layer 4 header, or 0 if
+   * the ports of the flow must not be hashed
+   * \param oif output interface if any (put 0 otherwise)
+   * \return Ipv4Route to route the packet to reach dest address
+   */
+  Ptr<Ipv4Route> LookupGlobal (const Ipv4Header &header, Ptr<const Packet> p, Ptr<NetDevice> oif = 0);
+  /**
+   * \brief Lookup in the tries for destination.
+   *
+   * Same as LookupGlobal, which scans the route lists, except that the
+   * routes are found through the tries and the returned Ipv4Route is
+   * cached.
+   *
+   * \param header the IPv4 header of the packet
+   * \param p the packet, starting with its layer 4 header, or 0 if
+   * the ports of the flow must not be hashed
    * \param oif output interface if any (put 0 otherwise)
    * \return Ipv4Route to route the packet to reach dest address
    */
-  Ptr<Ipv4Route> LookupGlobal (Ipv4Address dest, Ptr<NetDevice> oif = 0);
+  Ptr<Ipv4Route> LookupFib (const Ipv4Header &header, Ptr<const Packet> p, Ptr<NetDevice> oif = 0);
+  /**
+   * \brief Select one of several equal-cost routes.
+   * \param n the number of routes
+   * \param header the IPv4 header of the packet
+   * \param p the packet, starting with its layer 4 header, or 0
+   * \return the index of the selected route
+   */
+  uint32_t SelectEcmpRoute (uint32_t n, const Ipv4Header &header, Ptr<const Packet> p);
+  /**
+   * \brief Hash the flow of a packet.
+   * \param header the IPv4 header of the packet
+   * \param p the packet, starting with its layer 4 header, or 0
+   * \return the hash of the addresses, protocol and, for the TCP and
+   * UDP packets which are not fragments, ports of the packet
+   */
+  uint32_t HashFlow (const Ipv4Header &header, Ptr<const Packet> p);
+  /**
+   * \brief Get the current flowlet of a flow, and start a new one if
+   * the flow was idle for more than m_flowletTimeout.
+   * \param flow the hash of the flow
+   * \return the identifier of the flowlet
+   */
+  uint32_t GetFlowlet (uint32_t flow);
+  /**
+   * \brief Remove from m_matches the routes which do not go through an
+   * output device.
+   * \param oif the output device, or 0 to keep all the routes
+   */
+  void FilterMatches (Ptr<NetDevice> oif);
+  /**
+   * \brief Drop the Ipv4Route objects cached by the tries, and the
+   * routes selected for the destinations.
+   */
+  void InvalidateFibCache (void);
 
   HostRoutes m_hostRoutes;             //!< Routes to hosts
   NetworkRoutes m_networkRoutes;       //!< Routes to networks
   ASExternalRoutes m_ASexternalRoutes; //!< External routes imported
 
+  /// Set to true to look up the routes in the tries rather than in the lists
+  bool m_useFib;
+  Ipv4FibTrie m_hostFib;               //!< Index of m_hostRoutes
+  Ipv4FibTrie m_networkFib;            //!< Index of m_networkRoutes
+  Ipv4FibTrie m_ASexternalFib;         //!< Index of m_ASexternalRoutes
+  std::vector<Ipv4FibTrie::Entry *> m_matches; //!< Routes matching the current lookup
+  /**
+   * The route selected for each destination, when the selection does not
+   * depend on the packet; cleared whenever the routes or the interfaces
+   * change, since the entries point into the tries.
+   */
+  std::unordered_map<uint32_t, Ipv4FibTrie::Entry *> m_routeCache;
+  uint32_t m_routeCacheSize;           //!< The maximum number of destinations in m_routeCache
+
+  Hasher m_hasher;                     //!< The hash function of the flows
+  std::unordered_map<uint32_t, Flowlet> m_flowlets; //!< The flowlets, by flow hash
+  std::size_t m_flowletPurgeSize;      //!< The number of flowlets above which idle ones are purged
+  uint32_t m_nextFlowlet;              //!< The identifier of the next flowlet
+
   Ptr<Ipv4> m_ipv4; //!< associated IPv4 instance
 };
 
@@ -32,6 +32,7 @@ class NetDevice;
 class Packet;
 class Node;
 class ArpCache;
+class ArpL3Protocol;
 class Ipv4InterfaceAddress;
 class Ipv4Address;
 class Ipv4Header;
@@ -239,6 +240,8 @@ private:
   Ptr<NetDevice> m_device; //!< The associated NetDevice
   Ptr<TrafficControlLayer> m_tc; //!< The associated TrafficControlLayer
   Ptr<ArpCache> m_cache; //!< ARP cache
+  Ptr<ArpL3Protocol> m_arp; //!< ARP protocol, if the device needs ARP
+  bool m_loopback; //!< True if the device is a loopback device
 };
 
 } // namespace ns3
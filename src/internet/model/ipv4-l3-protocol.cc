@@ -43,6 +43,9 @@
 #include "icmpv4-l4-protocol.h"
 #include "ipv4-interface.h"
 #include "ipv4-raw-socket-impl.h"
+#include "tcp-header.h"
+#include "tcp-l4-protocol.h"
+#include "gso-tag.h"
 
 namespace ns3 {
 
@@ -130,6 +133,10 @@ Ipv4L3Protocol::GetTypeId (void)
 }
 
 Ipv4L3Protocol::Ipv4L3Protocol()
+  : m_ucb (MakeCallback (&Ipv4L3Protocol::IpForward, this)),
+    m_mcb (MakeCallback (&Ipv4L3Protocol::IpMulticastForward, this)),
+    m_lcb (MakeCallback (&Ipv4L3Protocol::LocalDeliver, this)),
+    m_ecb (MakeCallback (&Ipv4L3Protocol::RouteInputError, this))
 {
   NS_LOG_FUNCTION (this);
 }
@@ -239,6 +246,8 @@ Ipv4L3Protocol::SetNode (Ptr<Node> node)
 {
   NS_LOG_FUNCTION (this << node);
   m_node = node;
+  m_node->RegisterSegmentationHandler (MakeCallback (&Ipv4L3Protocol::SegmentDatagram, this),
+                                       Ipv4L3Protocol::PROT_NUMBER);
   // Add a LoopbackNetDevice if needed, and an Ipv4Interface on top of it
   SetupLoopback ();
 }
@@ -585,14 +594,14 @@ Ipv4L3Protocol::Receive ( Ptr<NetDevice> device, Ptr<const Packet> p, uint16_t p
 
   if (ipv4Interface->IsUp ())
     {
-      m_rxTrace (packet, m_node->GetObject<Ipv4> (), interface);
+      m_rxTrace (packet, this, interface);
     }
   else
     {
       NS_LOG_LOGIC ("Dropping received packet -- interface is down");
       Ipv4Header ipHeader;
       packet->RemoveHeader (ipHeader);
-      m_dropTrace (ipHeader, packet, DROP_INTERFACE_DOWN, m_node->GetObject<Ipv4> (), interface);
+      m_dropTrace (ipHeader, packet, DROP_INTERFACE_DOWN, this, interface);
       return;
     }
 
@@ -612,7 +621,7 @@ Ipv4L3Protocol::Receive ( Ptr<NetDevice> device, Ptr<const Packet> p, uint16_t p
   if (!ipHeader.IsChecksumOk ()) 
     {
       NS_LOG_LOGIC ("Dropping received packet -- checksum not ok");
-      m_dropTrace (ipHeader, packet, DROP_BAD_CHECKSUM, m_node->GetObject<Ipv4> (), interface);
+      m_dropTrace (ipHeader, packet, DROP_BAD_CHECKSUM, this, interface);
       return;
     }
 
@@ -656,20 +665,15 @@ Ipv4L3Protocol::Receive ( Ptr<NetDevice> device, Ptr<const Packet> p, uint16_t p
   if (m_enableDpd && ipHeader.GetDestination ().IsMulticast () && UpdateDuplicate (packet, ipHeader))
     {
       NS_LOG_LOGIC ("Dropping received packet -- duplicate.");
-      m_dropTrace (ipHeader, packet, DROP_DUPLICATE, m_node->GetObject<Ipv4> (), interface);
+      m_dropTrace (ipHeader, packet, DROP_DUPLICATE, this, interface);
       return;
     }
 
   NS_ASSERT_MSG (m_routingProtocol != 0, "Need a routing protocol object to process packets");
-  if (!m_routingProtocol->RouteInput (packet, ipHeader, device,
-                                      MakeCallback (&Ipv4L3Protocol::IpForward, this),
-                                      MakeCallback (&Ipv4L3Protocol::IpMulticastForward, this),
-                                      MakeCallback (&Ipv4L3Protocol::LocalDeliver, this),
-                                      MakeCallback (&Ipv4L3Protocol::RouteInputError, this)
-                                      ))
+  if (!m_routingProtocol->RouteInput (packet, ipHeader, device, m_ucb, m_mcb, m_lcb, m_ecb))
     {
       NS_LOG_WARN ("No route found for forwarding packet.  Drop.");
-      m_dropTrace (ipHeader, packet, DROP_NO_ROUTE, m_node->GetObject<Ipv4> (), interface);
+      m_dropTrace (ipHeader, packet, DROP_NO_ROUTE, this, interface);
     }
 }
 
@@ -741,6 +745,10 @@ void
 Ipv4L3Protocol::CallTxTrace (const Ipv4Header & ipHeader, Ptr<Packet> packet,
                                     Ptr<Ipv4> ipv4, uint32_t interface)
 {
+  if (m_txTrace.IsEmpty ())
+    {
+      return;
+    }
   Ptr<Packet> packetCopy = packet->Copy ();
   packetCopy->AddHeader (ipHeader);
   m_txTrace (packetCopy, ipv4, interface);
@@ -803,6 +811,16 @@ Ipv4L3Protocol::Send (Ptr<Packet> packet,
       // 1b) with a valid gateway
       NS_LOG_LOGIC ("Ipv4L3Protocol::Send case 1b:  passed in with route and valid gateway");
       int32_t interface = GetInterfaceForDevice (route->GetOutputDevice ());
+      GsoTag gsoTag;
+      if (packet->GetSize () + ipHeader.GetSerializedSize () > route->GetOutputDevice ()->GetMtu ()
+          && packet->PeekPacketTag (gsoTag))
+        {
+          // reserve an identification for each segment of a super-segment
+          for (uint16_t i = 1; i < gsoTag.GetSegments (); i++)
+            {
+              BuildHeader (source, destination, protocol, 0, ttl, tos, mayFragment);
+            }
+        }
       m_sendOutgoingTrace (ipHeader, packet, interface);
       SendRealOut (route, packet->Copy (), ipHeader);
       return; 
@@ -891,7 +909,7 @@ Ipv4L3Protocol::Send (Ptr<Packet> packet,
   else
     {
       NS_LOG_WARN ("No route to host.  Drop.");
-      m_dropTrace (ipHeader, packet, DROP_NO_ROUTE, m_node->GetObject<Ipv4> (), 0);
+      m_dropTrace (ipHeader, packet, DROP_NO_ROUTE, this, 0);
       DecreaseIdentification (source, destination, protocol);
     }
 }
@@ -964,7 +982,7 @@ Ipv4L3Protocol::SendRealOut (Ptr<Ipv4Route> route,
   if (route == 0)
     {
       NS_LOG_WARN ("No route to host.  Drop.");
-      m_dropTrace (ipHeader, packet, DROP_NO_ROUTE, m_node->GetObject<Ipv4> (), 0);
+      m_dropTrace (ipHeader, packet, DROP_NO_ROUTE, this, 0);
       return;
     }
   Ptr<NetDevice> outDev = route->GetOutputDevice ();
@@ -989,22 +1007,62 @@ Ipv4L3Protocol::SendRealOut (Ptr<Ipv4Route> route,
   if (outInterface->IsUp ())
     {
       NS_LOG_LOGIC ("Send to " << targetLabel << " " << target);
-      if ( packet->GetSize () + ipHeader.GetSerializedSize () > outInterface->GetDevice ()->GetMtu () )
+      GsoTag gsoTag;
+      if (packet->GetSize () + ipHeader.GetSerializedSize () <= outDev->GetMtu ())
+        {
+          CallTxTrace (ipHeader, packet, this, interface);
+          outInterface->Send (packet, ipHeader, target);
+        }
+      else if (packet->PeekPacketTag (gsoTag))
+        {
+          // a super-segment: the devices with a Gso attribute set split it
+          // right before its transmission, segment it here for the others
+          // or when its segments do not fit the MTU
+          TcpHeader tcpHeader;
+          packet->PeekHeader (tcpHeader);
+          bool segmentsFit = ipHeader.GetSerializedSize () + tcpHeader.GetSerializedSize ()
+            + gsoTag.GetSegmentSize () <= outDev->GetMtu ();
+          BooleanValue deviceGso (false);
+          outDev->GetAttributeFailSafe ("Gso", deviceGso);
+          if (segmentsFit && deviceGso.Get ())
+            {
+              NS_LOG_LOGIC ("Super-segment left to the device");
+              CallTxTrace (ipHeader, packet, this, interface);
+              outInterface->Send (packet, ipHeader, target);
+              return;
+            }
+          std::list<Ipv4PayloadHeaderPair> listSegments;
+          DoSegmentation (packet, ipHeader, gsoTag.GetSegmentSize (), listSegments);
+          for (std::list<Ipv4PayloadHeaderPair>::iterator it = listSegments.begin (); it != listSegments.end (); it++)
+            {
+              std::list<Ipv4PayloadHeaderPair> listFragments;
+              if (it->first->GetSize () + it->second.GetSerializedSize () <= outDev->GetMtu ())
+                {
+                  listFragments.push_back (*it);
+                }
+              else
+                {
+                  DoFragmentation (it->first, it->second, outDev->GetMtu (), listFragments);
+                }
+              for (std::list<Ipv4PayloadHeaderPair>::iterator f = listFragments.begin (); f != listFragments.end (); f++)
+                {
+                  NS_LOG_LOGIC ("Sending segment " << *(f->first));
+                  CallTxTrace (f->second, f->first, this, interface);
+                  outInterface->Send (f->first, f->second, target);
+                }
+            }
+        }
+      else
         {
           std::list<Ipv4PayloadHeaderPair> listFragments;
           DoFragmentation (packet, ipHeader, outInterface->GetDevice ()->GetMtu (), listFragments);
           for ( std::list<Ipv4PayloadHeaderPair>::iterator it = listFragments.begin (); it != listFragments.end (); it++ )
             {
               NS_LOG_LOGIC ("Sending fragment " << *(it->first) );
-              CallTxTrace (it->second, it->first, m_node->GetObject<Ipv4> (), interface);
+              CallTxTrace (it->second, it->first, this, interface);
               outInterface->Send (it->first, it->second, target);
             }
         }
-      else
-        {
-          CallTxTrace (ipHeader, packet, m_node->GetObject<Ipv4> (), interface);
-          outInterface->Send (packet, ipHeader, target);
-        }
     }
 }
 
@@ -1029,7 +1087,7 @@ Ipv4L3Protocol::IpMulticastForward (Ptr<Ipv4MulticastRoute> mrtentry, Ptr<const
       if (ipHeader.GetTtl () == 0)
         {
           NS_LOG_WARN ("TTL exceeded.  Drop.");
-          m_dropTrace (header, packet, DROP_TTL_EXPIRED, m_node->GetObject<Ipv4> (), interface);
+          m_dropTrace (header, packet, DROP_TTL_EXPIRED, this, interface);
           return;
         }
       NS_LOG_LOGIC ("Forward multicast via interface " << interface);
@@ -1066,7 +1124,7 @@ Ipv4L3Protocol::IpForward (Ptr<Ipv4Route> rtentry, Ptr<const Packet> p, const Ip
           icmp->SendTimeExceededTtl (ipHeader, packet, false);
         }
       NS_LOG_WARN ("TTL exceeded.  Drop.");
-      m_dropTrace (header, packet, DROP_TTL_EXPIRED, m_node->GetObject<Ipv4> (), interface);
+      m_dropTrace (header, packet, DROP_TTL_EXPIRED, this, interface);
       return;
     }
   // in case the packet still has a priority tag attached, remove it
@@ -1427,11 +1485,86 @@ Ipv4L3Protocol::RouteInputError (Ptr<const Packet> p, const Ipv4Header & ipHeade
 {
   NS_LOG_FUNCTION (this << p << ipHeader << sockErrno);
   NS_LOG_LOGIC ("Route input failure-- dropping packet to " << ipHeader << " with errno " << sockErrno); 
-  m_dropTrace (ipHeader, p, DROP_ROUTE_ERROR, m_node->GetObject<Ipv4> (), 0);
+  m_dropTrace (ipHeader, p, DROP_ROUTE_ERROR, this, 0);
 
   // \todo Send an ICMP no route.
 }
 
+void
+Ipv4L3Protocol::DoSegmentation (Ptr<const Packet> packet, const Ipv4Header& ipv4Header, uint16_t segmentSize,
+                                std::list<Ipv4PayloadHeaderPair>& listSegments)
+{
+  NS_LOG_FUNCTION (this << *packet << segmentSize);
+  NS_ASSERT (ipv4Header.GetProtocol () == TcpL4Protocol::PROT_NUMBER && segmentSize > 0);
+
+  Ptr<Packet> payload = packet->Copy ();
+  GsoTag gsoTag;
+  payload->RemovePacketTag (gsoTag);
+  TcpHeader tcpHeader;
+  payload->RemoveHeader (tcpHeader);
+  uint32_t size = payload->GetSize ();
+  uint16_t identification = ipv4Header.GetIdentification ();
+  for (uint32_t offset = 0; offset < size; offset += segmentSize)
+    {
+      uint32_t segmentPayload = std::min<uint32_t> (segmentSize, size - offset);
+      Ptr<Packet> segment = payload->CreateFragment (offset, segmentPayload);
+      TcpHeader header = tcpHeader;
+      header.SetSequenceNumber (tcpHeader.GetSequenceNumber () + offset);
+      // CWR on the first segment only, FIN and PSH on the last one only
+      uint8_t flags = tcpHeader.GetFlags ();
+      if (offset > 0)
+        {
+          flags &= ~TcpHeader::CWR;
+        }
+      if (offset + segmentPayload < size)
+        {
+          flags &= ~(TcpHeader::FIN | TcpHeader::PSH);
+        }
+      header.SetFlags (flags);
+      if (Node::ChecksumEnabled ())
+        {
+          header.EnableChecksums ();
+        }
+      header.InitializeChecksum (ipv4Header.GetSource (), ipv4Header.GetDestination (), TcpL4Protocol::PROT_NUMBER);
+      segment->AddHeader (header);
+
+      Ipv4Header segmentHeader = ipv4Header;
+      segmentHeader.SetIdentification (identification++);
+      segmentHeader.SetPayloadSize (segment->GetSize ());
+      if (Node::ChecksumEnabled ())
+        {
+          segmentHeader.EnableChecksum ();
+        }
+      listSegments.push_back (Ipv4PayloadHeaderPair (segment, segmentHeader));
+    }
+}
+
+bool
+Ipv4L3Protocol::SegmentDatagram (Ptr<const Packet> p, std::list<Ptr<Packet> > &segments)
+{
+  NS_LOG_FUNCTION (this << p);
+  GsoTag gsoTag;
+  if (!p->PeekPacketTag (gsoTag))
+    {
+      return false;
+    }
+  Ptr<Packet> packet = p->Copy ();
+  Ipv4Header ipHeader;
+  packet->RemoveHeader (ipHeader);
+  if (ipHeader.GetProtocol () != TcpL4Protocol::PROT_NUMBER)
+    {
+      return false;
+    }
+  std::list<Ipv4PayloadHeaderPair> listSegments;
+  DoSegmentation (packet, ipHeader, gsoTag.GetSegmentSize (), listSegments);
+  for (std::list<Ipv4PayloadHeaderPair>::iterator it = listSegments.begin (); it != listSegments.end (); it++)
+    {
+      it->first->AddHeader (it->second);
+      segments.push_back (it->first);
+    }
+  return true;
+}
+
 void
 Ipv4L3Protocol::DoFragmentation (Ptr<Packet> packet, const Ipv4Header & ipv4Header, uint32_t outIfaceMtu, std::list<Ipv4PayloadHeaderPair>& listFragments)
 {
@@ -1727,7 +1860,7 @@ Ipv4L3Protocol::HandleFragmentsTimeout (FragmentKey_t key, Ipv4Header & ipHeader
       Ptr<Icmpv4L4Protocol> icmp = GetIcmp ();
       icmp->SendTimeExceededTtl (ipHeader, packet, true);
     }
-  m_dropTrace (ipHeader, packet, DROP_FRAGMENT_TIMEOUT, m_node->GetObject<Ipv4> (), iif);
+  m_dropTrace (ipHeader, packet, DROP_FRAGMENT_TIMEOUT, this, iif);
 
   // clear the buffers
   it->second = 0;
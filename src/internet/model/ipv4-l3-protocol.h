@@ -416,6 +416,32 @@ private:
    */
   void DoFragmentation (Ptr<Packet> packet, const Ipv4Header& ipv4Header, uint32_t outIfaceMtu, std::list<Ipv4PayloadHeaderPair>& listFragments);
 
+  /**
+   * \brief Split a TCP super-segment into wire segments
+   *
+   * Each segment gets a copy of the TCP header with its own sequence
+   * number and checksum, and of the IP header with its own identification
+   * and payload size, as in Linux tcp_gso_segment.
+   *
+   * \param packet the super-segment, starting with its TCP header
+   * \param ipv4Header the IPv4 header of the super-segment
+   * \param segmentSize the size of the payload of the segments
+   * \param listSegments the list of segments
+   */
+  void DoSegmentation (Ptr<const Packet> packet, const Ipv4Header& ipv4Header, uint16_t segmentSize,
+                       std::list<Ipv4PayloadHeaderPair>& listSegments);
+
+  /**
+   * \brief Split a super-segment right before its transmission by a device
+   *
+   * This is the segmentation handler registered to the node for IPv4.
+   *
+   * \param p the super-segment, starting with its IPv4 header
+   * \param segments the list to which the segments are appended
+   * \return true if the packet was a super-segment
+   */
+  bool SegmentDatagram (Ptr<const Packet> p, std::list<Ptr<Packet> > &segments);
+
   /**
    * \brief Process a packet fragment
    * \param packet the packet
@@ -432,8 +458,7 @@ private:
    * \param ipv4 the Ipv4 protocol
    * \param interface the interface index
    *
-   * Note: If the TracedCallback API ever is extended, we could consider
-   * to check for connected functions before adding the header
+   * Nothing is copied if no function is connected to the TX trace.
    */
   void CallTxTrace (const Ipv4Header & ipHeader, Ptr<Packet> packet, Ptr<Ipv4> ipv4, uint32_t interface);
 
@@ -469,6 +494,12 @@ private:
   std::map<std::pair<uint64_t, uint8_t>, uint16_t> m_identification; //!< Identification (for each {src, dst, proto} tuple)
   Ptr<Node> m_node; //!< Node attached to stack.
 
+  // the callbacks passed to RouteInput, built once rather than per packet
+  Ipv4RoutingProtocol::UnicastForwardCallback m_ucb;   //!< Unicast forward callback
+  Ipv4RoutingProtocol::MulticastForwardCallback m_mcb; //!< Multicast forward callback
+  Ipv4RoutingProtocol::LocalDeliverCallback m_lcb;     //!< Local deliver callback
+  Ipv4RoutingProtocol::ErrorCallback m_ecb;            //!< Route input error callback
+
   /// Trace of sent packets
   TracedCallback<const Ipv4Header &, Ptr<const Packet>, uint32_t> m_sendOutgoingTrace;
   /// Trace of unicast forwarded packets
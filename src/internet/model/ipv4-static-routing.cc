@@ -25,6 +25,7 @@
 
 #include <iomanip>
 #include "ns3/log.h"
+#include "ns3/boolean.h"
 #include "ns3/names.h"
 #include "ns3/packet.h"
 #include "ns3/node.h"
@@ -49,12 +50,19 @@ Ipv4StaticRouting::GetTypeId (void)
     .SetParent<Ipv4RoutingProtocol> ()
     .SetGroupName ("Internet")
     .AddConstructor<Ipv4StaticRouting> ()
+    .AddAttribute ("UseFib",
+                   "Set to true to look up the routes in a trie indexed by destination prefix, "
+                   "and to reuse the Ipv4Route objects; set to false to scan the route list",
+                   BooleanValue (true),
+                   MakeBooleanAccessor (&Ipv4StaticRouting::m_useFib),
+                   MakeBooleanChecker ())
   ;
   return tid;
 }
 
 Ipv4StaticRouting::Ipv4StaticRouting () 
-  : m_ipv4 (0)
+  : m_ipv4 (0),
+    m_useFib (true)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -77,6 +85,7 @@ Ipv4StaticRouting::AddNetworkRouteTo (Ipv4Address network,
     {
       Ipv4RoutingTableEntry *routePtr = new Ipv4RoutingTableEntry (route);
       m_networkRoutes.push_back (make_pair (routePtr, metric));
+      m_fib.Add (routePtr, metric);
     }
 }
 
@@ -96,6 +105,7 @@ Ipv4StaticRouting::AddNetworkRouteTo (Ipv4Address network,
       Ipv4RoutingTableEntry *routePtr = new Ipv4RoutingTableEntry (route);
 
       m_networkRoutes.push_back (make_pair (routePtr, metric));
+      m_fib.Add (routePtr, metric);
     }
 }
 
@@ -154,6 +164,7 @@ Ipv4StaticRouting::SetDefaultMulticastRoute (uint32_t outputInterface)
                                                         networkMask,
                                                         outputInterface);
   m_networkRoutes.push_back (make_pair (route,0));
+  m_fib.Add (route, 0);
 }
 
 uint32_t 
@@ -232,6 +243,23 @@ Ipv4StaticRouting::RemoveMulticastRoute (uint32_t index)
 bool
 Ipv4StaticRouting::LookupRoute (const Ipv4RoutingTableEntry &route, uint32_t metric)
 {
+  if (m_useFib)
+    {
+      m_matches.clear ();
+      m_fib.LookupPrefix (route.GetDestNetwork (), route.GetDestNetworkMask (), m_matches);
+      for (std::vector<Ipv4FibTrie::Entry *>::const_iterator j = m_matches.begin (); j != m_matches.end (); j++)
+        {
+          Ipv4RoutingTableEntry* rtentry = (*j)->m_route;
+          if (rtentry->GetDest () == route.GetDest () &&
+              rtentry->GetGateway () == route.GetGateway () &&
+              rtentry->GetInterface () == route.GetInterface () &&
+              (*j)->m_metric == metric)
+            {
+              return true;
+            }
+        }
+      return false;
+    }
   for (NetworkRoutesI j = m_networkRoutes.begin (); j != m_networkRoutes.end (); j++)
     {
       Ipv4RoutingTableEntry* rtentry = j->first;
@@ -268,6 +296,10 @@ Ipv4StaticRouting::LookupStatic (Ipv4Address dest, Ptr<NetDevice> oif)
       return rtentry;
     }
 
+  if (m_useFib)
+    {
+      return LookupFib (dest, oif);
+    }
 
   for (NetworkRoutesI i = m_networkRoutes.begin (); 
        i != m_networkRoutes.end (); 
@@ -330,6 +362,66 @@ Ipv4StaticRouting::LookupStatic (Ipv4Address dest, Ptr<NetDevice> oif)
   return rtentry;
 }
 
+Ptr<Ipv4Route>
+Ipv4StaticRouting::LookupFib (Ipv4Address dest, Ptr<NetDevice> oif)
+{
+  NS_LOG_FUNCTION (this << dest << " " << oif);
+  // the same selection as the scan of m_networkRoutes, restricted to the
+  // routes matching dest, which the trie returns in the order of the list
+  uint16_t longest_mask = 0;
+  uint32_t shortest_metric = 0xffffffff;
+  Ipv4FibTrie::Entry *best = 0;
+  m_matches.clear ();
+  m_fib.Lookup (dest, m_matches);
+  for (std::vector<Ipv4FibTrie::Entry *>::const_iterator i = m_matches.begin (); i != m_matches.end (); i++)
+    {
+      Ipv4RoutingTableEntry *j = (*i)->m_route;
+      uint32_t metric = (*i)->m_metric;
+      uint16_t masklen = j->GetDestNetworkMask ().GetPrefixLength ();
+      if (oif != 0 && oif != m_ipv4->GetNetDevice (j->GetInterface ()))
+        {
+          NS_LOG_LOGIC ("Not on requested interface, skipping");
+          continue;
+        }
+      if (masklen < longest_mask) // Not interested if got shorter mask
+        {
+          continue;
+        }
+      if (masklen > longest_mask) // Reset metric if longer masklen
+        {
+          shortest_metric = 0xffffffff;
+        }
+      longest_mask = masklen;
+      if (metric > shortest_metric)
+        {
+          continue;
+        }
+      shortest_metric = metric;
+      best = *i;
+      if (masklen == 32)
+        {
+          break;
+        }
+    }
+  if (best == 0)
+    {
+      NS_LOG_LOGIC ("Matching route not found");
+      return 0;
+    }
+  if (best->m_cache == 0)
+    {
+      Ipv4RoutingTableEntry* route = best->m_route;
+      uint32_t interfaceIdx = route->GetInterface ();
+      best->m_cache = Create<Ipv4Route> ();
+      best->m_cache->SetDestination (route->GetDest ());
+      best->m_cache->SetSource (m_ipv4->SourceAddressSelection (interfaceIdx, route->GetDest ()));
+      best->m_cache->SetGateway (route->GetGateway ());
+      best->m_cache->SetOutputDevice (m_ipv4->GetNetDevice (interfaceIdx));
+    }
+  NS_LOG_LOGIC ("Matching route via " << best->m_cache->GetGateway () << " at the end");
+  return best->m_cache;
+}
+
 Ptr<Ipv4MulticastRoute>
 Ipv4StaticRouting::LookupStatic (
   Ipv4Address origin, 
@@ -476,6 +568,7 @@ Ipv4StaticRouting::RemoveRoute (uint32_t index)
     {
       if (tmp == index)
         {
+          m_fib.Remove (j->first);
           delete j->first;
           m_networkRoutes.erase (j);
           return;
@@ -604,6 +697,7 @@ Ipv4StaticRouting::DoDispose (void)
     {
       delete (j->first);
     }
+  m_fib.Clear ();
   for (MulticastRoutesI i = m_multicastRoutes.begin (); 
        i != m_multicastRoutes.end (); 
        i = m_multicastRoutes.erase (i)) 
@@ -618,6 +712,8 @@ void
 Ipv4StaticRouting::NotifyInterfaceUp (uint32_t i)
 {
   NS_LOG_FUNCTION (this << i);
+  // the source addresses of the cached routes may change
+  m_fib.InvalidateCache ();
   // If interface address and network mask have been set, add a route
   // to the network of the interface (like e.g. ifconfig does on a
   // Linux box)
@@ -637,11 +733,14 @@ void
 Ipv4StaticRouting::NotifyInterfaceDown (uint32_t i)
 {
   NS_LOG_FUNCTION (this << i);
+  // the source addresses of the cached routes may change
+  m_fib.InvalidateCache ();
   // Remove all static routes that are going through this interface
   for (NetworkRoutesI it = m_networkRoutes.begin (); it != m_networkRoutes.end (); )
     {
       if (it->first->GetInterface () == i)
         {
+          m_fib.Remove (it->first);
           delete it->first;
           it = m_networkRoutes.erase (it);
         }
@@ -656,6 +755,8 @@ void
 Ipv4StaticRouting::NotifyAddAddress (uint32_t interface, Ipv4InterfaceAddress address)
 {
   NS_LOG_FUNCTION (this << interface << " " << address.GetLocal ());
+  // the source addresses of the cached routes may change
+  m_fib.InvalidateCache ();
   if (!m_ipv4->IsUp (interface))
     {
       return;
@@ -674,6 +775,8 @@ void
 Ipv4StaticRouting::NotifyRemoveAddress (uint32_t interface, Ipv4InterfaceAddress address)
 {
   NS_LOG_FUNCTION (this << interface << " " << address.GetLocal ());
+  // the source addresses of the cached routes may change
+  m_fib.InvalidateCache ();
   if (!m_ipv4->IsUp (interface))
     {
       return;
@@ -689,6 +792,7 @@ Ipv4StaticRouting::NotifyRemoveAddress (uint32_t interface, Ipv4InterfaceAddress
           && it->first->GetDestNetwork () == networkAddress
           && it->first->GetDestNetworkMask () == networkMask)
         {
+          m_fib.Remove (it->first);
           delete it->first;
           it = m_networkRoutes.erase (it);
         }
@@ -31,6 +31,7 @@
 #include "ns3/ptr.h"
 #include "ns3/ipv4.h"
 #include "ns3/ipv4-routing-protocol.h"
+#include "ns3/ipv4-fib-trie.h"
 
 namespace ns3 {
 
@@ -391,6 +392,17 @@ private:
    * \return Ipv4Route to route the packet to reach dest address
    */
   Ptr<Ipv4Route> LookupStatic (Ipv4Address dest, Ptr<NetDevice> oif = 0);
+  /**
+   * \brief Lookup in the trie for destination.
+   *
+   * Same selection as LookupStatic, on the routes of the trie which
+   * match the destination; the returned Ipv4Route is cached.
+   *
+   * \param dest destination address
+   * \param oif output interface if any (put 0 otherwise)
+   * \return Ipv4Route to route the packet to reach dest address
+   */
+  Ptr<Ipv4Route> LookupFib (Ipv4Address dest, Ptr<NetDevice> oif);
 
   /**
    * \brief Lookup in the multicast forwarding table for destination.
@@ -416,6 +428,22 @@ private:
    * \brief Ipv4 reference.
    */
   Ptr<Ipv4> m_ipv4;
+
+  /**
+   * \brief Set to true to look up the routes in the trie rather than
+   * in the list.
+   */
+  bool m_useFib;
+
+  /**
+   * \brief Index of m_networkRoutes by destination prefix.
+   */
+  Ipv4FibTrie m_fib;
+
+  /**
+   * \brief Routes matching the current lookup.
+   */
+  std::vector<Ipv4FibTrie::Entry *> m_matches;
 };
 
 } // Namespace ns3
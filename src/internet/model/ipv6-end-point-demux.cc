@@ -21,6 +21,7 @@
 #include "ipv6-end-point-demux.h"
 #include "ipv6-end-point.h"
 #include "ns3/log.h"
+#include <algorithm>
 
 namespace ns3 {
 
@@ -40,22 +41,20 @@ Ipv6EndPointDemux::~Ipv6EndPointDemux ()
   for (EndPointsI i = m_endPoints.begin (); i != m_endPoints.end (); i++)
     {
       Ipv6EndPoint *endPoint = *i;
+      endPoint->m_demux = 0;
       delete endPoint;
     }
   m_endPoints.clear ();
+  m_positions.clear ();
+  m_connected.clear ();
+  m_wildcards.clear ();
+  m_ports.clear ();
 }
 
 bool Ipv6EndPointDemux::LookupPortLocal (uint16_t port)
 {
   NS_LOG_FUNCTION (this << port);
-  for (EndPointsI i = m_endPoints.begin (); i != m_endPoints.end (); i++)
-    {
-      if ((*i)->GetLocalPort  () == port)
-        {
-          return true;
-        }
-    }
-  return false;
+  return m_ports.find (port) != m_ports.end ();
 }
 
 bool Ipv6EndPointDemux::LookupLocal (Ptr<NetDevice> boundNetDevice, Ipv6Address addr, uint16_t port)
@@ -83,7 +82,7 @@ Ipv6EndPoint* Ipv6EndPointDemux::Allocate ()
       return 0;
     }
   Ipv6EndPoint *endPoint = new Ipv6EndPoint (Ipv6Address::GetAny (), port);
-  m_endPoints.push_back (endPoint);
+  Insert (endPoint);
   NS_LOG_DEBUG ("Now have >>" << m_endPoints.size () << "<< endpoints.");
   return endPoint;
 }
@@ -98,7 +97,7 @@ Ipv6EndPoint* Ipv6EndPointDemux::Allocate (Ipv6Address address)
       return 0;
     }
   Ipv6EndPoint *endPoint = new Ipv6EndPoint (address, port);
-  m_endPoints.push_back (endPoint);
+  Insert (endPoint);
   NS_LOG_DEBUG ("Now have >>" << m_endPoints.size () << "<< endpoints.");
   return endPoint;
 }
@@ -119,7 +118,7 @@ Ipv6EndPoint* Ipv6EndPointDemux::Allocate (Ptr<NetDevice> boundNetDevice, Ipv6Ad
       return 0;
     }
   Ipv6EndPoint *endPoint = new Ipv6EndPoint (address, port);
-  m_endPoints.push_back (endPoint);
+  Insert (endPoint);
   NS_LOG_DEBUG ("Now have >>" << m_endPoints.size () << "<< endpoints.");
   return endPoint;
 }
@@ -129,7 +128,16 @@ Ipv6EndPoint* Ipv6EndPointDemux::Allocate (Ptr<NetDevice> boundNetDevice,
                                            Ipv6Address peerAddress, uint16_t peerPort)
 {
   NS_LOG_FUNCTION (this << boundNetDevice << localAddress << localPort << peerAddress << peerPort);
-  for (EndPointsI i = m_endPoints.begin (); i != m_endPoints.end (); i++)
+  // the end points with this four-tuple are either connected or wildcards
+  Key key = { localAddress, peerAddress, localPort, peerPort };
+  std::vector<Ipv6EndPoint *> endPoints;
+  FindConnected (key, endPoints);
+  std::unordered_map<uint16_t, std::vector<Ipv6EndPoint *> >::iterator wildcards = m_wildcards.find (localPort);
+  if (wildcards != m_wildcards.end ())
+    {
+      endPoints.insert (endPoints.end (), wildcards->second.begin (), wildcards->second.end ());
+    }
+  for (std::vector<Ipv6EndPoint *>::iterator i = endPoints.begin (); i != endPoints.end (); i++)
     {
       if ((*i)->GetLocalPort () == localPort &&
           (*i)->GetLocalAddress () == localAddress &&
@@ -143,7 +151,7 @@ Ipv6EndPoint* Ipv6EndPointDemux::Allocate (Ptr<NetDevice> boundNetDevice,
     }
   Ipv6EndPoint *endPoint = new Ipv6EndPoint (localAddress, localPort);
   endPoint->SetPeer (peerAddress, peerPort);
-  m_endPoints.push_back (endPoint);
+  Insert (endPoint);
 
   NS_LOG_DEBUG ("Now have >>" << m_endPoints.size () << "<< endpoints.");
 
@@ -153,14 +161,14 @@ Ipv6EndPoint* Ipv6EndPointDemux::Allocate (Ptr<NetDevice> boundNetDevice,
 void Ipv6EndPointDemux::DeAllocate (Ipv6EndPoint *endPoint)
 {
   NS_LOG_FUNCTION (this);
-  for (EndPointsI i = m_endPoints.begin (); i != m_endPoints.end (); i++)
+  std::unordered_map<Ipv6EndPoint *, EndPointsI>::iterator position = m_positions.find (endPoint);
+  if (position != m_positions.end ())
     {
-      if (*i == endPoint)
-        {
-          delete endPoint;
-          m_endPoints.erase (i);
-          break;
-        }
+      Unindex (endPoint);
+      m_endPoints.erase (position->second);
+      m_positions.erase (position);
+      endPoint->m_demux = 0;
+      delete endPoint;
     }
 }
 
@@ -181,7 +189,19 @@ Ipv6EndPointDemux::EndPoints Ipv6EndPointDemux::Lookup (Ipv6Address daddr, uint1
   EndPoints retval4; /* Exact match on all 4 */
 
   NS_LOG_DEBUG ("Looking up endpoint for destination address " << daddr);
-  for (EndPointsI i = m_endPoints.begin (); i != m_endPoints.end (); i++)
+
+  // The connected end points can only match the four-tuple of the packet;
+  // the other end points are looked up by local port.
+  std::vector<Ipv6EndPoint *> candidates;
+  Key key = { daddr, saddr, dport, sport };
+  FindConnected (key, candidates);
+  std::unordered_map<uint16_t, std::vector<Ipv6EndPoint *> >::iterator wildcards = m_wildcards.find (dport);
+  if (wildcards != m_wildcards.end ())
+    {
+      candidates.insert (candidates.end (), wildcards->second.begin (), wildcards->second.end ());
+    }
+
+  for (std::vector<Ipv6EndPoint *>::iterator i = candidates.begin (); i != candidates.end (); i++)
     {
       Ipv6EndPoint* endP = *i;
 
@@ -355,5 +375,93 @@ Ipv6EndPointDemux::EndPoints Ipv6EndPointDemux::GetEndPoints () const
   return m_endPoints;
 }
 
+void Ipv6EndPointDemux::Insert (Ipv6EndPoint *endPoint)
+{
+  NS_LOG_FUNCTION (this << endPoint);
+  m_endPoints.push_back (endPoint);
+  m_positions[endPoint] = --m_endPoints.end ();
+  endPoint->m_demux = this;
+  Index (endPoint);
+}
+
+void Ipv6EndPointDemux::Index (Ipv6EndPoint *endPoint)
+{
+  NS_LOG_FUNCTION (this << endPoint);
+  m_ports[endPoint->GetLocalPort ()]++;
+  if (IsConnected (endPoint))
+    {
+      Key key = { endPoint->GetLocalAddress (), endPoint->GetPeerAddress (),
+                  endPoint->GetLocalPort (), endPoint->GetPeerPort () };
+      m_connected[key].push_back (endPoint);
+    }
+  else
+    {
+      m_wildcards[endPoint->GetLocalPort ()].push_back (endPoint);
+    }
+}
+
+void Ipv6EndPointDemux::Unindex (Ipv6EndPoint *endPoint)
+{
+  NS_LOG_FUNCTION (this << endPoint);
+  std::unordered_map<uint16_t, uint32_t>::iterator port = m_ports.find (endPoint->GetLocalPort ());
+  NS_ASSERT (port != m_ports.end ());
+  if (--port->second == 0)
+    {
+      m_ports.erase (port);
+    }
+  if (IsConnected (endPoint))
+    {
+      Key key = { endPoint->GetLocalAddress (), endPoint->GetPeerAddress (),
+                  endPoint->GetLocalPort (), endPoint->GetPeerPort () };
+      std::unordered_map<Key, std::vector<Ipv6EndPoint *>, KeyHash>::iterator connected = m_connected.find (key);
+      NS_ASSERT (connected != m_connected.end ());
+      connected->second.erase (std::find (connected->second.begin (), connected->second.end (), endPoint));
+      if (connected->second.empty ())
+        {
+          m_connected.erase (connected);
+        }
+    }
+  else
+    {
+      std::unordered_map<uint16_t, std::vector<Ipv6EndPoint *> >::iterator wildcards =
+        m_wildcards.find (endPoint->GetLocalPort ());
+      NS_ASSERT (wildcards != m_wildcards.end ());
+      wildcards->second.erase (std::find (wildcards->second.begin (), wildcards->second.end (), endPoint));
+      if (wildcards->second.empty ())
+        {
+          m_wildcards.erase (wildcards);
+        }
+    }
+}
+
+bool Ipv6EndPointDemux::IsConnected (Ipv6EndPoint *endPoint)
+{
+  return endPoint->GetLocalAddress () != Ipv6Address::GetAny ()
+         && endPoint->GetPeerAddress () != Ipv6Address::GetAny ()
+         && endPoint->GetPeerPort () != 0;
+}
+
+void Ipv6EndPointDemux::FindConnected (const Key &key, std::vector<Ipv6EndPoint *> &endPoints)
+{
+  std::unordered_map<Key, std::vector<Ipv6EndPoint *>, KeyHash>::iterator connected = m_connected.find (key);
+  if (connected != m_connected.end ())
+    {
+      endPoints.insert (endPoints.end (), connected->second.begin (), connected->second.end ());
+    }
+}
+
+bool Ipv6EndPointDemux::Key::operator== (const Key &other) const
+{
+  return m_localAddress == other.m_localAddress && m_peerAddress == other.m_peerAddress
+         && m_localPort == other.m_localPort && m_peerPort == other.m_peerPort;
+}
+
+std::size_t Ipv6EndPointDemux::KeyHash::operator() (const Key &key) const
+{
+  Ipv6AddressHash hash;
+  uint64_t ports = (static_cast<uint64_t> (key.m_localPort) << 16) | key.m_peerPort;
+  return hash (key.m_localAddress) ^ (hash (key.m_peerAddress) * 31) ^ (ports * 0x9e3779b97f4a7c15ULL);
+}
+
 } /* namespace ns3 */
 
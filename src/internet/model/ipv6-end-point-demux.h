@@ -23,6 +23,8 @@
 
 #include <stdint.h>
 #include <list>
+#include <unordered_map>
+#include <vector>
 #include "ns3/ipv6-address.h"
 #include "ipv6-interface.h"
 
@@ -34,6 +36,9 @@ class Ipv6EndPoint;
  * \ingroup ipv6
  *
  * \brief Demultiplexer for end points.
+ *
+ * As in Ipv4EndPointDemux, the connected endpoints are indexed by their
+ * four-tuple, and the other endpoints by their local port.
  */
 class Ipv6EndPointDemux
 {
@@ -153,6 +158,62 @@ public:
   EndPoints GetEndPoints () const;
 
 private:
+  friend class Ipv6EndPoint;
+
+  /// The four-tuple of a connected endpoint
+  struct Key
+  {
+    Ipv6Address m_localAddress; //!< the local address
+    Ipv6Address m_peerAddress;  //!< the peer address
+    uint16_t m_localPort;       //!< the local port
+    uint16_t m_peerPort;        //!< the peer port
+
+    /**
+     * \param other another key
+     * \return true if the keys are equal
+     */
+    bool operator== (const Key &other) const;
+  };
+
+  /// Hash function of the four-tuples
+  struct KeyHash
+  {
+    /**
+     * \param key a four-tuple
+     * \return the hash of the four-tuple
+     */
+    std::size_t operator() (const Key &key) const;
+  };
+
+  /**
+   * \brief Add a new end point to the list and to the indexes.
+   * \param endPoint the end point
+   */
+  void Insert (Ipv6EndPoint *endPoint);
+  /**
+   * \brief Add an end point to the indexes.
+   * \param endPoint the end point
+   */
+  void Index (Ipv6EndPoint *endPoint);
+  /**
+   * \brief Remove an end point from the indexes, e.g., before a change of
+   * its four-tuple.
+   * \param endPoint the end point
+   */
+  void Unindex (Ipv6EndPoint *endPoint);
+  /**
+   * \param endPoint an end point
+   * \return true if the end point has a local address and a peer address
+   * and port, i.e., is indexed by its four-tuple
+   */
+  static bool IsConnected (Ipv6EndPoint *endPoint);
+  /**
+   * \brief Find the connected end points with a given four-tuple.
+   * \param key the four-tuple
+   * \param endPoints the vector to which the end points are appended
+   */
+  void FindConnected (const Key &key, std::vector<Ipv6EndPoint *> &endPoints);
+
   /**
    * \brief Allocate a ephemeral port.
    * \return a port
@@ -178,6 +239,26 @@ private:
    * \brief A list of IPv6 end points.
    */
   EndPoints m_endPoints;
+
+  /**
+   * \brief The positions of the end points in m_endPoints.
+   */
+  std::unordered_map<Ipv6EndPoint *, EndPointsI> m_positions;
+
+  /**
+   * \brief The connected end points, by four-tuple.
+   */
+  std::unordered_map<Key, std::vector<Ipv6EndPoint *>, KeyHash> m_connected;
+
+  /**
+   * \brief The other end points, by local port.
+   */
+  std::unordered_map<uint16_t, std::vector<Ipv6EndPoint *> > m_wildcards;
+
+  /**
+   * \brief The number of end points, by local port.
+   */
+  std::unordered_map<uint16_t, uint32_t> m_ports;
 };
 
 } /* namespace ns3 */
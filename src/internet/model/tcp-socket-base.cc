@@ -52,6 +52,7 @@
 #include "tcp-rx-buffer.h"
 #include "rtt-estimator.h"
 #include "tcp-header.h"
+#include "gso-tag.h"
 #include "tcp-option-winscale.h"
 #include "tcp-option-ts.h"
 #include "tcp-option-sack-permitted.h"
@@ -147,6 +148,13 @@ TcpSocketBase::GetTypeId (void)
                    BooleanValue (true),
                    MakeBooleanAccessor (&TcpSocketBase::m_limitedTx),
                    MakeBooleanChecker ())
+    .AddAttribute ("TsoMaxSegments",
+                   "Maximum number of full-sized segments sent by a burst of "
+                   "transmissions as a single super-segment, segmented by the "
+                   "device or by IPv4 (1 disables the segmentation offload)",
+                   UintegerValue (1),
+                   MakeUintegerAccessor (&TcpSocketBase::m_tsoMaxSegments),
+                   MakeUintegerChecker<uint32_t> (1, 65535))
     .AddAttribute ("UseEcn", "Parameter to set ECN functionality",
                    EnumValue (TcpSocketState::Off),
                    MakeEnumAccessor (&TcpSocketBase::SetUseEcn),
@@ -354,6 +362,7 @@ TcpSocketBase::TcpSocketBase (const TcpSocketBase& sock)
     m_txTrace (sock.m_txTrace),
     m_rxTrace (sock.m_rxTrace),
     m_pacingTimer (Timer::CANCEL_ON_DESTROY),
+    m_tsoMaxSegments (sock.m_tsoMaxSegments),
     m_ecnEchoSeq (sock.m_ecnEchoSeq),
     m_ecnCESeq (sock.m_ecnCESeq),
     m_ecnCWRSeq (sock.m_ecnCWRSeq)
@@ -3142,8 +3151,7 @@ TcpSocketBase::SendDataPacket (SequenceNumber32 seq, uint32_t maxSize, bool with
 
   if (m_endPoint)
     {
-      m_tcp->SendPacket (p, header, m_endPoint->GetLocalAddress (),
-                         m_endPoint->GetPeerAddress (), m_boundnetdevice);
+      SendSegment (p, header);
       NS_LOG_DEBUG ("Send segment of size " << sz << " with remaining data " <<
                     remainingData << " via TcpL4Protocol to " <<  m_endPoint->GetPeerAddress () <<
                     ". Header " << header);
@@ -3176,6 +3184,67 @@ TcpSocketBase::SendDataPacket (SequenceNumber32 seq, uint32_t maxSize, bool with
   return sz;
 }
 
+void
+TcpSocketBase::SendSegment (Ptr<Packet> p, const TcpHeader &header)
+{
+  NS_LOG_FUNCTION (this << p << header);
+  if (!m_tsoBatching)
+    {
+      m_tcp->SendPacket (p, header, m_endPoint->GetLocalAddress (),
+                         m_endPoint->GetPeerAddress (), m_boundnetdevice);
+      return;
+    }
+  if (m_tsoPacket != nullptr)
+    {
+      uint32_t size = m_tsoPacket->GetSize ();
+      if (header.GetSequenceNumber () != m_tsoHeader.GetSequenceNumber () + size
+          || size != m_tsoSegments * m_tcb->m_segmentSize
+          || header.GetFlags () != m_tsoHeader.GetFlags ()
+          || header.GetAckNumber () != m_tsoHeader.GetAckNumber ()
+          || header.GetWindowSize () != m_tsoHeader.GetWindowSize ()
+          || header.GetSerializedSize () != m_tsoHeader.GetSerializedSize ()
+          || m_tsoSegments >= m_tsoMaxSegments
+          || size + p->GetSize () + header.GetSerializedSize () + 20 > 65535)
+        {
+          FlushSuperSegment ();
+        }
+    }
+  if (m_tsoPacket == nullptr)
+    {
+      // the traces of the caller may hold p, so gather into a copy
+      m_tsoPacket = p->Copy ();
+      m_tsoHeader = header;
+    }
+  else
+    {
+      m_tsoPacket->AddAtEnd (p);
+    }
+  m_tsoSegments++;
+}
+
+void
+TcpSocketBase::FlushSuperSegment (void)
+{
+  NS_LOG_FUNCTION (this);
+  if (m_tsoPacket == nullptr)
+    {
+      return;
+    }
+  if (m_tsoSegments > 1)
+    {
+      GsoTag tag;
+      tag.SetSegmentSize (m_tcb->m_segmentSize);
+      tag.SetSegments (m_tsoSegments);
+      m_tsoPacket->AddPacketTag (tag);
+    }
+  NS_LOG_DEBUG ("Send super-segment of " << m_tsoSegments << " segments and " <<
+                m_tsoPacket->GetSize () << " bytes. Header " << m_tsoHeader);
+  m_tcp->SendPacket (m_tsoPacket, m_tsoHeader, m_endPoint->GetLocalAddress (),
+                     m_endPoint->GetPeerAddress (), m_boundnetdevice);
+  m_tsoPacket = nullptr;
+  m_tsoSegments = 0;
+}
+
 void
 TcpSocketBase::UpdateRttHistory (const SequenceNumber32 &seq, uint32_t sz,
                                  bool isRetransmission)
@@ -3218,6 +3287,10 @@ TcpSocketBase::SendPendingData (bool withAck)
 
   uint32_t nPacketsSent = 0;
   uint32_t availableWindow = AvailableWindow ();
+  // gather the segments of this burst into super-segments; only the
+  // outermost call flushes them
+  bool outermost = !m_tsoBatching;
+  m_tsoBatching = m_tsoMaxSegments > 1;
 
   // RFC 6675, Section (C)
   // If cwnd - pipe >= 1 SMSS, the sender SHOULD transmit one or more
@@ -3344,6 +3417,11 @@ TcpSocketBase::SendPendingData (bool withAck)
       // (C.5) If cwnd - pipe >= 1 SMSS, return to (C.1)
       // loop again!
     }
+  if (outermost)
+    {
+      FlushSuperSegment ();
+      m_tsoBatching = false;
+    }
 
   if (nPacketsSent > 0)
     {
@@ -780,6 +780,26 @@ protected:
    */
   virtual uint32_t SendDataPacket (SequenceNumber32 seq, uint32_t maxSize, bool withAck);
 
+  /**
+   * \brief Hand a data segment to TcpL4Protocol, or append it to the
+   *        super-segment gathered by SendPendingData when TSO is enabled
+   *
+   * A segment starts a new super-segment when it does not follow the
+   * previous one, when the previous one was not a full segment, when its
+   * flags, acknowledgment number, window or options differ, or when the
+   * super-segment is full.
+   *
+   * \param p the payload
+   * \param header the TCP header of the segment
+   */
+  void SendSegment (Ptr<Packet> p, const TcpHeader &header);
+
+  /**
+   * \brief Send the super-segment gathered by SendSegment, if any, with a
+   *        GsoTag when it holds more than one segment
+   */
+  void FlushSuperSegment (void);
+
   /**
    * \brief Send a empty packet that carries a flag, e.g., ACK
    *
@@ -1343,6 +1363,13 @@ protected:
   // Pacing related variable
   Timer m_pacingTimer {Timer::CANCEL_ON_DESTROY}; //!< Pacing Event
 
+  // Segmentation offload
+  uint32_t    m_tsoMaxSegments {1};     //!< Maximum number of segments of a super-segment (1 disables TSO)
+  bool        m_tsoBatching {false};    //!< True while SendPendingData gathers its segments
+  Ptr<Packet> m_tsoPacket {nullptr};    //!< Payload of the super-segment being gathered
+  TcpHeader   m_tsoHeader;              //!< TCP header of the super-segment being gathered
+  uint16_t    m_tsoSegments {0};        //!< Number of segments in m_tsoPacket
+
   // Parameters related to Explicit Congestion Notification
   TracedValue<SequenceNumber32> m_ecnEchoSeq {0};      //!< Sequence number of the last received ECN Echo
   TracedValue<SequenceNumber32> m_ecnCESeq   {0};      //!< Sequence number of the last received Congestion Experienced
@@ -0,0 +1,245 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <vector>
+#include "ns3/ipv4-end-point.h"
+#include "ns3/ipv4-end-point-demux.h"
+#include "ns3/ipv4-interface.h"
+#include "ns3/ipv4-interface-address.h"
+#include "ns3/ipv6-end-point.h"
+#include "ns3/ipv6-end-point-demux.h"
+#include "ns3/test.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Checks the lookups of Ipv4EndPointDemux: a listener and many
+ * connections on the same port, endpoints connected after their
+ * allocation, subnet-directed endpoints and deallocations.
+ */
+class Ipv4EndPointDemuxTestCase : public TestCase
+{
+public:
+  Ipv4EndPointDemuxTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * Look up a single endpoint.
+   * \param demux the demux
+   * \param daddr the destination address
+   * \param dport the destination port
+   * \param saddr the source address
+   * \param sport the source port
+   * \param interface the incoming interface
+   * \return the endpoint, or 0 if none matches
+   */
+  static Ipv4EndPoint *LookupOne (Ipv4EndPointDemux &demux, Ipv4Address daddr, uint16_t dport,
+                                  Ipv4Address saddr, uint16_t sport, Ptr<Ipv4Interface> interface);
+};
+
+Ipv4EndPointDemuxTestCase::Ipv4EndPointDemuxTestCase ()
+  : TestCase ("Lookups of the IPv4 endpoints")
+{
+}
+
+Ipv4EndPoint *
+Ipv4EndPointDemuxTestCase::LookupOne (Ipv4EndPointDemux &demux, Ipv4Address daddr, uint16_t dport,
+                                      Ipv4Address saddr, uint16_t sport, Ptr<Ipv4Interface> interface)
+{
+  Ipv4EndPointDemux::EndPoints endPoints = demux.Lookup (daddr, dport, saddr, sport, interface);
+  return endPoints.empty () ? 0 : endPoints.front ();
+}
+
+void
+Ipv4EndPointDemuxTestCase::DoRun (void)
+{
+  Ipv4Address local ("10.0.0.1");
+  Ptr<Ipv4Interface> interface = CreateObject<Ipv4Interface> ();
+  interface->AddAddress (Ipv4InterfaceAddress (local, Ipv4Mask ("/24")));
+
+  Ipv4EndPointDemux demux;
+  Ipv4EndPoint *listener = demux.Allocate (0, 80);
+  NS_TEST_ASSERT_MSG_NE (listener, 0, "Listener not allocated");
+  NS_TEST_EXPECT_MSG_EQ (demux.Allocate (0, 80), 0, "Duplicated listener allocated");
+  std::vector<Ipv4EndPoint *> connections;
+  for (uint32_t i = 0; i < 1000; i++)
+    {
+      connections.push_back (demux.Allocate (0, local, 80, Ipv4Address (0xc0a80000 + i), 1000 + i));
+      NS_TEST_ASSERT_MSG_NE (connections.back (), 0, "Connection " << i << " not allocated");
+    }
+  NS_TEST_EXPECT_MSG_EQ (demux.Allocate (0, local, 80, Ipv4Address (0xc0a80000 + 7), 1007), 0,
+                         "Duplicated connection allocated");
+  for (uint32_t i = 0; i < 1000; i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (LookupOne (demux, local, 80, Ipv4Address (0xc0a80000 + i), 1000 + i, interface),
+                             connections[i], "Wrong endpoint of connection " << i);
+    }
+  NS_TEST_EXPECT_MSG_EQ (LookupOne (demux, local, 80, Ipv4Address (0xc0a80000 + 1), 1000, interface),
+                         listener, "New connection not delivered to the listener");
+  NS_TEST_EXPECT_MSG_EQ (LookupOne (demux, local, 81, Ipv4Address (0xc0a80000), 1000, interface),
+                         0, "Packet delivered to a closed port");
+
+  // an endpoint connected after its allocation, as by TcpSocketBase::Connect
+  Ipv4EndPoint *client = demux.Allocate ();
+  uint16_t clientPort = client->GetLocalPort ();
+  NS_TEST_EXPECT_MSG_EQ (demux.LookupPortLocal (clientPort), true, "Ephemeral port not in use");
+  Ipv4Address server ("172.16.0.1");
+  NS_TEST_EXPECT_MSG_EQ (LookupOne (demux, local, clientPort, server, 80, interface),
+                         client, "Unconnected endpoint not found");
+  client->SetPeer (server, 80);
+  client->SetLocalAddress (local);
+  NS_TEST_EXPECT_MSG_EQ (LookupOne (demux, local, clientPort, server, 80, interface),
+                         client, "Connected endpoint not found");
+  NS_TEST_EXPECT_MSG_EQ (LookupOne (demux, local, clientPort, server, 81, interface),
+                         0, "Connected endpoint found for another peer");
+
+  // a connected endpoint bound to the network of the incoming interface
+  Ipv4EndPoint *subnet = demux.Allocate (0, Ipv4Address ("10.0.0.0"), 90, server, 90);
+  NS_TEST_EXPECT_MSG_EQ (LookupOne (demux, Ipv4Address ("10.0.0.255"), 90, server, 90, interface),
+                         subnet, "Subnet-directed endpoint not found");
+  NS_TEST_EXPECT_MSG_EQ (LookupOne (demux, Ipv4Address ("10.0.1.255"), 90, server, 90, interface),
+                         0, "Subnet-directed endpoint found for another network");
+
+  demux.DeAllocate (connections[3]);
+  NS_TEST_EXPECT_MSG_EQ (LookupOne (demux, local, 80, Ipv4Address (0xc0a80000 + 3), 1003, interface),
+                         listener, "Deallocated connection still found");
+  demux.DeAllocate (client);
+  NS_TEST_EXPECT_MSG_EQ (demux.LookupPortLocal (clientPort), false, "Ephemeral port still in use");
+  NS_TEST_EXPECT_MSG_EQ (demux.GetAllEndPoints ().size (), 1001, "Wrong number of endpoints");
+}
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Checks the lookups of Ipv6EndPointDemux: a listener and many
+ * connections on the same port, endpoints connected after their
+ * allocation and deallocations.
+ */
+class Ipv6EndPointDemuxTestCase : public TestCase
+{
+public:
+  Ipv6EndPointDemuxTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * Look up a single endpoint.
+   * \param demux the demux
+   * \param daddr the destination address
+   * \param dport the destination port
+   * \param saddr the source address
+   * \param sport the source port
+   * \return the endpoint, or 0 if none matches
+   */
+  static Ipv6EndPoint *LookupOne (Ipv6EndPointDemux &demux, Ipv6Address daddr, uint16_t dport,
+                                  Ipv6Address saddr, uint16_t sport);
+  /**
+   * \param i an index
+   * \return the address of the i-th peer
+   */
+  static Ipv6Address GetPeer (uint32_t i);
+};
+
+Ipv6EndPointDemuxTestCase::Ipv6EndPointDemuxTestCase ()
+  : TestCase ("Lookups of the IPv6 endpoints")
+{
+}
+
+Ipv6EndPoint *
+Ipv6EndPointDemuxTestCase::LookupOne (Ipv6EndPointDemux &demux, Ipv6Address daddr, uint16_t dport,
+                                      Ipv6Address saddr, uint16_t sport)
+{
+  Ipv6EndPointDemux::EndPoints endPoints = demux.Lookup (daddr, dport, saddr, sport, 0);
+  return endPoints.empty () ? 0 : endPoints.front ();
+}
+
+Ipv6Address
+Ipv6EndPointDemuxTestCase::GetPeer (uint32_t i)
+{
+  uint8_t address[16] = { 0x20, 0x01, 0x0d, 0xb8 };
+  address[14] = i >> 8;
+  address[15] = i & 0xff;
+  return Ipv6Address (address);
+}
+
+void
+Ipv6EndPointDemuxTestCase::DoRun (void)
+{
+  Ipv6Address local ("2001:db8:1::1");
+  Ipv6EndPointDemux demux;
+  Ipv6EndPoint *listener = demux.Allocate (0, 80);
+  NS_TEST_ASSERT_MSG_NE (listener, 0, "Listener not allocated");
+  std::vector<Ipv6EndPoint *> connections;
+  for (uint32_t i = 0; i < 1000; i++)
+    {
+      connections.push_back (demux.Allocate (0, local, 80, GetPeer (i), 1000 + i));
+      NS_TEST_ASSERT_MSG_NE (connections.back (), 0, "Connection " << i << " not allocated");
+    }
+  NS_TEST_EXPECT_MSG_EQ (demux.Allocate (0, local, 80, GetPeer (7), 1007), 0,
+                         "Duplicated connection allocated");
+  for (uint32_t i = 0; i < 1000; i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (LookupOne (demux, local, 80, GetPeer (i), 1000 + i),
+                             connections[i], "Wrong endpoint of connection " << i);
+    }
+  NS_TEST_EXPECT_MSG_EQ (LookupOne (demux, local, 80, GetPeer (1), 1000),
+                         listener, "New connection not delivered to the listener");
+
+  Ipv6EndPoint *client = demux.Allocate ();
+  uint16_t clientPort = client->GetLocalPort ();
+  Ipv6Address server ("2001:db8:2::1");
+  client->SetPeer (server, 80);
+  client->SetLocalAddress (local);
+  NS_TEST_EXPECT_MSG_EQ (LookupOne (demux, local, clientPort, server, 80),
+                         client, "Connected endpoint not found");
+  NS_TEST_EXPECT_MSG_EQ (LookupOne (demux, local, clientPort, server, 81),
+                         0, "Connected endpoint found for another peer");
+
+  demux.DeAllocate (connections[3]);
+  NS_TEST_EXPECT_MSG_EQ (LookupOne (demux, local, 80, GetPeer (3), 1003),
+                         listener, "Deallocated connection still found");
+  demux.DeAllocate (client);
+  NS_TEST_EXPECT_MSG_EQ (demux.LookupPortLocal (clientPort), false, "Ephemeral port still in use");
+  NS_TEST_EXPECT_MSG_EQ (demux.GetEndPoints ().size (), 1000, "Wrong number of endpoints");
+}
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief End point demux TestSuite
+ */
+class EndPointDemuxTestSuite : public TestSuite
+{
+public:
+  EndPointDemuxTestSuite ();
+};
+
+EndPointDemuxTestSuite::EndPointDemuxTestSuite ()
+  : TestSuite ("end-point-demux", UNIT)
+{
+  AddTestCase (new Ipv4EndPointDemuxTestCase (), TestCase::QUICK);
+  AddTestCase (new Ipv6EndPointDemuxTestCase (), TestCase::QUICK);
+}
+
+static EndPointDemuxTestSuite g_endPointDemuxTestSuite; //!< Static variable for test initialization
@@ -0,0 +1,243 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/boolean.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4-global-routing.h"
+#include "ns3/ipv4-static-routing.h"
+#include "ns3/ipv4-static-routing-helper.h"
+#include "ns3/ipv4-route.h"
+#include "ns3/ipv4.h"
+#include "ns3/node.h"
+#include "ns3/packet.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/simple-net-device.h"
+#include "ns3/simulator.h"
+#include "ns3/test.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Checks that the lookups through the tries of Ipv4StaticRouting
+ * and Ipv4GlobalRouting return the same routes as the scans of their
+ * route lists.
+ *
+ * Random overlapping routes, with random metrics, interfaces and some
+ * non-contiguous masks, are added to a node with four interfaces; the
+ * routes to random destinations, with and without an output device,
+ * are then compared, before and after the removal of some routes.
+ */
+class Ipv4FibTrieTestCase : public TestCase
+{
+public:
+  Ipv4FibTrieTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \return a random address of the small address space of the test
+   */
+  Ipv4Address GetRandomAddress (void);
+  /**
+   * \return a random mask, mostly contiguous
+   */
+  Ipv4Mask GetRandomMask (void);
+  /**
+   * Compare the routes of two routing protocols to random destinations.
+   * \param fib the routing protocol using its trie
+   * \param list the routing protocol scanning its lists
+   * \param what the name of the routing protocol
+   */
+  void CheckLookups (Ptr<Ipv4RoutingProtocol> fib, Ptr<Ipv4RoutingProtocol> list, std::string what);
+
+  Ptr<Ipv4> m_ipv4; //!< the IPv4 stack of the node
+  Ptr<UniformRandomVariable> m_random; //!< the random generator of the routes
+};
+
+Ipv4FibTrieTestCase::Ipv4FibTrieTestCase ()
+  : TestCase ("Lookups through the tries match the scans of the route lists")
+{
+}
+
+Ipv4Address
+Ipv4FibTrieTestCase::GetRandomAddress (void)
+{
+  // 10.0-3.0-3.0-7: short enough for the routes to overlap often
+  return Ipv4Address ((10 << 24) | (m_random->GetInteger (0, 3) << 16)
+                      | (m_random->GetInteger (0, 3) << 8) | m_random->GetInteger (0, 7));
+}
+
+Ipv4Mask
+Ipv4FibTrieTestCase::GetRandomMask (void)
+{
+  static const char *masks[] = {"/0", "/8", "/14", "/16", "/22", "/24", "/29", "/30", "/32", "/32",
+                                "255.0.255.0", "255.255.0.255"};
+  return Ipv4Mask (masks[m_random->GetInteger (0, 11)]);
+}
+
+void
+Ipv4FibTrieTestCase::CheckLookups (Ptr<Ipv4RoutingProtocol> fib, Ptr<Ipv4RoutingProtocol> list, std::string what)
+{
+  uint32_t found = 0;
+  for (uint32_t i = 0; i < 2000; i++)
+    {
+      Ipv4Header header;
+      header.SetDestination (GetRandomAddress ());
+      uint32_t interface = m_random->GetInteger (0, 4);
+      Ptr<NetDevice> oif = interface == 0 ? 0 : m_ipv4->GetNetDevice (interface);
+      Socket::SocketErrno fibErr;
+      Socket::SocketErrno listErr;
+      Ptr<Ipv4Route> fibRoute = fib->RouteOutput (Create<Packet> (), header, oif, fibErr);
+      Ptr<Ipv4Route> listRoute = list->RouteOutput (Create<Packet> (), header, oif, listErr);
+      NS_TEST_ASSERT_MSG_EQ ((fibRoute == 0), (listRoute == 0),
+                             what << ": route to " << header.GetDestination () << " found by one lookup only");
+      NS_TEST_ASSERT_MSG_EQ (fibErr, listErr, what << ": different errors");
+      if (fibRoute == 0)
+        {
+          continue;
+        }
+      found++;
+      NS_TEST_ASSERT_MSG_EQ (fibRoute->GetDestination (), listRoute->GetDestination (),
+                             what << ": different routes to " << header.GetDestination ());
+      NS_TEST_ASSERT_MSG_EQ (fibRoute->GetGateway (), listRoute->GetGateway (),
+                             what << ": different gateways to " << header.GetDestination ());
+      NS_TEST_ASSERT_MSG_EQ (fibRoute->GetSource (), listRoute->GetSource (),
+                             what << ": different sources to " << header.GetDestination ());
+      NS_TEST_ASSERT_MSG_EQ (fibRoute->GetOutputDevice (), listRoute->GetOutputDevice (),
+                             what << ": different devices to " << header.GetDestination ());
+    }
+  NS_TEST_EXPECT_MSG_GT (found, 100, what << ": too few routes found to be meaningful");
+}
+
+void
+Ipv4FibTrieTestCase::DoRun (void)
+{
+  m_random = CreateObject<UniformRandomVariable> ();
+  m_random->SetStream (1);
+
+  Ptr<Node> node = CreateObject<Node> ();
+  InternetStackHelper internet;
+  internet.Install (node);
+  m_ipv4 = node->GetObject<Ipv4> ();
+  for (uint32_t i = 0; i < 4; i++)
+    {
+      Ptr<SimpleNetDevice> device = CreateObject<SimpleNetDevice> ();
+      device->SetAddress (Mac48Address::Allocate ());
+      node->AddDevice (device);
+      int32_t interface = m_ipv4->AddInterface (device);
+      m_ipv4->AddAddress (interface, Ipv4InterfaceAddress (Ipv4Address ((172 << 24) | (16 << 16) | (i << 8) | 1),
+                                                          Ipv4Mask ("/24")));
+      m_ipv4->SetUp (interface);
+    }
+
+  // static routing: one routing protocol, looked up both ways
+  Ipv4StaticRoutingHelper staticHelper;
+  Ptr<Ipv4StaticRouting> staticRouting = staticHelper.GetStaticRouting (m_ipv4);
+  Ptr<Ipv4StaticRouting> staticList = CreateObject<Ipv4StaticRouting> ();
+  staticList->SetAttribute ("UseFib", BooleanValue (false));
+  staticList->SetIpv4 (m_ipv4);
+  for (uint32_t i = 0; i < 300; i++)
+    {
+      Ipv4Address network = GetRandomAddress ();
+      Ipv4Mask mask = GetRandomMask ();
+      Ipv4Address gateway = GetRandomAddress ();
+      uint32_t interface = m_random->GetInteger (1, 4);
+      uint32_t metric = m_random->GetInteger (0, 3);
+      staticRouting->AddNetworkRouteTo (network, mask, gateway, interface, metric);
+      staticList->AddNetworkRouteTo (network, mask, gateway, interface, metric);
+    }
+  NS_TEST_ASSERT_MSG_EQ (staticRouting->GetNRoutes (), staticList->GetNRoutes (),
+                         "the duplicate routes were not detected alike");
+  CheckLookups (staticRouting, staticList, "static");
+  for (uint32_t i = 0; i < 100; i++)
+    {
+      uint32_t index = m_random->GetInteger (0, staticRouting->GetNRoutes () - 1);
+      staticRouting->RemoveRoute (index);
+      staticList->RemoveRoute (index);
+    }
+  // only the routing protocol of the node is notified
+  m_ipv4->SetDown (2);
+  staticList->NotifyInterfaceDown (2);
+  CheckLookups (staticRouting, staticList, "static after removals");
+
+  // global routing: two routing protocols with the same random streams
+  Ptr<Ipv4GlobalRouting> globalFib = CreateObject<Ipv4GlobalRouting> ();
+  Ptr<Ipv4GlobalRouting> globalList = CreateObject<Ipv4GlobalRouting> ();
+  globalList->SetAttribute ("UseFib", BooleanValue (false));
+  globalFib->SetAttribute ("RandomEcmpRouting", BooleanValue (true));
+  globalList->SetAttribute ("RandomEcmpRouting", BooleanValue (true));
+  globalFib->AssignStreams (2);
+  globalList->AssignStreams (2);
+  globalFib->SetIpv4 (m_ipv4);
+  globalList->SetIpv4 (m_ipv4);
+  for (uint32_t i = 0; i < 300; i++)
+    {
+      uint32_t type = m_random->GetInteger (0, 2);
+      Ipv4Address network = GetRandomAddress ();
+      Ipv4Mask mask = GetRandomMask ();
+      Ipv4Address gateway = GetRandomAddress ();
+      uint32_t interface = m_random->GetInteger (1, 4);
+      for (Ptr<Ipv4GlobalRouting> routing : {globalFib, globalList})
+        {
+          if (type == 0)
+            {
+              routing->AddHostRouteTo (network, gateway, interface);
+            }
+          else if (type == 1)
+            {
+              routing->AddNetworkRouteTo (network, mask, gateway, interface);
+            }
+          else
+            {
+              routing->AddASExternalRouteTo (network, mask, gateway, interface);
+            }
+        }
+    }
+  CheckLookups (globalFib, globalList, "global");
+  for (uint32_t i = 0; i < 150; i++)
+    {
+      uint32_t index = m_random->GetInteger (0, globalFib->GetNRoutes () - 1);
+      globalFib->RemoveRoute (index);
+      globalList->RemoveRoute (index);
+    }
+  CheckLookups (globalFib, globalList, "global after removals");
+
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief IPv4 FIB trie TestSuite
+ */
+class Ipv4FibTrieTestSuite : public TestSuite
+{
+public:
+  Ipv4FibTrieTestSuite ();
+};
+
+Ipv4FibTrieTestSuite::Ipv4FibTrieTestSuite ()
+  : TestSuite ("ipv4-fib-trie", UNIT)
+{
+  AddTestCase (new Ipv4FibTrieTestCase (), TestCase::QUICK);
+}
+
+static Ipv4FibTrieTestSuite g_ipv4FibTrieTestSuite; //!< Static variable for test initialization
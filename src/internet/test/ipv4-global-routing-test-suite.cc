@@ -42,6 +42,8 @@
 #include "ns3/ipv4-routing-table-entry.h"
 #include "ns3/ipv4-global-routing.h"
 #include "ns3/bridge-helper.h"
+#include "ns3/enum.h"
+#include "ns3/udp-header.h"
 
 using namespace ns3;
 
@@ -1244,6 +1246,197 @@ Ipv4GlobalRoutingSlash32TestCase::DoRun (void)
   Simulator::Destroy ();
 }
 
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief IPv4 GlobalRouting ECMP test
+ *
+ * A router with four equal-cost routes to 10.0.0.0/8 forwards UDP
+ * flows: in Flow mode, the packets of a flow, and the fragments of all
+ * the flows between two hosts, take the same route, the flows are
+ * spread over the four routes and their routes depend on the hash
+ * seed; in Flowlet mode, the flows keep their routes while they are
+ * active and are re-hashed after an idle time.
+ */
+class Ipv4GlobalRoutingEcmpTestCase : public TestCase
+{
+public:
+  Ipv4GlobalRoutingEcmpTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * \brief Create a routing protocol with four equal-cost routes.
+   * \param mode the ECMP mode
+   * \param seed the hash seed
+   * \return the routing protocol
+   */
+  Ptr<Ipv4GlobalRouting> CreateRouting (Ipv4GlobalRouting::EcmpMode mode, uint32_t seed);
+  /**
+   * \brief Forward a UDP packet.
+   * \param routing the routing protocol
+   * \param sport the source port
+   * \param fragmentOffset the fragment offset of the packet
+   * \return the output interface of the packet
+   */
+  uint32_t Forward (Ptr<Ipv4GlobalRouting> routing, uint16_t sport, uint16_t fragmentOffset = 0);
+  /**
+   * \brief Forward a packet of each flow.
+   * \param routing the routing protocol
+   * \param round the index of the round in m_rounds
+   */
+  void ForwardFlows (Ptr<Ipv4GlobalRouting> routing, uint32_t round);
+  /**
+   * \brief Record the output interface of a packet.
+   * \param route the route of the packet
+   * \param p the packet
+   * \param header the IPv4 header of the packet
+   */
+  void Receive (Ptr<Ipv4Route> route, Ptr<const Packet> p, const Ipv4Header &header);
+
+  static const uint16_t N_FLOWS = 64; //!< the number of flows
+  Ptr<Ipv4> m_ipv4;                   //!< the IPv4 stack of the router
+  uint32_t m_interface;               //!< the output interface of the last packet
+  std::vector<std::vector<uint32_t> > m_rounds; //!< the output interfaces of the flows, per round
+};
+
+Ipv4GlobalRoutingEcmpTestCase::Ipv4GlobalRoutingEcmpTestCase ()
+  : TestCase ("ECMP routing by flow and by flowlet, and route cache")
+{
+}
+
+Ptr<Ipv4GlobalRouting>
+Ipv4GlobalRoutingEcmpTestCase::CreateRouting (Ipv4GlobalRouting::EcmpMode mode, uint32_t seed)
+{
+  Ptr<Ipv4GlobalRouting> routing = CreateObject<Ipv4GlobalRouting> ();
+  routing->SetAttribute ("EcmpMode", EnumValue (mode));
+  routing->SetAttribute ("EcmpHashSeed", UintegerValue (seed));
+  routing->SetIpv4 (m_ipv4);
+  for (uint32_t i = 1; i <= 4; i++)
+    {
+      routing->AddNetworkRouteTo (Ipv4Address ("10.0.0.0"), Ipv4Mask ("/8"),
+                                  Ipv4Address ((172 << 24) | (16 << 16) | (i << 8) | 2), i);
+    }
+  return routing;
+}
+
+uint32_t
+Ipv4GlobalRoutingEcmpTestCase::Forward (Ptr<Ipv4GlobalRouting> routing, uint16_t sport, uint16_t fragmentOffset)
+{
+  Ptr<Packet> p = Create<Packet> (100);
+  UdpHeader udpHeader;
+  udpHeader.SetSourcePort (sport);
+  udpHeader.SetDestinationPort (9);
+  p->AddHeader (udpHeader);
+  Ipv4Header header;
+  header.SetSource (Ipv4Address ("192.168.0.1"));
+  header.SetDestination (Ipv4Address ("10.0.0.1"));
+  header.SetProtocol (17);
+  header.SetFragmentOffset (fragmentOffset);
+  m_interface = 0;
+  routing->RouteInput (p, header, m_ipv4->GetNetDevice (5),
+                       MakeCallback (&Ipv4GlobalRoutingEcmpTestCase::Receive, this),
+                       Ipv4RoutingProtocol::MulticastForwardCallback (),
+                       Ipv4RoutingProtocol::LocalDeliverCallback (),
+                       Ipv4RoutingProtocol::ErrorCallback ());
+  NS_TEST_EXPECT_MSG_NE (m_interface, 0, "Packet not forwarded");
+  return m_interface;
+}
+
+void
+Ipv4GlobalRoutingEcmpTestCase::ForwardFlows (Ptr<Ipv4GlobalRouting> routing, uint32_t round)
+{
+  m_rounds.resize (round + 1);
+  for (uint16_t flow = 0; flow < N_FLOWS; flow++)
+    {
+      m_rounds[round].push_back (Forward (routing, 1000 + flow));
+    }
+}
+
+void
+Ipv4GlobalRoutingEcmpTestCase::Receive (Ptr<Ipv4Route> route, Ptr<const Packet> p, const Ipv4Header &header)
+{
+  m_interface = m_ipv4->GetInterfaceForDevice (route->GetOutputDevice ());
+}
+
+void
+Ipv4GlobalRoutingEcmpTestCase::DoRun (void)
+{
+  Ptr<Node> node = CreateObject<Node> ();
+  InternetStackHelper internet;
+  internet.Install (node);
+  m_ipv4 = node->GetObject<Ipv4> ();
+  // four output interfaces and an input interface
+  for (uint32_t i = 1; i <= 5; i++)
+    {
+      Ptr<SimpleNetDevice> device = CreateObject<SimpleNetDevice> ();
+      device->SetAddress (Mac48Address::Allocate ());
+      node->AddDevice (device);
+      int32_t interface = m_ipv4->AddInterface (device);
+      m_ipv4->AddAddress (interface, Ipv4InterfaceAddress (Ipv4Address ((172 << 24) | (16 << 16) | (i << 8) | 1),
+                                                          Ipv4Mask ("/24")));
+      m_ipv4->SetForwarding (interface, true);
+      m_ipv4->SetUp (interface);
+    }
+
+  Ptr<Ipv4GlobalRouting> flow = CreateRouting (Ipv4GlobalRouting::ECMP_FLOW, 0);
+  Ptr<Ipv4GlobalRouting> otherSeed = CreateRouting (Ipv4GlobalRouting::ECMP_FLOW, 1);
+  std::vector<uint32_t> packets (5, 0);
+  uint32_t fragmentInterface = Forward (flow, 1000, 8);
+  uint32_t differentSeed = 0;
+  for (uint16_t i = 0; i < N_FLOWS; i++)
+    {
+      uint32_t interface = Forward (flow, 1000 + i);
+      packets[interface]++;
+      NS_TEST_EXPECT_MSG_EQ (Forward (flow, 1000 + i), interface, "Flow " << i << " changed its route");
+      NS_TEST_EXPECT_MSG_EQ (Forward (flow, 1000 + i, 8), fragmentInterface,
+                             "Fragment of flow " << i << " routed by its ports");
+      if (Forward (otherSeed, 1000 + i) != interface)
+        {
+          differentSeed++;
+        }
+    }
+  for (uint32_t i = 1; i <= 4; i++)
+    {
+      NS_TEST_EXPECT_MSG_GT (packets[i], 0, "No flow routed to interface " << i);
+    }
+  NS_TEST_EXPECT_MSG_GT (differentSeed, 0, "The hash seed does not change the routes");
+
+  Ptr<Ipv4GlobalRouting> flowlet = CreateRouting (Ipv4GlobalRouting::ECMP_FLOWLET, 0);
+  flowlet->SetAttribute ("FlowletTimeout", TimeValue (MicroSeconds (500)));
+  Simulator::Schedule (MicroSeconds (0), &Ipv4GlobalRoutingEcmpTestCase::ForwardFlows, this, flowlet, 0);
+  Simulator::Schedule (MicroSeconds (400), &Ipv4GlobalRoutingEcmpTestCase::ForwardFlows, this, flowlet, 1);
+  Simulator::Schedule (MicroSeconds (800), &Ipv4GlobalRoutingEcmpTestCase::ForwardFlows, this, flowlet, 2);
+  Simulator::Schedule (MicroSeconds (2000), &Ipv4GlobalRoutingEcmpTestCase::ForwardFlows, this, flowlet, 3);
+  Simulator::Run ();
+  uint32_t rehashed = 0;
+  for (uint16_t i = 0; i < N_FLOWS; i++)
+    {
+      NS_TEST_EXPECT_MSG_EQ (m_rounds[1][i], m_rounds[0][i], "Flowlet " << i << " changed its route");
+      NS_TEST_EXPECT_MSG_EQ (m_rounds[2][i], m_rounds[0][i], "Flowlet " << i << " changed its route");
+      if (m_rounds[3][i] != m_rounds[2][i])
+        {
+          rehashed++;
+        }
+    }
+  NS_TEST_EXPECT_MSG_GT (rehashed, 0, "No flow re-hashed after an idle time");
+
+  // the routes remembered per destination follow the changes of the routes
+  Ptr<Ipv4GlobalRouting> first = CreateRouting (Ipv4GlobalRouting::ECMP_FIRST, 0);
+  NS_TEST_EXPECT_MSG_EQ (Forward (first, 1000), 1, "Wrong first route");
+  NS_TEST_EXPECT_MSG_EQ (Forward (first, 1001), 1, "Wrong cached route");
+  first->AddHostRouteTo (Ipv4Address ("10.0.0.1"), Ipv4Address ("172.16.3.2"), 3);
+  NS_TEST_EXPECT_MSG_EQ (Forward (first, 1000), 3, "Cached route used after a host route was added");
+  first->RemoveRoute (0);
+  NS_TEST_EXPECT_MSG_EQ (Forward (first, 1000), 1, "Cached route used after a host route was removed");
+  first->SetAttribute ("RouteCacheSize", UintegerValue (0));
+  NS_TEST_EXPECT_MSG_EQ (Forward (first, 1000), 1, "Wrong route without the cache");
+
+  Simulator::Destroy ();
+}
+
 /**
  * \ingroup internet-test
  * \ingroup tests
@@ -1267,6 +1460,7 @@ Ipv4GlobalRoutingTestSuite::Ipv4GlobalRoutingTestSuite ()
     AddTestCase (new TwoBridgeTest, TestCase::QUICK);
     AddTestCase (new Ipv4DynamicGlobalRoutingTestCase, TestCase::QUICK);
     AddTestCase (new Ipv4GlobalRoutingSlash32TestCase, TestCase::QUICK);
+    AddTestCase (new Ipv4GlobalRoutingEcmpTestCase, TestCase::QUICK);
   }
 
 static Ipv4GlobalRoutingTestSuite g_globalRoutingTestSuite; //!< Static variable for test initialization
@@ -0,0 +1,236 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <algorithm>
+#include <vector>
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/simple-channel.h"
+#include "ns3/simple-net-device.h"
+#include "ns3/data-rate.h"
+#include "ns3/error-model.h"
+#include "ns3/uinteger.h"
+#include "ns3/node.h"
+#include "ns3/inet-socket-address.h"
+#include "ns3/internet-stack-helper.h"
+#include "ns3/ipv4-l3-protocol.h"
+#include "ns3/tcp-socket-factory.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief Checks a TCP transfer with the segmentation offload over a
+ * device without segmentation support: the super-segments of the sender
+ * are segmented by IPv4 into packets that fit the MTU of the device and
+ * that deliver the stream unchanged.
+ */
+class TcpTsoTestCase : public TestCase
+{
+public:
+  TcpTsoTestCase ();
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * Add a device to a node.
+   * \param node the node
+   * \param address the IPv4 address of the device
+   * \return the device
+   */
+  static Ptr<SimpleNetDevice> AddDevice (Ptr<Node> node, Ipv4Address address);
+  /**
+   * Write the stream to the socket.
+   * \param socket the socket
+   * \param available the free space of its buffer
+   */
+  void Send (Ptr<Socket> socket, uint32_t available);
+  /**
+   * Read the stream from the socket.
+   * \param socket the socket
+   */
+  void Recv (Ptr<Socket> socket);
+  /**
+   * Accept a connection.
+   * \param socket the socket
+   * \param from the peer
+   */
+  void Accept (Ptr<Socket> socket, const Address &from);
+  /**
+   * Count a packet handed down by the sender TCP.
+   * \param header the IPv4 header
+   * \param packet the packet
+   * \param interface the output interface
+   */
+  void SendOutgoing (const Ipv4Header &header, Ptr<const Packet> packet, uint32_t interface);
+  /**
+   * Count a packet received by the receiver.
+   * \param packet the packet, with its IPv4 header
+   * \param ipv4 the IPv4 protocol
+   * \param interface the input interface
+   */
+  void Rx (Ptr<const Packet> packet, Ptr<Ipv4> ipv4, uint32_t interface);
+
+  std::vector<uint8_t> m_txPayload; //!< stream sent
+  std::vector<uint8_t> m_rxPayload; //!< stream received
+  uint32_t m_txBytes {0};           //!< bytes written
+  uint32_t m_sent {0};              //!< data packets handed down by the sender TCP
+  uint32_t m_received {0};          //!< data packets received
+  uint32_t m_largest {0};           //!< largest packet received
+};
+
+TcpTsoTestCase::TcpTsoTestCase ()
+  : TestCase ("TCP transfer with segmentation offload segmented by IPv4")
+{
+}
+
+Ptr<SimpleNetDevice>
+TcpTsoTestCase::AddDevice (Ptr<Node> node, Ipv4Address address)
+{
+  Ptr<SimpleNetDevice> device = CreateObject<SimpleNetDevice> ();
+  device->SetAddress (Mac48Address::ConvertFrom (Mac48Address::Allocate ()));
+  device->SetMtu (1500);
+  device->SetAttribute ("DataRate", DataRateValue (DataRate ("1Gbps")));
+  node->AddDevice (device);
+  Ptr<Ipv4> ipv4 = node->GetObject<Ipv4> ();
+  uint32_t interface = ipv4->AddInterface (device);
+  ipv4->AddAddress (interface, Ipv4InterfaceAddress (address, Ipv4Mask ("/24")));
+  ipv4->SetUp (interface);
+  return device;
+}
+
+void
+TcpTsoTestCase::Send (Ptr<Socket> socket, uint32_t available)
+{
+  while (m_txBytes < m_txPayload.size () && socket->GetTxAvailable () > 0)
+    {
+      uint32_t size = std::min<uint32_t> (m_txPayload.size () - m_txBytes, socket->GetTxAvailable ());
+      int sent = socket->Send (&m_txPayload[m_txBytes], size, 0);
+      NS_TEST_ASSERT_MSG_GT (sent, 0, "Error during send");
+      m_txBytes += sent;
+    }
+}
+
+void
+TcpTsoTestCase::Recv (Ptr<Socket> socket)
+{
+  Ptr<Packet> p;
+  while ((p = socket->Recv ()) != 0 && p->GetSize () > 0)
+    {
+      uint32_t offset = m_rxPayload.size ();
+      NS_TEST_ASSERT_MSG_LT_OR_EQ (offset + p->GetSize (), m_txPayload.size (), "Too many bytes received");
+      m_rxPayload.resize (offset + p->GetSize ());
+      p->CopyData (&m_rxPayload[offset], p->GetSize ());
+    }
+}
+
+void
+TcpTsoTestCase::Accept (Ptr<Socket> socket, const Address &from)
+{
+  socket->SetRecvCallback (MakeCallback (&TcpTsoTestCase::Recv, this));
+}
+
+void
+TcpTsoTestCase::SendOutgoing (const Ipv4Header &header, Ptr<const Packet> packet, uint32_t interface)
+{
+  if (packet->GetSize () > 100)
+    {
+      m_sent++;
+    }
+}
+
+void
+TcpTsoTestCase::Rx (Ptr<const Packet> packet, Ptr<Ipv4> ipv4, uint32_t interface)
+{
+  if (packet->GetSize () > 100)
+    {
+      m_received++;
+    }
+  m_largest = std::max (m_largest, packet->GetSize ());
+}
+
+void
+TcpTsoTestCase::DoRun (void)
+{
+  m_txPayload.resize (500000);
+  for (uint32_t i = 0; i < m_txPayload.size (); i++)
+    {
+      m_txPayload[i] = static_cast<uint8_t> (i * 7 + i / 251);
+    }
+
+  Ptr<Node> sender = CreateObject<Node> ();
+  Ptr<Node> receiver = CreateObject<Node> ();
+  InternetStackHelper internet;
+  internet.SetIpv6StackInstall (false);
+  internet.Install (sender);
+  internet.Install (receiver);
+  Ptr<SimpleChannel> channel = CreateObject<SimpleChannel> ();
+  channel->SetAttribute ("Delay", TimeValue (MicroSeconds (50)));
+  AddDevice (sender, Ipv4Address ("10.0.0.1"))->SetChannel (channel);
+  Ptr<SimpleNetDevice> receiverDevice = AddDevice (receiver, Ipv4Address ("10.0.0.2"));
+  receiverDevice->SetChannel (channel);
+  // lose a few segments to exercise the recovery with super-segments
+  Ptr<RateErrorModel> errorModel = CreateObject<RateErrorModel> ();
+  errorModel->SetUnit (RateErrorModel::ERROR_UNIT_PACKET);
+  errorModel->SetRate (0.01);
+  errorModel->AssignStreams (1);
+  receiverDevice->SetReceiveErrorModel (errorModel);
+  sender->GetObject<Ipv4L3Protocol> ()->TraceConnectWithoutContext (
+    "SendOutgoing", MakeCallback (&TcpTsoTestCase::SendOutgoing, this));
+  receiver->GetObject<Ipv4L3Protocol> ()->TraceConnectWithoutContext (
+    "Rx", MakeCallback (&TcpTsoTestCase::Rx, this));
+
+  Ptr<Socket> server = receiver->GetObject<TcpSocketFactory> ()->CreateSocket ();
+  server->Bind (InetSocketAddress (Ipv4Address::GetAny (), 50000));
+  server->Listen ();
+  server->SetAcceptCallback (MakeNullCallback<bool, Ptr<Socket>, const Address &> (),
+                             MakeCallback (&TcpTsoTestCase::Accept, this));
+
+  Ptr<Socket> source = sender->GetObject<TcpSocketFactory> ()->CreateSocket ();
+  source->SetAttribute ("SegmentSize", UintegerValue (1448));
+  source->SetAttribute ("TsoMaxSegments", UintegerValue (16));
+  source->SetSendCallback (MakeCallback (&TcpTsoTestCase::Send, this));
+  source->Connect (InetSocketAddress (Ipv4Address ("10.0.0.2"), 50000));
+
+  Simulator::Stop (Seconds (10));
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  NS_TEST_ASSERT_MSG_EQ (m_rxPayload.size (), m_txPayload.size (), "The stream was not delivered");
+  NS_TEST_EXPECT_MSG_EQ ((m_rxPayload == m_txPayload), true, "The stream was corrupted");
+  NS_TEST_EXPECT_MSG_LT_OR_EQ (m_largest, 1500, "A packet larger than the MTU was received");
+  NS_TEST_EXPECT_MSG_LT (m_sent, m_received, "The sender did not send super-segments");
+}
+
+/**
+ * \ingroup internet-test
+ * \ingroup tests
+ *
+ * \brief TCP segmentation offload TestSuite
+ */
+class TcpTsoTestSuite : public TestSuite
+{
+public:
+  TcpTsoTestSuite () : TestSuite ("tcp-tso", UNIT)
+  {
+    AddTestCase (new TcpTsoTestCase (), TestCase::QUICK);
+  }
+};
+
+static TcpTsoTestSuite g_tcpTsoTestSuite; //!< Static variable for test initialization
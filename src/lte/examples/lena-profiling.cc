@@ -24,13 +24,69 @@
 #include "ns3/lte-module.h"
 #include "ns3/config-store.h"
 #include <ns3/buildings-module.h>
+#include <algorithm>
+#include <ctime>
 #include <iomanip>
+#include <iostream>
 #include <string>
 #include <vector>
 //#include "ns3/gtk-config-store.h"
 
 using namespace ns3;
 
+static std::vector<double> g_ttiCpu; ///< the CPU time of each TTI, in microseconds
+static std::vector<uint64_t> g_ttiEvents; ///< the number of events of each TTI
+static std::clock_t g_lastClock; ///< the CPU clock at the start of the current TTI
+static uint64_t g_lastEvents; ///< the event count at the start of the current TTI
+
+/**
+ * Record the CPU time and the events of the TTI which just ended, and
+ * schedule the end of the next one.
+ */
+static void
+ProfileTti (void)
+{
+  std::clock_t clock = std::clock ();
+  uint64_t events = Simulator::GetEventCount ();
+  g_ttiCpu.push_back (1e6 * (clock - g_lastClock) / CLOCKS_PER_SEC);
+  g_ttiEvents.push_back (events - g_lastEvents);
+  g_lastClock = clock;
+  g_lastEvents = events;
+  Simulator::Schedule (MilliSeconds (1), &ProfileTti);
+}
+
+/**
+ * Print the distribution of the CPU time and of the events per TTI.
+ * \param setupCpu the CPU time of the scenario setup, in seconds
+ */
+static void
+PrintTtiProfile (double setupCpu)
+{
+  if (g_ttiCpu.empty ())
+    {
+      return;
+    }
+  double totalCpu = 0;
+  uint64_t totalEvents = 0;
+  for (uint32_t i = 0; i < g_ttiCpu.size (); i++)
+    {
+      totalCpu += g_ttiCpu[i];
+      totalEvents += g_ttiEvents[i];
+    }
+  std::vector<double> sorted = g_ttiCpu;
+  std::sort (sorted.begin (), sorted.end ());
+  std::cout << std::fixed << std::setprecision (1)
+            << "setup CPU: " << setupCpu << " s, run CPU: " << totalCpu / 1e6
+            << " s over " << g_ttiCpu.size () << " TTIs" << std::endl
+            << "CPU per TTI (us): mean " << totalCpu / sorted.size ()
+            << ", median " << sorted[sorted.size () / 2]
+            << ", p99 " << sorted[sorted.size () * 99 / 100]
+            << ", max " << sorted.back () << std::endl
+            << "events per TTI: " << (double) totalEvents / g_ttiEvents.size ()
+            << ", CPU per event (us): " << totalCpu / std::max<uint64_t> (totalEvents, 1)
+            << std::endl;
+}
+
 int
 main (int argc, char *argv[])
 {
@@ -38,6 +94,7 @@ main (int argc, char *argv[])
   uint32_t nUe = 1;
   uint32_t nFloors = 0;
   double simTime = 1.0;
+  bool profileTti = false;
   CommandLine cmd (__FILE__);
 
   cmd.AddValue ("nEnb", "Number of eNodeBs per floor", nEnbPerFloor);
@@ -46,7 +103,9 @@ main (int argc, char *argv[])
                 nFloors);
   cmd.AddValue ("simTime", "Total duration of the simulation (in seconds)",
                 simTime);
+  cmd.AddValue ("profileTti", "Print the CPU time per TTI of the simulation", profileTti);
   cmd.Parse (argc, argv);
+  std::clock_t setupClock = std::clock ();
 
   ConfigStore inputConfig;
   inputConfig.ConfigureDefaults ();
@@ -196,8 +255,18 @@ main (int argc, char *argv[])
   Simulator::Stop (Seconds (simTime));
   lteHelper->EnableTraces ();
 
+  if (profileTti)
+    {
+      g_lastClock = std::clock ();
+      g_lastEvents = Simulator::GetEventCount ();
+      Simulator::Schedule (MilliSeconds (1), &ProfileTti);
+    }
+  double setupCpu = (double) (std::clock () - setupClock) / CLOCKS_PER_SEC;
+
   Simulator::Run ();
 
+  PrintTtiProfile (setupCpu);
+
   /*GtkConfigStore config;
   config.ConfigureAttributes ();*/
 
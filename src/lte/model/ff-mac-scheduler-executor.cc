@@ -0,0 +1,245 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ff-mac-scheduler-executor.h"
+#include <ns3/log.h>
+#include <ns3/simulator.h>
+#include <ns3/uinteger.h>
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("FfMacSchedulerExecutor");
+
+NS_OBJECT_ENSURE_REGISTERED (FfMacSchedulerExecutor);
+
+TypeId
+FfMacSchedulerExecutor::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::FfMacSchedulerExecutor")
+    .SetParent<Object> ()
+    .SetGroupName ("Lte")
+    .AddConstructor<FfMacSchedulerExecutor> ()
+    .AddAttribute ("Threads",
+                   "The number of threads, including the simulation thread, which "
+                   "compute the scheduling of the cells of a TTI; 0 to let each MAC "
+                   "call its scheduler directly.",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&FfMacSchedulerExecutor::m_threads),
+                   MakeUintegerChecker<uint32_t> ())
+  ;
+  return tid;
+}
+
+FfMacSchedulerExecutor::FfMacSchedulerExecutor ()
+  : m_scheduled (false)
+#ifdef HAVE_PTHREAD_H
+  , m_round (0),
+    m_next (0),
+    m_pending (0),
+    m_poolStop (false)
+#endif
+{
+  NS_LOG_FUNCTION (this);
+}
+
+FfMacSchedulerExecutor::~FfMacSchedulerExecutor ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+FfMacSchedulerExecutor::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+#ifdef HAVE_PTHREAD_H
+  {
+    CriticalSection cs (m_poolMutex);
+    m_poolStop = true;
+  }
+  m_poolWork.SetCondition (true);
+  m_poolWork.Broadcast ();
+  for (auto &thread : m_poolThreads)
+    {
+      thread->Join ();
+    }
+  m_poolThreads.clear ();
+#endif
+  m_jobs.clear ();
+  Object::DoDispose ();
+}
+
+Ptr<FfMacSchedulerExecutor>
+FfMacSchedulerExecutor::Get (void)
+{
+  return *DoGet ();
+}
+
+Ptr<FfMacSchedulerExecutor> *
+FfMacSchedulerExecutor::DoGet (void)
+{
+  static Ptr<FfMacSchedulerExecutor> ptr = 0;
+  if (ptr == 0)
+    {
+      ptr = CreateObject<FfMacSchedulerExecutor> ();
+      Simulator::ScheduleDestroy (&FfMacSchedulerExecutor::Delete);
+    }
+  return &ptr;
+}
+
+void
+FfMacSchedulerExecutor::Delete (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+  (*DoGet ())->Dispose ();
+  (*DoGet ()) = 0;
+}
+
+uint32_t
+FfMacSchedulerExecutor::GetThreads (void) const
+{
+  return m_threads;
+}
+
+void
+FfMacSchedulerExecutor::Submit (Callback<void> compute, Callback<void> apply)
+{
+  NS_LOG_FUNCTION (this);
+  Job job;
+  job.m_compute = compute;
+  job.m_apply = apply;
+  m_jobs.push_back (job);
+  if (!m_scheduled)
+    {
+      // the jobs are not related to the node of the first submitter
+      Simulator::ScheduleWithContext (Simulator::NO_CONTEXT, Seconds (0),
+                                      &FfMacSchedulerExecutor::Run, this);
+      m_scheduled = true;
+    }
+}
+
+void
+FfMacSchedulerExecutor::Run (void)
+{
+  NS_LOG_FUNCTION (this);
+  while (!m_jobs.empty ())
+    {
+      std::vector<Job> jobs;
+      jobs.swap (m_jobs);
+      NS_LOG_LOGIC ("round of " << jobs.size () << " jobs");
+      Compute (jobs);
+      for (auto &job : jobs)
+        {
+          job.m_apply ();
+        }
+    }
+  m_scheduled = false;
+}
+
+void
+FfMacSchedulerExecutor::Compute (std::vector<Job> &jobs)
+{
+#ifdef HAVE_PTHREAD_H
+  if (m_threads > 1 && jobs.size () > 1)
+    {
+      while (m_poolThreads.size () < m_threads - 1)
+        {
+          Ptr<SystemThread> thread = Create<SystemThread> (MakeCallback (&FfMacSchedulerExecutor::Worker, this));
+          thread->Start ();
+          m_poolThreads.push_back (thread);
+        }
+      {
+        CriticalSection cs (m_poolMutex);
+        m_round = &jobs;
+        m_next = 0;
+        m_pending = jobs.size ();
+      }
+      m_poolWork.SetCondition (true);
+      m_poolWork.Broadcast ();
+      // the simulation thread computes jobs as well, so that a lost
+      // wake-up of the workers only costs parallelism
+      while (true)
+        {
+          Job *job = 0;
+          {
+            CriticalSection cs (m_poolMutex);
+            if (m_next < jobs.size ())
+              {
+                job = &jobs[m_next++];
+              }
+          }
+          if (job == 0)
+            {
+              break;
+            }
+          job->m_compute ();
+          CriticalSection cs (m_poolMutex);
+          m_pending--;
+        }
+      while (true)
+        {
+          {
+            CriticalSection cs (m_poolMutex);
+            if (m_pending == 0)
+              {
+                m_round = 0;
+                return;
+              }
+          }
+          m_poolDone.TimedWait (10000);
+        }
+    }
+#endif
+  for (auto &job : jobs)
+    {
+      job.m_compute ();
+    }
+}
+
+#ifdef HAVE_PTHREAD_H
+void
+FfMacSchedulerExecutor::Worker (void)
+{
+  while (true)
+    {
+      Job *job = 0;
+      {
+        CriticalSection cs (m_poolMutex);
+        if (m_poolStop)
+          {
+            return;
+          }
+        if (m_round != 0 && m_next < m_round->size ())
+          {
+            job = &(*m_round)[m_next++];
+          }
+      }
+      if (job == 0)
+        {
+          m_poolWork.TimedWait (1000000);
+          continue;
+        }
+      job->m_compute ();
+      {
+        CriticalSection cs (m_poolMutex);
+        m_pending--;
+      }
+      m_poolDone.SetCondition (true);
+      m_poolDone.Broadcast ();
+    }
+}
+#endif
+
+} // namespace ns3
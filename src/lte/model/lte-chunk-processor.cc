@@ -21,6 +21,7 @@
  */
 
 
+#include <algorithm>
 #include <ns3/log.h>
 #include <ns3/spectrum-value.h>
 #include "lte-chunk-processor.h"
@@ -50,7 +51,7 @@ void
 LteChunkProcessor::Start ()
 {
   NS_LOG_FUNCTION (this);
-  m_sumValues = 0;
+  // m_sumValues is cleared by the first chunk, so as to reuse its storage
   m_totDuration = MicroSeconds (0);
 }
 
@@ -59,11 +60,24 @@ void
 LteChunkProcessor::EvaluateChunk (const SpectrumValue& sinr, Time duration)
 {
   NS_LOG_FUNCTION (this << sinr << duration);
-  if (m_sumValues == 0)
+  if (m_sumValues == 0 || m_sumValues->GetSpectrumModel () != sinr.GetSpectrumModel ())
     {
       m_sumValues = Create<SpectrumValue> (sinr.GetSpectrumModel ());
+      m_meanValues = Create<SpectrumValue> (sinr.GetSpectrumModel ());
+    }
+  else if (m_totDuration.IsZero ())
+    {
+      std::fill (m_sumValues->ValuesBegin (), m_sumValues->ValuesEnd (), 0.0);
+    }
+  // m_sumValues += sinr * duration, in place
+  const double seconds = duration.GetSeconds ();
+  const uint32_t n = sinr.GetValuesN ();
+  const double *values = &(*sinr.ConstValuesBegin ());
+  double *sum = &(*m_sumValues->ValuesBegin ());
+  for (uint32_t i = 0; i < n; i++)
+    {
+      sum[i] += values[i] * seconds;
     }
-  (*m_sumValues) += sinr * duration.GetSeconds ();
   m_totDuration += duration;
 }
 
@@ -73,10 +87,18 @@ LteChunkProcessor::End ()
   NS_LOG_FUNCTION (this);
   if (m_totDuration.GetSeconds () > 0)
     {
+      const double seconds = m_totDuration.GetSeconds ();
+      const uint32_t n = m_sumValues->GetValuesN ();
+      const double *sum = &(*m_sumValues->ConstValuesBegin ());
+      double *mean = &(*m_meanValues->ValuesBegin ());
+      for (uint32_t i = 0; i < n; i++)
+        {
+          mean[i] = sum[i] / seconds;
+        }
       std::vector<LteChunkProcessorCallback>::iterator it;
       for (it = m_lteChunkProcessorCallbacks.begin (); it != m_lteChunkProcessorCallbacks.end (); it++)
         {
-          (*it)((*m_sumValues) / m_totDuration.GetSeconds ());
+          (*it)(*m_meanValues);
         }
     }
   else
@@ -88,7 +88,8 @@ public:
   virtual void End ();
 
 private:
-  Ptr<SpectrumValue> m_sumValues; ///< sum values
+  Ptr<SpectrumValue> m_sumValues; ///< sum values, reused across receptions
+  Ptr<SpectrumValue> m_meanValues; ///< mean values reported by End, reused across receptions
   Time m_totDuration; ///< total duration
 
   std::vector<LteChunkProcessorCallback> m_lteChunkProcessorCallbacks; ///< chunk processor callback
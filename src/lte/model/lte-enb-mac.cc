@@ -27,6 +27,7 @@
 #include <ns3/pointer.h>
 #include <ns3/packet.h>
 #include <ns3/simulator.h>
+#include <ns3/make-event.h>
 
 #include "lte-amc.h"
 #include "lte-control-messages.h"
@@ -34,6 +35,7 @@
 #include "lte-ue-net-device.h"
 
 #include <ns3/lte-enb-mac.h>
+#include <ns3/ff-mac-scheduler-executor.h>
 #include <ns3/lte-radio-bearer-tag.h>
 #include <ns3/lte-ue-phy.h>
 
@@ -171,6 +173,11 @@ EnbMacMemberFfMacSchedSapUser::EnbMacMemberFfMacSchedSapUser (LteEnbMac* mac)
 void
 EnbMacMemberFfMacSchedSapUser::SchedDlConfigInd (const struct SchedDlConfigIndParameters& params)
 {
+  if (m_mac->m_schedulingState == LteEnbMac::SCHEDULING_COMPUTING)
+    {
+      m_mac->m_dlConfigInds.push_back (params);
+      return;
+    }
   m_mac->DoSchedDlConfigInd (params);
 }
 
@@ -179,6 +186,11 @@ EnbMacMemberFfMacSchedSapUser::SchedDlConfigInd (const struct SchedDlConfigIndPa
 void
 EnbMacMemberFfMacSchedSapUser::SchedUlConfigInd (const struct SchedUlConfigIndParameters& params)
 {
+  if (m_mac->m_schedulingState == LteEnbMac::SCHEDULING_COMPUTING)
+    {
+      m_mac->m_ulConfigInds.push_back (params);
+      return;
+    }
   m_mac->DoSchedUlConfigInd (params);
 }
 
@@ -380,7 +392,8 @@ LteEnbMac::GetTypeId (void)
 
 
 LteEnbMac::LteEnbMac ():
-m_ccmMacSapUser (0)
+m_ccmMacSapUser (0),
+m_schedulingState (SCHEDULING_IDLE)
 {
   NS_LOG_FUNCTION (this);
   m_macSapProvider = new EnbMacMemberLteMacSapProvider<LteEnbMac> (this);
@@ -407,6 +420,12 @@ LteEnbMac::DoDispose ()
   m_dlInfoListReceived.clear ();
   m_ulInfoListReceived.clear ();
   m_miDlHarqProcessesPackets.clear ();
+  m_pendingUlCqi.clear ();
+  m_pendingUlCe.clear ();
+  m_pendingUlInfoList.clear ();
+  m_dlConfigInds.clear ();
+  m_ulConfigInds.clear ();
+  m_deferredCalls.clear ();
   delete m_macSapProvider;
   delete m_cmacSapProvider;
   delete m_schedSapUser;
@@ -585,32 +604,53 @@ LteEnbMac::DoSubframeIndication (uint32_t frameNo, uint32_t subframeNo)
       m_dlInfoListReceived.clear ();
     }
 
-  m_schedSapProvider->SchedDlTriggerReq (dlparams);
+  if (FfMacSchedulerExecutor::Get ()->GetThreads () > 0)
+    {
+      // the UL-CQIs, BSRs and HARQ feedbacks received from now on belong
+      // to the next subframe, as when the scheduler is called directly
+      m_pendingDlTrigger = dlparams;
+      m_pendingUlCqi.swap (m_ulCqiReceived);
+      m_pendingUlCe.swap (m_ulCeReceived);
+      m_pendingUlInfoList.swap (m_ulInfoListReceived);
+      m_schedulingState = SCHEDULING_PENDING;
+      FfMacSchedulerExecutor::Get ()->Submit (MakeCallback (&LteEnbMac::ComputeDlSchedule, this),
+                                              MakeCallback (&LteEnbMac::ApplyDlSchedule, this));
+      return;
+    }
 
+  m_schedSapProvider->SchedDlTriggerReq (dlparams);
 
   // --- UPLINK ---
+  m_schedSapProvider->SchedUlTriggerReq (PrepareUlTrigger (m_ulCqiReceived, m_ulCeReceived, m_ulInfoListReceived));
+}
+
+FfMacSchedSapProvider::SchedUlTriggerReqParameters
+LteEnbMac::PrepareUlTrigger (std::vector <FfMacSchedSapProvider::SchedUlCqiInfoReqParameters> &ulCqi,
+                             std::vector <MacCeListElement_s> &ulCe,
+                             std::vector <UlInfoListElement_s> &ulInfoList)
+{
   // Send UL-CQI info to the scheduler
-  for (uint16_t i = 0; i < m_ulCqiReceived.size (); i++)
+  for (uint16_t i = 0; i < ulCqi.size (); i++)
     {
-      if (subframeNo > 1)
+      if (m_subframeNo > 1)
         {        
-          m_ulCqiReceived.at (i).m_sfnSf = ((0x3FF & frameNo) << 4) | (0xF & (subframeNo - 1));
+          ulCqi.at (i).m_sfnSf = ((0x3FF & m_frameNo) << 4) | (0xF & (m_subframeNo - 1));
         }
       else
         {
-          m_ulCqiReceived.at (i).m_sfnSf = ((0x3FF & (frameNo - 1)) << 4) | (0xF & 10);
+          ulCqi.at (i).m_sfnSf = ((0x3FF & (m_frameNo - 1)) << 4) | (0xF & 10);
         }
-      m_schedSapProvider->SchedUlCqiInfoReq (m_ulCqiReceived.at (i));
+      m_schedSapProvider->SchedUlCqiInfoReq (ulCqi.at (i));
     }
-    m_ulCqiReceived.clear ();
+    ulCqi.clear ();
   
   // Send BSR reports to the scheduler
-  if (m_ulCeReceived.size () > 0)
+  if (ulCe.size () > 0)
     {
       FfMacSchedSapProvider::SchedUlMacCtrlInfoReqParameters ulMacReq;
-      ulMacReq.m_sfnSf = ((0x3FF & frameNo) << 4) | (0xF & subframeNo);
-      ulMacReq.m_macCeList.insert (ulMacReq.m_macCeList.begin (), m_ulCeReceived.begin (), m_ulCeReceived.end ());
-      m_ulCeReceived.erase (m_ulCeReceived.begin (), m_ulCeReceived.end ());
+      ulMacReq.m_sfnSf = ((0x3FF & m_frameNo) << 4) | (0xF & m_subframeNo);
+      ulMacReq.m_macCeList.insert (ulMacReq.m_macCeList.begin (), ulCe.begin (), ulCe.end ());
+      ulCe.erase (ulCe.begin (), ulCe.end ());
       m_schedSapProvider->SchedUlMacCtrlInfoReq (ulMacReq);
     }
 
@@ -632,15 +672,73 @@ LteEnbMac::DoSubframeIndication (uint32_t frameNo, uint32_t subframeNo)
   ulparams.m_sfnSf = ((0x3FF & ulSchedFrameNo) << 4) | (0xF & ulSchedSubframeNo);
 
   // Forward DL HARQ feebacks collected during last TTI
-  if (m_ulInfoListReceived.size () > 0)
+  if (ulInfoList.size () > 0)
     {
-     ulparams.m_ulInfoList = m_ulInfoListReceived;
+     ulparams.m_ulInfoList = ulInfoList;
       // empty local buffer
-      m_ulInfoListReceived.clear ();
+      ulInfoList.clear ();
     }
 
-  m_schedSapProvider->SchedUlTriggerReq (ulparams);
+  return ulparams;
+}
 
+void
+LteEnbMac::ComputeDlSchedule (void)
+{
+  // run by any thread: the indications are buffered until ApplyDlSchedule
+  m_schedulingState = SCHEDULING_COMPUTING;
+  m_schedSapProvider->SchedDlTriggerReq (m_pendingDlTrigger);
+  m_schedulingState = SCHEDULING_PENDING;
+}
+
+void
+LteEnbMac::ApplyDlSchedule (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_schedulingState = SCHEDULING_IDLE;
+  for (std::vector <FfMacSchedSapUser::SchedDlConfigIndParameters>::iterator it = m_dlConfigInds.begin ();
+       it != m_dlConfigInds.end (); ++it)
+    {
+      DoSchedDlConfigInd (*it);
+    }
+  m_dlConfigInds.clear ();
+
+  // --- UPLINK ---
+  m_pendingUlTrigger = PrepareUlTrigger (m_pendingUlCqi, m_pendingUlCe, m_pendingUlInfoList);
+  m_schedulingState = SCHEDULING_PENDING;
+  FfMacSchedulerExecutor::Get ()->Submit (MakeCallback (&LteEnbMac::ComputeUlSchedule, this),
+                                          MakeCallback (&LteEnbMac::ApplyUlSchedule, this));
+}
+
+void
+LteEnbMac::ComputeUlSchedule (void)
+{
+  // run by any thread: the indications are buffered until ApplyUlSchedule
+  m_schedulingState = SCHEDULING_COMPUTING;
+  m_schedSapProvider->SchedUlTriggerReq (m_pendingUlTrigger);
+  m_schedulingState = SCHEDULING_PENDING;
+}
+
+void
+LteEnbMac::ApplyUlSchedule (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_schedulingState = SCHEDULING_IDLE;
+  for (std::vector <FfMacSchedSapUser::SchedUlConfigIndParameters>::iterator it = m_ulConfigInds.begin ();
+       it != m_ulConfigInds.end (); ++it)
+    {
+      DoSchedUlConfigInd (*it);
+    }
+  m_ulConfigInds.clear ();
+
+  // replay the calls received while the subframe was being scheduled
+  std::vector <Ptr<EventImpl> > deferredCalls;
+  deferredCalls.swap (m_deferredCalls);
+  for (std::vector <Ptr<EventImpl> >::iterator it = deferredCalls.begin ();
+       it != deferredCalls.end (); ++it)
+    {
+      (*it)->Invoke ();
+    }
 }
 
 
@@ -806,6 +904,13 @@ void
 LteEnbMac::DoAddUe (uint16_t rnti)
 {
   NS_LOG_FUNCTION (this << " rnti=" << rnti);
+  if (m_schedulingState == SCHEDULING_PENDING)
+    {
+      // wait for the end of the scheduling of the subframe, as if the
+      // scheduler had been called directly
+      m_deferredCalls.push_back (Ptr<EventImpl> (MakeEvent (&LteEnbMac::DoAddUe, this, rnti), false));
+      return;
+    }
   std::map<uint8_t, LteMacSapUser*> empty;
   std::pair <std::map <uint16_t, std::map<uint8_t, LteMacSapUser*> >::iterator, bool> 
     ret = m_rlcAttached.insert (std::pair <uint16_t,  std::map<uint8_t, LteMacSapUser*> > 
@@ -843,6 +948,13 @@ void
 LteEnbMac::DoRemoveUe (uint16_t rnti)
 {
   NS_LOG_FUNCTION (this << " rnti=" << rnti);
+  if (m_schedulingState == SCHEDULING_PENDING)
+    {
+      // wait for the end of the scheduling of the subframe, as if the
+      // scheduler had been called directly
+      m_deferredCalls.push_back (Ptr<EventImpl> (MakeEvent (&LteEnbMac::DoRemoveUe, this, rnti), false));
+      return;
+    }
   FfMacCschedSapProvider::CschedUeReleaseReqParameters params;
   params.m_rnti = rnti;
   m_cschedSapProvider->CschedUeReleaseReq (params);
@@ -887,6 +999,13 @@ void
 LteEnbMac::DoAddLc (LteEnbCmacSapProvider::LcInfo lcinfo, LteMacSapUser* msu)
 {
   NS_LOG_FUNCTION (this << lcinfo.rnti << (uint16_t) lcinfo.lcId);
+  if (m_schedulingState == SCHEDULING_PENDING)
+    {
+      // wait for the end of the scheduling of the subframe, as if the
+      // scheduler had been called directly
+      m_deferredCalls.push_back (Ptr<EventImpl> (MakeEvent (&LteEnbMac::DoAddLc, this, lcinfo, msu), false));
+      return;
+    }
 
   std::map <LteFlowId_t, LteMacSapUser* >::iterator it;
   
@@ -940,6 +1059,13 @@ void
 LteEnbMac::DoReleaseLc (uint16_t rnti, uint8_t lcid)
 {
   NS_LOG_FUNCTION (this);
+  if (m_schedulingState == SCHEDULING_PENDING)
+    {
+      // wait for the end of the scheduling of the subframe, as if the
+      // scheduler had been called directly
+      m_deferredCalls.push_back (Ptr<EventImpl> (MakeEvent (&LteEnbMac::DoReleaseLc, this, rnti, lcid), false));
+      return;
+    }
 
   //Find user based on rnti and then erase lcid stored against the same
   std::map <uint16_t, std::map<uint8_t, LteMacSapUser*> >::iterator rntiIt = m_rlcAttached.find (rnti);
@@ -955,6 +1081,13 @@ void
 LteEnbMac::DoUeUpdateConfigurationReq (LteEnbCmacSapProvider::UeConfig params)
 {
   NS_LOG_FUNCTION (this);
+  if (m_schedulingState == SCHEDULING_PENDING)
+    {
+      // wait for the end of the scheduling of the subframe, as if the
+      // scheduler had been called directly
+      m_deferredCalls.push_back (Ptr<EventImpl> (MakeEvent (&LteEnbMac::DoUeUpdateConfigurationReq, this, params), false));
+      return;
+    }
 
   // propagates to scheduler
   FfMacCschedSapProvider::CschedUeConfigReqParameters req;
@@ -1061,6 +1194,13 @@ void
 LteEnbMac::DoReportBufferStatus (LteMacSapProvider::ReportBufferStatusParameters params)
 {
   NS_LOG_FUNCTION (this);
+  if (m_schedulingState == SCHEDULING_PENDING)
+    {
+      // wait for the end of the scheduling of the subframe, as if the
+      // scheduler had been called directly
+      m_deferredCalls.push_back (Ptr<EventImpl> (MakeEvent (&LteEnbMac::DoReportBufferStatus, this, params), false));
+      return;
+    }
   FfMacSchedSapProvider::SchedDlRlcBufferReqParameters req;
   req.m_rnti = params.rnti;
   req.m_logicalChannelIdentity = params.lcid;
@@ -38,6 +38,7 @@
 #include "ns3/trace-source-accessor.h"
 #include <ns3/packet.h>
 #include <ns3/packet-burst.h>
+#include <ns3/event-impl.h>
 #include <ns3/lte-ccm-mac-sap.h>
 
 namespace ns3 {
@@ -332,6 +333,38 @@ private:
   */
   void DoSubframeIndication (uint32_t frameNo, uint32_t subframeNo);
   /**
+  * \brief Send the UL-CQIs and BSRs of a subframe to the scheduler, and
+  * build its UL trigger
+  * \param ulCqi the UL-CQIs received, emptied
+  * \param ulCe the BSRs received, emptied
+  * \param ulInfoList the UL HARQ feedbacks received, emptied
+  * \return the UL trigger of the current subframe
+  */
+  FfMacSchedSapProvider::SchedUlTriggerReqParameters
+  PrepareUlTrigger (std::vector <FfMacSchedSapProvider::SchedUlCqiInfoReqParameters> &ulCqi,
+                    std::vector <MacCeListElement_s> &ulCe,
+                    std::vector <UlInfoListElement_s> &ulInfoList);
+  /**
+  * \brief Run the pending DL trigger; called by the FfMacSchedulerExecutor
+  * from any thread
+  */
+  void ComputeDlSchedule (void);
+  /**
+  * \brief Apply the result of the pending DL trigger and submit the UL
+  * one; called by the FfMacSchedulerExecutor
+  */
+  void ApplyDlSchedule (void);
+  /**
+  * \brief Run the pending UL trigger; called by the FfMacSchedulerExecutor
+  * from any thread
+  */
+  void ComputeUlSchedule (void);
+  /**
+  * \brief Apply the result of the pending UL trigger and replay the
+  * deferred calls; called by the FfMacSchedulerExecutor
+  */
+  void ApplyUlSchedule (void);
+  /**
   * \brief Receive RACH Preamble function
   * \param prachId PRACH ID number
   */
@@ -466,6 +499,23 @@ private:
 
   /// component carrier Id used to address sap
   uint8_t m_componentCarrierId;
+
+  /// State of the scheduling of the current subframe by the FfMacSchedulerExecutor
+  enum SchedulingState
+  {
+    SCHEDULING_IDLE,      ///< the scheduler is called directly
+    SCHEDULING_PENDING,   ///< a trigger is pending: the calls which reach the scheduler are deferred
+    SCHEDULING_COMPUTING  ///< a trigger is being run: the indications of the scheduler are buffered
+  };
+  SchedulingState m_schedulingState; ///< the state of the scheduling of the current subframe
+  FfMacSchedSapProvider::SchedDlTriggerReqParameters m_pendingDlTrigger; ///< the pending DL trigger
+  FfMacSchedSapProvider::SchedUlTriggerReqParameters m_pendingUlTrigger; ///< the pending UL trigger
+  std::vector <FfMacSchedSapProvider::SchedUlCqiInfoReqParameters> m_pendingUlCqi; ///< UL-CQI of the pending subframe
+  std::vector <MacCeListElement_s> m_pendingUlCe; ///< CE of the pending subframe
+  std::vector <UlInfoListElement_s> m_pendingUlInfoList; ///< UL HARQ feedback of the pending subframe
+  std::vector <FfMacSchedSapUser::SchedDlConfigIndParameters> m_dlConfigInds; ///< buffered DL indications
+  std::vector <FfMacSchedSapUser::SchedUlConfigIndParameters> m_ulConfigInds; ///< buffered UL indications
+  std::vector <Ptr<EventImpl> > m_deferredCalls; ///< calls deferred to the end of the scheduling
  
 };
 
@@ -75,7 +75,15 @@ LteInterference::StartRx (Ptr<const SpectrumValue> rxPsd)
   if (m_receiving == false)
     {
       NS_LOG_LOGIC ("first signal");
-      m_rxSignal = rxPsd->Copy ();
+      if (m_rxSignal == 0)
+        {
+          m_rxSignal = rxPsd->Copy ();
+        }
+      else
+        {
+          // reuse the storage of the previous signal
+          *m_rxSignal = *rxPsd;
+        }
       m_lastChangeTime = Now ();
       m_receiving = true;
       for (std::list<Ptr<LteChunkProcessor> >::const_iterator it = m_rsPowerChunkProcessorList.begin (); it != m_rsPowerChunkProcessorList.end (); ++it)
@@ -188,17 +196,30 @@ LteInterference::ConditionallyEvaluateChunk ()
     {
       NS_LOG_LOGIC (this << " signal = " << *m_rxSignal << " allSignals = " << *m_allSignals << " noise = " << *m_noise);
 
-      SpectrumValue interf =  (*m_allSignals) - (*m_rxSignal) + (*m_noise);
+      // interf = allSignals - rxSignal + noise and sinr = rxSignal / interf,
+      // evaluated in place in the workspaces allocated with the noise
+      NS_ASSERT (m_rxSignal->GetSpectrumModel () == m_noise->GetSpectrumModel ());
+      NS_ASSERT (m_allSignals->GetSpectrumModel () == m_noise->GetSpectrumModel ());
+      const uint32_t n = m_noise->GetValuesN ();
+      const double *all = &(*m_allSignals->ConstValuesBegin ());
+      const double *rx = &(*m_rxSignal->ConstValuesBegin ());
+      const double *noise = &(*m_noise->ConstValuesBegin ());
+      double *interf = &(*m_interf.ValuesBegin ());
+      double *sinr = &(*m_sinr.ValuesBegin ());
+      for (uint32_t i = 0; i < n; i++)
+        {
+          interf[i] = all[i] - rx[i] + noise[i];
+          sinr[i] = rx[i] / interf[i];
+        }
 
-      SpectrumValue sinr = (*m_rxSignal) / interf;
       Time duration = Now () - m_lastChangeTime;
       for (std::list<Ptr<LteChunkProcessor> >::const_iterator it = m_sinrChunkProcessorList.begin (); it != m_sinrChunkProcessorList.end (); ++it)
         {
-          (*it)->EvaluateChunk (sinr, duration);
+          (*it)->EvaluateChunk (m_sinr, duration);
         }
       for (std::list<Ptr<LteChunkProcessor> >::const_iterator it = m_interfChunkProcessorList.begin (); it != m_interfChunkProcessorList.end (); ++it)
         {
-          (*it)->EvaluateChunk (interf, duration);
+          (*it)->EvaluateChunk (m_interf, duration);
         }
       for (std::list<Ptr<LteChunkProcessor> >::const_iterator it = m_rsPowerChunkProcessorList.begin (); it != m_rsPowerChunkProcessorList.end (); ++it)
         {
@@ -217,6 +238,8 @@ LteInterference::SetNoisePowerSpectralDensity (Ptr<const SpectrumValue> noisePsd
   // reset m_allSignals (will reset if already set previously)
   // this is needed since this method can potentially change the SpectrumModel
   m_allSignals = Create<SpectrumValue> (noisePsd->GetSpectrumModel ());
+  m_interf = SpectrumValue (noisePsd->GetSpectrumModel ());
+  m_sinr = SpectrumValue (noisePsd->GetSpectrumModel ());
   if (m_receiving == true)
     {
       // abort rx
@@ -0,0 +1,240 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <map>
+#include <sstream>
+#include <ns3/log.h>
+#include <ns3/test.h>
+#include <ns3/simulator.h>
+#include <ns3/config.h>
+#include <ns3/rng-seed-manager.h>
+#include <ns3/boolean.h>
+#include <ns3/string.h>
+#include <ns3/uinteger.h>
+#include <ns3/node-container.h>
+#include <ns3/net-device-container.h>
+#include <ns3/mobility-helper.h>
+#include <ns3/position-allocator.h>
+#include <ns3/eps-bearer.h>
+#include <ns3/lte-helper.h>
+#include <ns3/lte-common.h>
+#include <ns3/ff-mac-scheduler-executor.h>
+
+using namespace ns3;
+
+NS_LOG_COMPONENT_DEFINE ("LteSchedulerExecutorTest");
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Checks that the scheduling of the cells of a TTI by the
+ * FfMacSchedulerExecutor gives the same DL and UL allocations as the
+ * direct calls of the schedulers by the MACs, whatever the number of
+ * threads.
+ *
+ * Two interfering eNBs serve three saturated UEs each, with the error
+ * models enabled so that HARQ retransmissions are scheduled too.  The
+ * allocations of each cell are compared in their order; the order of
+ * the trace calls of different cells differs, since the executor
+ * applies the DL allocations of all the cells before the UL ones.
+ * With carrier aggregation, the component carriers of an eNB share the
+ * RLC entities of its UEs, so that the allocations computed in parallel
+ * may differ from the direct calls; the test then only checks that
+ * they do not depend on the number of threads.
+ */
+class LteSchedulerExecutorTestCase : public TestCase
+{
+public:
+  /**
+   * Constructor
+   * \param scheduler the type of the scheduler
+   * \param carriers the number of component carriers
+   */
+  LteSchedulerExecutorTestCase (std::string scheduler, uint16_t carriers);
+
+private:
+  virtual void DoRun (void);
+
+  /**
+   * Run the scenario once.
+   * \param threads the value of FfMacSchedulerExecutor::Threads
+   * \return the DL and UL allocations of each cell, by trace path
+   */
+  std::map<std::string, std::string> RunOne (uint32_t threads);
+
+  /**
+   * DL scheduling trace sink.
+   * \param path the context of the trace source
+   * \param info the allocation
+   */
+  void DlScheduling (std::string path, DlSchedulingCallbackInfo info);
+  /**
+   * UL scheduling trace sink.
+   * \param path the context of the trace source
+   * \param frameNo the frame number
+   * \param subframeNo the subframe number
+   * \param rnti the RNTI
+   * \param mcs the MCS
+   * \param size the size of the TB
+   * \param ccId the component carrier ID
+   */
+  void UlScheduling (std::string path, uint32_t frameNo, uint32_t subframeNo,
+                     uint16_t rnti, uint8_t mcs, uint16_t size, uint8_t ccId);
+
+  std::string m_scheduler; ///< the type of the scheduler
+  uint16_t m_carriers; ///< the number of component carriers
+  std::map<std::string, std::string> m_allocations; ///< the allocations of each cell of the current run
+  uint64_t m_dlBytes; ///< the bytes allocated in DL by the current run
+  uint64_t m_ulBytes; ///< the bytes allocated in UL by the current run
+};
+
+LteSchedulerExecutorTestCase::LteSchedulerExecutorTestCase (std::string scheduler, uint16_t carriers)
+  : TestCase (scheduler + ", " + std::to_string (carriers) + " component carrier(s)"),
+    m_scheduler (scheduler),
+    m_carriers (carriers),
+    m_dlBytes (0),
+    m_ulBytes (0)
+{
+}
+
+void
+LteSchedulerExecutorTestCase::DlScheduling (std::string path, DlSchedulingCallbackInfo info)
+{
+  std::ostringstream oss;
+  oss << Simulator::Now ().GetTimeStep () << " DL " << info.frameNo << " " << info.subframeNo
+      << " " << info.rnti << " " << (uint32_t) info.mcsTb1 << " " << info.sizeTb1
+      << " " << (uint32_t) info.mcsTb2 << " " << info.sizeTb2 << "\n";
+  m_allocations[path] += oss.str ();
+  m_dlBytes += info.sizeTb1 + info.sizeTb2;
+}
+
+void
+LteSchedulerExecutorTestCase::UlScheduling (std::string path, uint32_t frameNo, uint32_t subframeNo,
+                                            uint16_t rnti, uint8_t mcs, uint16_t size, uint8_t ccId)
+{
+  std::ostringstream oss;
+  oss << Simulator::Now ().GetTimeStep () << " UL " << frameNo << " " << subframeNo
+      << " " << rnti << " " << (uint32_t) mcs << " " << size << "\n";
+  // the UL trace source of a cell has the path of its DL one
+  m_allocations[path.substr (0, path.rfind ('/')) + "/DlScheduling"] += oss.str ();
+  m_ulBytes += size;
+}
+
+std::map<std::string, std::string>
+LteSchedulerExecutorTestCase::RunOne (uint32_t threads)
+{
+  m_allocations.clear ();
+  m_dlBytes = 0;
+  m_ulBytes = 0;
+  Config::SetDefault ("ns3::FfMacSchedulerExecutor::Threads", UintegerValue (threads));
+  Config::SetDefault ("ns3::LteHelper::UseIdealRrc", BooleanValue (true));
+  Config::SetDefault ("ns3::LteHelper::UseCa", BooleanValue (m_carriers > 1));
+  Config::SetDefault ("ns3::LteHelper::NumberOfComponentCarriers", UintegerValue (m_carriers));
+  Config::SetDefault ("ns3::LteHelper::EnbComponentCarrierManager",
+                      StringValue ("ns3::RrComponentCarrierManager"));
+  RngSeedManager::SetSeed (1);
+  RngSeedManager::SetRun (1);
+
+  Ptr<LteHelper> lteHelper = CreateObject<LteHelper> ();
+  lteHelper->SetAttribute ("PathlossModel", StringValue ("ns3::FriisSpectrumPropagationLossModel"));
+  lteHelper->SetSchedulerType (m_scheduler);
+
+  NodeContainer enbNodes;
+  enbNodes.Create (2);
+  NodeContainer ueNodes;
+  ueNodes.Create (6);
+
+  MobilityHelper mobility;
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  Ptr<ListPositionAllocator> enbPositions = CreateObject<ListPositionAllocator> ();
+  Ptr<ListPositionAllocator> uePositions = CreateObject<ListPositionAllocator> ();
+  for (uint32_t i = 0; i < enbNodes.GetN (); i++)
+    {
+      enbPositions->Add (Vector (i * 1000.0, 0.0, 0.0));
+      for (uint32_t j = 0; j < 3; j++)
+        {
+          uePositions->Add (Vector (i * 1000.0 + 100.0 + j * 100.0, 50.0, 0.0));
+        }
+    }
+  mobility.SetPositionAllocator (enbPositions);
+  mobility.Install (enbNodes);
+  mobility.SetPositionAllocator (uePositions);
+  mobility.Install (ueNodes);
+
+  NetDeviceContainer enbDevs = lteHelper->InstallEnbDevice (enbNodes);
+  NetDeviceContainer ueDevs = lteHelper->InstallUeDevice (ueNodes);
+  lteHelper->AssignStreams (enbDevs, 1);
+  lteHelper->AssignStreams (ueDevs, 1000);
+  for (uint32_t i = 0; i < ueDevs.GetN (); i++)
+    {
+      lteHelper->Attach (ueDevs.Get (i), enbDevs.Get (i / 3));
+    }
+  lteHelper->ActivateDataRadioBearer (ueDevs, EpsBearer (EpsBearer::NGBR_VIDEO_TCP_DEFAULT));
+
+  Config::Connect ("/NodeList/*/DeviceList/*/ComponentCarrierMap/*/LteEnbMac/DlScheduling",
+                   MakeCallback (&LteSchedulerExecutorTestCase::DlScheduling, this));
+  Config::Connect ("/NodeList/*/DeviceList/*/ComponentCarrierMap/*/LteEnbMac/UlScheduling",
+                   MakeCallback (&LteSchedulerExecutorTestCase::UlScheduling, this));
+
+  Simulator::Stop (Seconds (0.15));
+  Simulator::Run ();
+  Simulator::Destroy ();
+  Config::SetDefault ("ns3::FfMacSchedulerExecutor::Threads", UintegerValue (0));
+  Config::SetDefault ("ns3::LteHelper::UseCa", BooleanValue (false));
+  Config::SetDefault ("ns3::LteHelper::NumberOfComponentCarriers", UintegerValue (1));
+
+  NS_TEST_EXPECT_MSG_GT (m_dlBytes, 0, "no DL allocation with " << threads << " thread(s)");
+  NS_TEST_EXPECT_MSG_GT (m_ulBytes, 0, "no UL allocation with " << threads << " thread(s)");
+  return m_allocations;
+}
+
+void
+LteSchedulerExecutorTestCase::DoRun (void)
+{
+  std::map<std::string, std::string> parallel = RunOne (1);
+  NS_TEST_ASSERT_MSG_EQ ((RunOne (3) == parallel), true,
+                         "the allocations depend on the number of threads");
+  if (m_carriers == 1)
+    {
+      NS_TEST_ASSERT_MSG_EQ ((RunOne (0) == parallel), true,
+                             "the allocations differ from the direct calls of the schedulers");
+    }
+}
+
+/**
+ * \ingroup lte-test
+ * \ingroup tests
+ *
+ * \brief Test suite of the FfMacSchedulerExecutor.
+ */
+class LteSchedulerExecutorTestSuite : public TestSuite
+{
+public:
+  LteSchedulerExecutorTestSuite ();
+};
+
+LteSchedulerExecutorTestSuite::LteSchedulerExecutorTestSuite ()
+  : TestSuite ("lte-scheduler-executor", SYSTEM)
+{
+  AddTestCase (new LteSchedulerExecutorTestCase ("ns3::PfFfMacScheduler", 1), TestCase::QUICK);
+  AddTestCase (new LteSchedulerExecutorTestCase ("ns3::CqaFfMacScheduler", 1), TestCase::QUICK);
+  AddTestCase (new LteSchedulerExecutorTestCase ("ns3::PssFfMacScheduler", 1), TestCase::QUICK);
+  AddTestCase (new LteSchedulerExecutorTestCase ("ns3::FdTbfqFfMacScheduler", 1), TestCase::QUICK);
+  AddTestCase (new LteSchedulerExecutorTestCase ("ns3::PfFfMacScheduler", 2), TestCase::QUICK);
+}
+
+static LteSchedulerExecutorTestSuite g_lteSchedulerExecutorTestSuite; ///< the test suite
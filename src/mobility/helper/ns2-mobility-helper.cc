@@ -47,6 +47,7 @@
 #include "ns3/node-list.h"
 #include "ns3/node.h"
 #include "ns3/constant-velocity-mobility-model.h"
+#include "ns3/waypoint-trace-file.h"
 #include "ns2-mobility-helper.h"
 
 namespace ns3 {
@@ -189,6 +190,16 @@ static bool IsSchedSetPos (ParseResult pr);
  */
 static bool IsSchedMobilityPos (ParseResult pr);
 
+/**
+ * Get the position of a node at a given time, and drop its waypoints
+ * after that time, as when a movement is interrupted by a new command.
+ * On return, the last waypoint is at the given time.
+ * \param waypoints the waypoints of the node, starting at time zero
+ * \param at the time of the new command
+ * \returns the position of the node at the given time
+ */
+static Vector CutWaypoints (std::vector<WaypointTraceRecord> &waypoints, double at);
+
 /**
  * Set waypoints and speed for movement.
  * \param model mobility model
@@ -853,4 +864,156 @@ Ns2MobilityHelper::Install (void) const
   Install (NodeList::Begin (), NodeList::End ());
 }
 
+Vector
+CutWaypoints (std::vector<WaypointTraceRecord> &waypoints, double at)
+{
+  WaypointTraceRecord after = waypoints.back ();
+  bool cut = false;
+  while (waypoints.size () > 1 && waypoints.back ().time > at)
+    {
+      after = waypoints.back ();
+      waypoints.pop_back ();
+      cut = true;
+    }
+  const WaypointTraceRecord &before = waypoints.back ();
+  Vector position (before.x, before.y, before.z);
+  if (cut)
+    {
+      double k = (at - before.time) / (after.time - before.time);
+      position.x += k * (after.x - before.x);
+      position.y += k * (after.y - before.y);
+      position.z += k * (after.z - before.z);
+    }
+  if (before.time < at)
+    {
+      WaypointTraceRecord record = { at, position.x, position.y, position.z };
+      waypoints.push_back (record);
+    }
+  return position;
+}
+
+void
+Ns2MobilityHelper::ConvertToWaypointTrace (std::string filename) const
+{
+  NS_LOG_FUNCTION (this << filename);
+  // A scheduled set of a coordinate is a jump, which the waypoints model
+  // as a move of one nanosecond.
+  const double jump = 1e-9;
+  std::vector<Vector> initial;
+  std::vector<bool> positioned;
+  std::vector<std::vector<WaypointTraceRecord> > waypoints;
+
+  // As in ConfigNodesMovements, the initial positions may be anywhere
+  // in the file, so read them first.
+  for (int pass = 0; pass < 2; pass++)
+    {
+      std::ifstream file (m_filename.c_str (), std::ios::in);
+      std::string line;
+      while (getline (file, line))
+        {
+          if (line.empty ())
+            {
+              continue;
+            }
+          ParseResult pr = ParseNs2Line (line);
+          if (pr.tokens.size () != 4 && pr.tokens.size () != 7 && pr.tokens.size () != 8)
+            {
+              continue;
+            }
+          int iNodeId = GetNodeIdInt (pr);
+          if (iNodeId < 0)
+            {
+              NS_LOG_ERROR ("Node number couldn't be obtained (corrupted file?): " << line);
+              continue;
+            }
+          uint32_t id = iNodeId;
+          if (pass == 0)
+            {
+              if (IsSetInitialPos (pr))
+                {
+                  if (initial.size () <= id)
+                    {
+                      initial.resize (id + 1, Vector (0, 0, 0));
+                      positioned.resize (id + 1, false);
+                    }
+                  positioned[id] = true;
+                  initial[id] = SetOneInitialCoord (initial[id], pr.tokens[2], pr.dvals[3]);
+                }
+              continue;
+            }
+          if (IsSetInitialPos (pr))
+            {
+              continue;
+            }
+          if (!IsNumber (pr.tokens[2]) || pr.dvals[2] < 0)
+            {
+              NS_LOG_WARN ("Invalid time: " << line);
+              continue;
+            }
+          double at = pr.dvals[2];
+          if (waypoints.size () <= id)
+            {
+              waypoints.resize (id + 1);
+            }
+          std::vector<WaypointTraceRecord> &node = waypoints[id];
+          if (node.empty ())
+            {
+              Vector start = id < initial.size () ? initial[id] : Vector (0, 0, 0);
+              WaypointTraceRecord record = { 0, start.x, start.y, start.z };
+              node.push_back (record);
+            }
+          if (IsSchedMobilityPos (pr))
+            {
+              Vector position = CutWaypoints (node, at);
+              double speed = pr.dvals[7];
+              double dx = pr.dvals[5] - position.x;
+              double dy = pr.dvals[6] - position.y;
+              double time = speed > 0 ? std::sqrt (dx * dx + dy * dy) / speed : 0;
+              if (time > 0)
+                {
+                  WaypointTraceRecord record = { at + time, pr.dvals[5], pr.dvals[6], position.z };
+                  node.push_back (record);
+                }
+            }
+          else if (IsSchedSetPos (pr))
+            {
+              Vector position = CutWaypoints (node, at);
+              Vector target = SetOneInitialCoord (position, pr.tokens[5], pr.dvals[6]);
+              WaypointTraceRecord &last = node.back ();
+              if (node.size () > 1 && node[node.size () - 2].time < at - jump)
+                {
+                  // hold the position until just before the jump
+                  last.time = at - jump;
+                  WaypointTraceRecord record = { at, target.x, target.y, target.z };
+                  node.push_back (record);
+                }
+              else
+                {
+                  last.x = target.x;
+                  last.y = target.y;
+                  last.z = target.z;
+                }
+            }
+          else
+            {
+              NS_LOG_WARN ("Format Line is not correct: " << line);
+            }
+        }
+    }
+  // the nodes which are only positioned
+  if (waypoints.size () < initial.size ())
+    {
+      waypoints.resize (initial.size ());
+    }
+  for (uint32_t id = 0; id < initial.size (); id++)
+    {
+      if (positioned[id] && waypoints[id].empty ())
+        {
+          WaypointTraceRecord record = { 0, initial[id].x, initial[id].y, initial[id].z };
+          waypoints[id].push_back (record);
+        }
+    }
+  WaypointTraceFile::Write (filename, waypoints);
+}
+
 } // namespace ns3
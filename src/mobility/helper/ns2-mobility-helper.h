@@ -103,6 +103,17 @@ public:
    */
   template <typename T>
   void Install (T begin, T end) const;
+
+  /**
+   * \param filename the name of the binary waypoint trace to write.
+   *
+   * Convert the ns2 trace file into a binary waypoint trace, which
+   * WaypointTraceHelper installs in a fraction of the time and memory
+   * needed by Install.  The waypoints of the node with the ns2 id i
+   * are the waypoints of the node i of the binary trace.  A scheduled
+   * set of a coordinate becomes a move of one nanosecond.
+   */
+  void ConvertToWaypointTrace (std::string filename) const;
 private:
   /**
    * \brief a class to hold input objects internally
@@ -0,0 +1,80 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "ns3/log.h"
+#include "ns3/node.h"
+#include "ns3/node-list.h"
+#include "ns3/streaming-waypoint-mobility-model.h"
+#include "waypoint-trace-helper.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("WaypointTraceHelper");
+
+WaypointTraceHelper::WaypointTraceHelper (std::string filename)
+  : m_trace (Create<WaypointTraceFile> (filename))
+{
+  m_factory.SetTypeId ("ns3::StreamingWaypointMobilityModel");
+}
+
+void
+WaypointTraceHelper::SetAttribute (std::string n1, const AttributeValue &v1)
+{
+  m_factory.Set (n1, v1);
+}
+
+uint32_t
+WaypointTraceHelper::GetNNodes (void) const
+{
+  return m_trace->GetNNodes ();
+}
+
+void
+WaypointTraceHelper::Install (Ptr<Node> node, uint32_t index) const
+{
+  NS_LOG_FUNCTION (this << node << index);
+  Ptr<StreamingWaypointMobilityModel> model = node->GetObject<StreamingWaypointMobilityModel> ();
+  if (model == 0)
+    {
+      NS_ABORT_MSG_IF (node->GetObject<MobilityModel> () != 0,
+                       "Node " << node->GetId () << " already has a mobility model");
+      model = m_factory.Create<StreamingWaypointMobilityModel> ();
+      node->AggregateObject (model);
+    }
+  model->SetTrace (m_trace, index);
+}
+
+void
+WaypointTraceHelper::Install (void) const
+{
+  for (NodeList::Iterator i = NodeList::Begin (); i != NodeList::End (); ++i)
+    {
+      if ((*i)->GetId () < m_trace->GetNNodes ())
+        {
+          Install (*i, (*i)->GetId ());
+        }
+    }
+}
+
+void
+WaypointTraceHelper::Install (NodeContainer c) const
+{
+  for (uint32_t i = 0; i < c.GetN () && i < m_trace->GetNNodes (); i++)
+    {
+      Install (c.Get (i), i);
+    }
+}
+
+} // namespace ns3
@@ -0,0 +1,86 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef WAYPOINT_TRACE_HELPER_H
+#define WAYPOINT_TRACE_HELPER_H
+
+#include <string>
+#include "ns3/ptr.h"
+#include "ns3/node-container.h"
+#include "ns3/object-factory.h"
+#include "ns3/waypoint-trace-file.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup mobility
+ * \brief Helper class which installs the waypoints of a binary waypoint
+ * trace on nodes.
+ *
+ * The trace is mapped into memory, and each node gets a
+ * StreamingWaypointMobilityModel which reads its waypoints from the
+ * mapping as it moves, so that installing a trace costs the same
+ * whatever its length.  Binary traces are written by
+ * Ns2MobilityHelper::ConvertToWaypointTrace or WaypointTraceFile::Write.
+ */
+class WaypointTraceHelper
+{
+public:
+  /**
+   * \param filename the name of the binary waypoint trace.
+   */
+  WaypointTraceHelper (std::string filename);
+
+  /**
+   * \param n1 the name of the attribute to set
+   * \param v1 the value of the attribute to set
+   *
+   * Set an attribute of the StreamingWaypointMobilityModel objects
+   * created by Install.
+   */
+  void SetAttribute (std::string n1, const AttributeValue &v1);
+
+  /**
+   * Install the trace on all the nodes of the global ns3::NodeList whose
+   * id is a node index of the trace.
+   */
+  void Install (void) const;
+  /**
+   * \param c the nodes.
+   *
+   * Install the waypoints of the node i of the trace on the node i of
+   * the container, for all the nodes of the trace.
+   */
+  void Install (NodeContainer c) const;
+
+  /**
+   * \return the number of nodes of the trace
+   */
+  uint32_t GetNNodes (void) const;
+
+private:
+  /**
+   * \param node the node.
+   * \param index the index of the node in the trace.
+   */
+  void Install (Ptr<Node> node, uint32_t index) const;
+
+  Ptr<const WaypointTraceFile> m_trace; //!< the trace
+  ObjectFactory m_factory; //!< factory of the mobility models
+};
+
+} // namespace ns3
+
+#endif /* WAYPOINT_TRACE_HELPER_H */
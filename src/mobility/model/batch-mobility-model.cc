@@ -0,0 +1,418 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include <cmath>
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/pointer.h"
+#include "ns3/string.h"
+#include "batch-mobility-model.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("BatchMobilityModel");
+
+NS_OBJECT_ENSURE_REGISTERED (BatchMobilityManager);
+
+TypeId
+BatchMobilityManager::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::BatchMobilityManager")
+    .SetParent<Object> ()
+    .SetGroupName ("Mobility")
+    .AddConstructor<BatchMobilityManager> ()
+    .AddAttribute ("Interval",
+                   "The interval between two batch updates of the positions.",
+                   TimeValue (Seconds (1.0)),
+                   MakeTimeAccessor (&BatchMobilityManager::m_interval),
+                   MakeTimeChecker (TimeStep (1)))
+  ;
+  return tid;
+}
+
+BatchMobilityManager::BatchMobilityManager ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+BatchMobilityManager::~BatchMobilityManager ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+BatchMobilityManager::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_step.Cancel ();
+  Object::DoDispose ();
+}
+
+Ptr<BatchMobilityManager>
+BatchMobilityManager::Get (void)
+{
+  return *DoGet ();
+}
+
+Ptr<BatchMobilityManager> *
+BatchMobilityManager::DoGet (void)
+{
+  static Ptr<BatchMobilityManager> ptr = 0;
+  if (ptr == 0)
+    {
+      ptr = CreateObject<BatchMobilityManager> ();
+      Simulator::ScheduleDestroy (&BatchMobilityManager::Delete);
+    }
+  return &ptr;
+}
+
+void
+BatchMobilityManager::Delete (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+  // The models still alive keep using this manager; the models created
+  // by the next simulation will use a new one.
+  (*DoGet ())->m_step.Cancel ();
+  (*DoGet ()) = 0;
+}
+
+uint32_t
+BatchMobilityManager::Add (BatchMobilityModel *model)
+{
+  NS_LOG_FUNCTION (this << model);
+  uint32_t index;
+  if (m_free.empty ())
+    {
+      index = m_models.size ();
+      m_x.push_back (0);
+      m_y.push_back (0);
+      m_z.push_back (0);
+      m_vx.push_back (0);
+      m_vy.push_back (0);
+      m_vz.push_back (0);
+      m_due.push_back (-1);
+      m_models.push_back (model);
+    }
+  else
+    {
+      index = m_free.back ();
+      m_free.pop_back ();
+      m_models[index] = model;
+    }
+  return index;
+}
+
+void
+BatchMobilityManager::Remove (uint32_t index)
+{
+  NS_LOG_FUNCTION (this << index);
+  NS_ASSERT (index < m_models.size () && m_models[index] != 0);
+  m_x[index] = m_y[index] = m_z[index] = 0;
+  m_vx[index] = m_vy[index] = m_vz[index] = 0;
+  m_due[index] = -1;
+  m_models[index] = 0;
+  m_free.push_back (index);
+}
+
+uint32_t
+BatchMobilityManager::GetN (void) const
+{
+  return m_models.size () - m_free.size ();
+}
+
+void
+BatchMobilityManager::Update (void)
+{
+  int64_t now = Simulator::Now ().GetTimeStep ();
+  // A transition may trigger, through the CourseChange trace, a position
+  // read which updates the manager again: both loops then simply share
+  // the remaining transitions, which are still processed in time order.
+  while (!m_transitions.empty () && m_transitions.top ().first <= now)
+    {
+      Transition transition = m_transitions.top ();
+      m_transitions.pop ();
+      uint32_t index = transition.second;
+      if (m_due[index] != transition.first)
+        {
+          // cancelled, replaced, or the index was reused
+          continue;
+        }
+      m_due[index] = -1;
+      m_models[index]->DoTransition (TimeStep (transition.first));
+    }
+}
+
+Vector
+BatchMobilityManager::GetPositionAt (uint32_t index, Time t) const
+{
+  double dt = (t - m_reference).GetSeconds ();
+  return Vector (m_x[index] + m_vx[index] * dt,
+                 m_y[index] + m_vy[index] * dt,
+                 m_z[index] + m_vz[index] * dt);
+}
+
+Vector
+BatchMobilityManager::GetPosition (uint32_t index)
+{
+  if (!m_transitions.empty () && m_transitions.top ().first <= Simulator::Now ().GetTimeStep ())
+    {
+      Update ();
+    }
+  return GetPositionAt (index, Simulator::Now ());
+}
+
+Vector
+BatchMobilityManager::GetVelocity (uint32_t index)
+{
+  if (!m_transitions.empty () && m_transitions.top ().first <= Simulator::Now ().GetTimeStep ())
+    {
+      Update ();
+    }
+  return Vector (m_vx[index], m_vy[index], m_vz[index]);
+}
+
+void
+BatchMobilityManager::SetPosition (uint32_t index, const Vector &position, Time t)
+{
+  NS_LOG_FUNCTION (this << index << position << t);
+  NS_ASSERT (t <= Simulator::Now ());
+  // express the new position at the reference time
+  double dt = (t - m_reference).GetSeconds ();
+  m_x[index] = position.x - m_vx[index] * dt;
+  m_y[index] = position.y - m_vy[index] * dt;
+  m_z[index] = position.z - m_vz[index] * dt;
+}
+
+void
+BatchMobilityManager::SetVelocity (uint32_t index, const Vector &velocity, Time t)
+{
+  NS_LOG_FUNCTION (this << index << velocity << t);
+  Vector position = GetPositionAt (index, t);
+  m_vx[index] = velocity.x;
+  m_vy[index] = velocity.y;
+  m_vz[index] = velocity.z;
+  SetPosition (index, position, t);
+}
+
+void
+BatchMobilityManager::ScheduleTransition (uint32_t index, Time t)
+{
+  NS_LOG_FUNCTION (this << index << t);
+  m_due[index] = t.GetTimeStep ();
+  m_transitions.push (std::make_pair (m_due[index], index));
+  ScheduleStep ();
+}
+
+void
+BatchMobilityManager::CancelTransition (uint32_t index)
+{
+  NS_LOG_FUNCTION (this << index);
+  m_due[index] = -1;
+}
+
+void
+BatchMobilityManager::ScheduleStep (void)
+{
+  if (!m_step.IsRunning ())
+    {
+      m_step = Simulator::Schedule (m_interval, &BatchMobilityManager::Step, this);
+    }
+}
+
+void
+BatchMobilityManager::Step (void)
+{
+  NS_LOG_FUNCTION (this);
+  Update ();
+  Time now = Simulator::Now ();
+  double dt = (now - m_reference).GetSeconds ();
+  std::size_t n = m_x.size ();
+  for (std::size_t i = 0; i < n; i++)
+    {
+      m_x[i] += m_vx[i] * dt;
+      m_y[i] += m_vy[i] * dt;
+      m_z[i] += m_vz[i] * dt;
+    }
+  m_reference = now;
+  // drop the stale transitions so that an idle manager stops stepping
+  while (!m_transitions.empty ()
+         && m_due[m_transitions.top ().second] != m_transitions.top ().first)
+    {
+      m_transitions.pop ();
+    }
+  if (!m_transitions.empty ())
+    {
+      ScheduleStep ();
+    }
+}
+
+
+NS_OBJECT_ENSURE_REGISTERED (BatchMobilityModel);
+
+TypeId
+BatchMobilityModel::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::BatchMobilityModel")
+    .SetParent<MobilityModel> ()
+    .SetGroupName ("Mobility")
+    .AddConstructor<BatchMobilityModel> ()
+    .AddAttribute ("Speed",
+                   "A random variable used to pick the speed of a random waypoint model.",
+                   StringValue ("ns3::UniformRandomVariable[Min=0.3|Max=0.7]"),
+                   MakePointerAccessor (&BatchMobilityModel::m_speed),
+                   MakePointerChecker<RandomVariableStream> ())
+    .AddAttribute ("Pause",
+                   "A random variable used to pick the pause of a random waypoint model.",
+                   StringValue ("ns3::ConstantRandomVariable[Constant=2.0]"),
+                   MakePointerAccessor (&BatchMobilityModel::m_pause),
+                   MakePointerChecker<RandomVariableStream> ())
+    .AddAttribute ("PositionAllocator",
+                   "The position model used to pick a destination point.  "
+                   "Without it, the model keeps a constant velocity.",
+                   PointerValue (),
+                   MakePointerAccessor (&BatchMobilityModel::m_position),
+                   MakePointerChecker<PositionAllocator> ())
+  ;
+  return tid;
+}
+
+BatchMobilityModel::BatchMobilityModel ()
+  : m_walking (false)
+{
+  NS_LOG_FUNCTION (this);
+  m_manager = BatchMobilityManager::Get ();
+  m_index = m_manager->Add (this);
+}
+
+BatchMobilityModel::~BatchMobilityModel ()
+{
+  NS_LOG_FUNCTION (this);
+  if (m_manager != 0)
+    {
+      m_manager->Remove (m_index);
+    }
+}
+
+void
+BatchMobilityModel::DoInitialize (void)
+{
+  NS_LOG_FUNCTION (this);
+  if (m_position != 0)
+    {
+      Pause (Simulator::Now ());
+    }
+  MobilityModel::DoInitialize ();
+}
+
+void
+BatchMobilityModel::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_manager->Remove (m_index);
+  m_manager = 0;
+  m_position = 0;
+  MobilityModel::DoDispose ();
+}
+
+void
+BatchMobilityModel::Pause (Time t)
+{
+  NS_LOG_FUNCTION (this << t);
+  m_walking = false;
+  m_manager->SetVelocity (m_index, Vector (0, 0, 0), t);
+  m_manager->ScheduleTransition (m_index, t + Seconds (m_pause->GetValue ()));
+  NotifyCourseChange ();
+}
+
+void
+BatchMobilityModel::DoTransition (Time t)
+{
+  NS_LOG_FUNCTION (this << t);
+  if (m_walking)
+    {
+      m_manager->SetVelocity (m_index, Vector (0, 0, 0), t);
+      m_manager->SetPosition (m_index, m_destination, t);
+      Pause (t);
+      return;
+    }
+  Vector current = m_manager->GetPositionAt (m_index, t);
+  m_destination = m_position->GetNext ();
+  double speed = m_speed->GetValue ();
+  double distance = CalculateDistance (m_destination, current);
+  Time travel = Seconds (0);
+  if (distance > 0)
+    {
+      double k = speed / distance;
+      Vector velocity (k * (m_destination.x - current.x),
+                       k * (m_destination.y - current.y),
+                       k * (m_destination.z - current.z));
+      m_manager->SetVelocity (m_index, velocity, t);
+      travel = Seconds (distance / speed);
+    }
+  m_walking = true;
+  m_manager->ScheduleTransition (m_index, t + travel);
+  NotifyCourseChange ();
+}
+
+void
+BatchMobilityModel::SetVelocity (const Vector &velocity)
+{
+  NS_LOG_FUNCTION (this << velocity);
+  m_manager->SetVelocity (m_index, velocity, Simulator::Now ());
+  NotifyCourseChange ();
+}
+
+Vector
+BatchMobilityModel::DoGetPosition (void) const
+{
+  return m_manager->GetPosition (m_index);
+}
+
+void
+BatchMobilityModel::DoSetPosition (const Vector &position)
+{
+  NS_LOG_FUNCTION (this << position);
+  m_manager->SetPosition (m_index, position, Simulator::Now ());
+  if (m_position != 0 && IsInitialized ())
+    {
+      // restart with a pause at the new position
+      m_manager->CancelTransition (m_index);
+      Pause (Simulator::Now ());
+      return;
+    }
+  NotifyCourseChange ();
+}
+
+Vector
+BatchMobilityModel::DoGetVelocity (void) const
+{
+  return m_manager->GetVelocity (m_index);
+}
+
+int64_t
+BatchMobilityModel::DoAssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+  m_speed->SetStream (stream);
+  m_pause->SetStream (stream + 1);
+  int64_t positionStreamsAllocated = 0;
+  if (m_position != 0)
+    {
+      positionStreamsAllocated = m_position->AssignStreams (stream + 2);
+    }
+  return (2 + positionStreamsAllocated);
+}
+
+} // namespace ns3
@@ -0,0 +1,215 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "ns3/assert.h"
+#include "ns3/log.h"
+#include "mobility-model.h"
+#include "spatial-grid.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("SpatialGrid");
+
+SpatialGrid::SpatialGrid (double cellSize)
+  : m_cellSize (cellSize)
+{
+  NS_LOG_FUNCTION (this << cellSize);
+  NS_ASSERT (cellSize > 0);
+}
+
+SpatialGrid::~SpatialGrid ()
+{
+  NS_LOG_FUNCTION (this);
+  Clear ();
+}
+
+void
+SpatialGrid::SetCellSize (double cellSize)
+{
+  NS_LOG_FUNCTION (this << cellSize);
+  NS_ASSERT (cellSize > 0);
+  NS_ASSERT_MSG (m_entries.empty (), "The cell size of a grid can only be set when it is empty");
+  m_cellSize = cellSize;
+}
+
+uint64_t
+SpatialGrid::GetCellKey (int64_t x, int64_t y)
+{
+  return (static_cast<uint64_t> (static_cast<uint32_t> (x)) << 32) | static_cast<uint32_t> (y);
+}
+
+int64_t
+SpatialGrid::GetCellIndex (double coordinate) const
+{
+  return static_cast<int64_t> (std::floor (coordinate / m_cellSize));
+}
+
+void
+SpatialGrid::Add (uint32_t id, Ptr<MobilityModel> mobility)
+{
+  NS_LOG_FUNCTION (this << id << mobility);
+  NS_ASSERT (mobility != 0);
+  NS_ASSERT_MSG (!Contains (id), "Id " << id << " already in the grid");
+
+  Entry entry;
+  entry.mobility = mobility;
+  entry.moving = false;
+  entry.cell = 0;
+  m_entries[id] = entry;
+  std::vector<uint32_t> &ids = m_ids[PeekPointer (mobility)];
+  if (ids.empty ())
+    {
+      mobility->TraceConnectWithoutContext ("CourseChange", MakeCallback (&SpatialGrid::CourseChanged, this));
+    }
+  ids.push_back (id);
+  Place (id);
+}
+
+bool
+SpatialGrid::Contains (uint32_t id) const
+{
+  return m_entries.find (id) != m_entries.end ();
+}
+
+void
+SpatialGrid::Clear (void)
+{
+  NS_LOG_FUNCTION (this);
+  for (std::map<const MobilityModel *, std::vector<uint32_t> >::const_iterator i = m_ids.begin ();
+       i != m_ids.end (); ++i)
+    {
+      m_entries[i->second.front ()].mobility->TraceDisconnectWithoutContext ("CourseChange", MakeCallback (&SpatialGrid::CourseChanged, this));
+    }
+  m_ids.clear ();
+  m_entries.clear ();
+  m_cells.clear ();
+  m_moving.clear ();
+}
+
+void
+SpatialGrid::Place (uint32_t id)
+{
+  Entry &entry = m_entries[id];
+  Vector velocity = entry.mobility->GetVelocity ();
+  if (velocity.x != 0 || velocity.y != 0 || velocity.z != 0)
+    {
+      entry.moving = true;
+      m_moving.push_back (id);
+    }
+  else
+    {
+      Vector position = entry.mobility->GetPosition ();
+      entry.moving = false;
+      entry.cell = GetCellKey (GetCellIndex (position.x), GetCellIndex (position.y));
+      m_cells[entry.cell].push_back (std::make_pair (id, position));
+    }
+}
+
+void
+SpatialGrid::Unplace (uint32_t id)
+{
+  Entry &entry = m_entries[id];
+  if (entry.moving)
+    {
+      m_moving.erase (std::find (m_moving.begin (), m_moving.end (), id));
+      return;
+    }
+  std::vector<CellEntry> &cell = m_cells[entry.cell];
+  for (std::vector<CellEntry>::iterator i = cell.begin (); i != cell.end (); ++i)
+    {
+      if (i->first == id)
+        {
+          cell.erase (i);
+          break;
+        }
+    }
+  if (cell.empty ())
+    {
+      m_cells.erase (entry.cell);
+    }
+}
+
+void
+SpatialGrid::CourseChanged (Ptr<const MobilityModel> mobility)
+{
+  NS_LOG_FUNCTION (this << mobility);
+  const std::vector<uint32_t> &ids = m_ids[PeekPointer (mobility)];
+  for (std::vector<uint32_t>::const_iterator i = ids.begin (); i != ids.end (); ++i)
+    {
+      Unplace (*i);
+      Place (*i);
+    }
+}
+
+void
+SpatialGrid::GetInRange (const std::vector<CellEntry> &cell, const Vector &position, double range, std::vector<uint32_t> &ids)
+{
+  for (std::vector<CellEntry>::const_iterator i = cell.begin (); i != cell.end (); ++i)
+    {
+      if (CalculateDistance (i->second, position) <= range)
+        {
+          ids.push_back (i->first);
+        }
+    }
+}
+
+void
+SpatialGrid::GetInRange (const Vector &position, double range, std::vector<uint32_t> &ids) const
+{
+  NS_LOG_FUNCTION (this << position << range);
+  ids.clear ();
+  int64_t xMin = GetCellIndex (position.x - range);
+  int64_t xMax = GetCellIndex (position.x + range);
+  int64_t yMin = GetCellIndex (position.y - range);
+  int64_t yMax = GetCellIndex (position.y + range);
+  // The models of the cells do not move, their position is up to date
+  if (static_cast<double> (xMax - xMin + 1) * (yMax - yMin + 1) > m_cells.size ())
+    {
+      // The range covers more cells than there are occupied ones
+      for (std::unordered_map<uint64_t, std::vector<CellEntry> >::const_iterator cell = m_cells.begin ();
+           cell != m_cells.end (); ++cell)
+        {
+          GetInRange (cell->second, position, range, ids);
+        }
+    }
+  else
+    {
+      for (int64_t x = xMin; x <= xMax; ++x)
+        {
+          for (int64_t y = yMin; y <= yMax; ++y)
+            {
+              std::unordered_map<uint64_t, std::vector<CellEntry> >::const_iterator cell = m_cells.find (GetCellKey (x, y));
+              if (cell != m_cells.end ())
+                {
+                  GetInRange (cell->second, position, range, ids);
+                }
+            }
+        }
+    }
+  for (std::vector<uint32_t>::const_iterator i = m_moving.begin (); i != m_moving.end (); ++i)
+    {
+      if (CalculateDistance (m_entries.at (*i).mobility->GetPosition (), position) <= range)
+        {
+          ids.push_back (*i);
+        }
+    }
+  std::sort (ids.begin (), ids.end ());
+}
+
+} // namespace ns3
@@ -0,0 +1,109 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/uinteger.h"
+#include "streaming-waypoint-mobility-model.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("StreamingWaypointMobilityModel");
+
+NS_OBJECT_ENSURE_REGISTERED (StreamingWaypointMobilityModel);
+
+TypeId
+StreamingWaypointMobilityModel::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::StreamingWaypointMobilityModel")
+    .SetParent<WaypointMobilityModel> ()
+    .SetGroupName ("Mobility")
+    .AddConstructor<StreamingWaypointMobilityModel> ()
+    .AddAttribute ("Lookahead", "The number of waypoints read from the trace beyond the next one.",
+                   UintegerValue (2),
+                   MakeUintegerAccessor (&StreamingWaypointMobilityModel::m_lookahead),
+                   MakeUintegerChecker<uint32_t> (1))
+  ;
+  return tid;
+}
+
+StreamingWaypointMobilityModel::StreamingWaypointMobilityModel ()
+  : m_cursor (0),
+    m_end (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+StreamingWaypointMobilityModel::~StreamingWaypointMobilityModel ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+StreamingWaypointMobilityModel::SetTrace (Ptr<const WaypointTraceFile> trace, uint32_t node)
+{
+  NS_LOG_FUNCTION (this << trace << node);
+  m_trace = trace;
+  m_cursor = trace->Begin (node);
+  m_end = trace->End (node);
+  // skip the past waypoints, but the last one, which is the current position
+  Time now = Simulator::Now ();
+  while (m_end - m_cursor > 1 && Seconds (m_cursor[1].time) <= now)
+    {
+      m_cursor++;
+    }
+  if (m_cursor != m_end && Seconds (m_cursor->time) < now)
+    {
+      // start from the current position on the current segment
+      Vector position (m_cursor->x, m_cursor->y, m_cursor->z);
+      if (m_end - m_cursor > 1)
+        {
+          const WaypointTraceRecord &next = m_cursor[1];
+          double k = (now.GetSeconds () - m_cursor->time) / (next.time - m_cursor->time);
+          position.x += k * (next.x - position.x);
+          position.y += k * (next.y - position.y);
+          position.z += k * (next.z - position.z);
+        }
+      AddWaypoint (Waypoint (now, position));
+      m_cursor++;
+    }
+  Refill ();
+}
+
+void
+StreamingWaypointMobilityModel::Refill (void)
+{
+  Time now = Simulator::Now ();
+  while (m_cursor != m_end
+         && (m_waypoints.size () < m_lookahead || Seconds (m_cursor->time) <= now))
+    {
+      AddWaypoint (Waypoint (Seconds (m_cursor->time), Vector (m_cursor->x, m_cursor->y, m_cursor->z)));
+      m_cursor++;
+    }
+}
+
+void
+StreamingWaypointMobilityModel::Update (void) const
+{
+  if (m_cursor != m_end)
+    {
+      // Refill only appends waypoints, as the lazy updates of the base
+      // class modify its other mutable members.
+      const_cast<StreamingWaypointMobilityModel *> (this)->Refill ();
+    }
+  WaypointMobilityModel::Update ();
+}
+
+} // namespace ns3
@@ -133,10 +133,6 @@ public:
 private:
   friend class ::WaypointMobilityModelNotifyTest; // To allow Update() calls and access to m_current
 
-  /**
-   * Update the underlying state corresponding to the stored waypoints
-   */
-  virtual void Update (void) const;
   /**
    * \brief The dispose method.
    * 
@@ -160,6 +156,10 @@ private:
   virtual Vector DoGetVelocity (void) const;
 
 protected:
+  /**
+   * Update the underlying state corresponding to the stored waypoints
+   */
+  virtual void Update (void) const;
   /**
    * \brief This variable is set to true if there are no waypoints in the std::deque
    */
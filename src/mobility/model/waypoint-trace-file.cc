@@ -0,0 +1,158 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "ns3/log.h"
+#include "ns3/fatal-error.h"
+#include "waypoint-trace-file.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("WaypointTraceFile");
+
+/// Magic bytes at the start of a binary waypoint trace
+static const char WAYPOINT_TRACE_MAGIC[8] = { 'N', 'S', '3', 'W', 'A', 'Y', 'P', 'T' };
+/// Version of the binary waypoint trace format
+static const uint32_t WAYPOINT_TRACE_VERSION = 1;
+/// Size of the header of a binary waypoint trace, in bytes
+static const size_t WAYPOINT_TRACE_HEADER_SIZE = 16;
+
+WaypointTraceFile::WaypointTraceFile (std::string filename)
+  : m_data (0),
+    m_size (0),
+    m_nodes (0),
+    m_offsets (0),
+    m_records (0)
+{
+  NS_LOG_FUNCTION (this << filename);
+  int fd = open (filename.c_str (), O_RDONLY);
+  if (fd < 0)
+    {
+      NS_FATAL_ERROR ("Cannot open waypoint trace " << filename << ": " << std::strerror (errno));
+    }
+  struct stat st;
+  if (fstat (fd, &st) < 0 || static_cast<size_t> (st.st_size) < WAYPOINT_TRACE_HEADER_SIZE + sizeof (uint64_t))
+    {
+      close (fd);
+      NS_FATAL_ERROR ("Waypoint trace " << filename << " is too short");
+    }
+  m_size = st.st_size;
+  m_data = mmap (0, m_size, PROT_READ, MAP_SHARED, fd, 0);
+  close (fd);
+  if (m_data == MAP_FAILED)
+    {
+      m_data = 0;
+      NS_FATAL_ERROR ("Cannot map waypoint trace " << filename << ": " << std::strerror (errno));
+    }
+
+  const uint8_t *data = static_cast<const uint8_t *> (m_data);
+  uint32_t version;
+  std::memcpy (&version, data + 8, sizeof (version));
+  std::memcpy (&m_nodes, data + 12, sizeof (m_nodes));
+  if (std::memcmp (data, WAYPOINT_TRACE_MAGIC, sizeof (WAYPOINT_TRACE_MAGIC)) != 0
+      || version != WAYPOINT_TRACE_VERSION)
+    {
+      NS_FATAL_ERROR ("Waypoint trace " << filename << " is not a version "
+                      << WAYPOINT_TRACE_VERSION << " binary waypoint trace");
+    }
+  size_t recordsStart = WAYPOINT_TRACE_HEADER_SIZE + (m_nodes + 1) * sizeof (uint64_t);
+  if (m_size < recordsStart)
+    {
+      NS_FATAL_ERROR ("Waypoint trace " << filename << " is truncated");
+    }
+  m_offsets = reinterpret_cast<const uint64_t *> (data + WAYPOINT_TRACE_HEADER_SIZE);
+  m_records = reinterpret_cast<const WaypointTraceRecord *> (data + recordsStart);
+  if (m_offsets[0] != 0
+      || m_size != recordsStart + m_offsets[m_nodes] * sizeof (WaypointTraceRecord))
+    {
+      NS_FATAL_ERROR ("Waypoint trace " << filename << " has an inconsistent size");
+    }
+  for (uint32_t i = 0; i < m_nodes; i++)
+    {
+      if (m_offsets[i] > m_offsets[i + 1])
+        {
+          NS_FATAL_ERROR ("Waypoint trace " << filename << " has inconsistent offsets");
+        }
+    }
+}
+
+WaypointTraceFile::~WaypointTraceFile ()
+{
+  NS_LOG_FUNCTION (this);
+  if (m_data != 0)
+    {
+      munmap (m_data, m_size);
+    }
+}
+
+uint32_t
+WaypointTraceFile::GetNNodes (void) const
+{
+  return m_nodes;
+}
+
+const WaypointTraceRecord *
+WaypointTraceFile::Begin (uint32_t node) const
+{
+  NS_ASSERT (node < m_nodes);
+  return m_records + m_offsets[node];
+}
+
+const WaypointTraceRecord *
+WaypointTraceFile::End (uint32_t node) const
+{
+  NS_ASSERT (node < m_nodes);
+  return m_records + m_offsets[node + 1];
+}
+
+void
+WaypointTraceFile::Write (std::string filename, const std::vector<std::vector<WaypointTraceRecord> > &waypoints)
+{
+  NS_LOG_FUNCTION (filename << waypoints.size ());
+  std::ofstream file (filename.c_str (), std::ios::out | std::ios::binary | std::ios::trunc);
+  if (!file.is_open ())
+    {
+      NS_FATAL_ERROR ("Cannot create waypoint trace " << filename);
+    }
+  uint32_t nodes = waypoints.size ();
+  file.write (WAYPOINT_TRACE_MAGIC, sizeof (WAYPOINT_TRACE_MAGIC));
+  file.write (reinterpret_cast<const char *> (&WAYPOINT_TRACE_VERSION), sizeof (WAYPOINT_TRACE_VERSION));
+  file.write (reinterpret_cast<const char *> (&nodes), sizeof (nodes));
+  uint64_t offset = 0;
+  file.write (reinterpret_cast<const char *> (&offset), sizeof (offset));
+  for (uint32_t i = 0; i < nodes; i++)
+    {
+      offset += waypoints[i].size ();
+      file.write (reinterpret_cast<const char *> (&offset), sizeof (offset));
+    }
+  for (uint32_t i = 0; i < nodes; i++)
+    {
+      file.write (reinterpret_cast<const char *> (waypoints[i].data ()),
+                  waypoints[i].size () * sizeof (WaypointTraceRecord));
+    }
+  if (!file)
+    {
+      NS_FATAL_ERROR ("Cannot write waypoint trace " << filename);
+    }
+}
+
+} // namespace ns3
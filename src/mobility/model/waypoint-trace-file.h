@@ -0,0 +1,112 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef WAYPOINT_TRACE_FILE_H
+#define WAYPOINT_TRACE_FILE_H
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "ns3/simple-ref-count.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup mobility
+ * \brief A waypoint of a binary waypoint trace: a time, in seconds, and
+ * a position, in meters.
+ */
+struct WaypointTraceRecord
+{
+  double time; //!< time of the waypoint, in seconds
+  double x;    //!< x coordinate
+  double y;    //!< y coordinate
+  double z;    //!< z coordinate
+};
+
+/**
+ * \ingroup mobility
+ * \brief Read-only, memory-mapped, binary waypoint trace.
+ *
+ * The file holds the waypoints of a set of nodes, in the byte order of
+ * the host which wrote it:
+ *  - a header: the 8 bytes "NS3WAYPT", the format version (uint32_t,
+ *    currently 1) and the number N of nodes (uint32_t);
+ *  - N + 1 record offsets (uint64_t): the waypoints of node i are the
+ *    records [offset[i], offset[i+1]);
+ *  - the records (WaypointTraceRecord), sorted by node, and by strictly
+ *    increasing time for each node.
+ *
+ * The file is mapped into memory rather than read, so that opening it
+ * costs the same whatever its size, and that its pages are only loaded,
+ * and may be evicted, by the operating system as the simulation reads
+ * them.
+ */
+class WaypointTraceFile : public SimpleRefCount<WaypointTraceFile>
+{
+public:
+  /**
+   * Map a binary waypoint trace.  A fatal error occurs if the file
+   * cannot be mapped or is not a valid trace.
+   * \param filename the name of the trace
+   */
+  WaypointTraceFile (std::string filename);
+  ~WaypointTraceFile ();
+
+  /**
+   * \return the number of nodes of the trace
+   */
+  uint32_t GetNNodes (void) const;
+  /**
+   * \param node the index of a node
+   * \return the first waypoint of the node
+   */
+  const WaypointTraceRecord *Begin (uint32_t node) const;
+  /**
+   * \param node the index of a node
+   * \return the end of the waypoints of the node
+   */
+  const WaypointTraceRecord *End (uint32_t node) const;
+
+  /**
+   * Write a binary waypoint trace.
+   * \param filename the name of the trace
+   * \param waypoints the waypoints of each node, by increasing time
+   */
+  static void Write (std::string filename, const std::vector<std::vector<WaypointTraceRecord> > &waypoints);
+
+private:
+  /**
+   * Copy constructor.  Disabled since the mapping is not shared.
+   * \param o object to copy
+   */
+  WaypointTraceFile (const WaypointTraceFile &o);
+  /**
+   * Assignment operator.  Disabled since the mapping is not shared.
+   * \param o object to copy
+   * \return the copied object
+   */
+  WaypointTraceFile &operator = (const WaypointTraceFile &o);
+
+  void *m_data;    //!< the mapping
+  size_t m_size;   //!< the size of the mapping, in bytes
+  uint32_t m_nodes; //!< the number of nodes
+  const uint64_t *m_offsets; //!< the record offsets of the nodes
+  const WaypointTraceRecord *m_records; //!< the records
+};
+
+} // namespace ns3
+
+#endif /* WAYPOINT_TRACE_FILE_H */
@@ -0,0 +1,218 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/simulator.h"
+#include "ns3/double.h"
+#include "ns3/pointer.h"
+#include "ns3/string.h"
+#include "ns3/nstime.h"
+#include "ns3/batch-mobility-model.h"
+#include "ns3/random-waypoint-mobility-model.h"
+#include "ns3/test.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup mobility-test
+ * \ingroup tests
+ *
+ * \brief BatchMobilityModel constant velocity test
+ */
+class BatchMobilityModelVelocityTest : public TestCase
+{
+public:
+  BatchMobilityModelVelocityTest ();
+
+private:
+  virtual void DoRun (void);
+  /**
+   * Check the position of the model.
+   * \param expected the expected position
+   */
+  void CheckPosition (Vector expected);
+
+  Ptr<BatchMobilityModel> m_model; //!< the model under test
+};
+
+BatchMobilityModelVelocityTest::BatchMobilityModelVelocityTest ()
+  : TestCase ("Check the positions of a batch mobility model with a constant velocity")
+{
+}
+
+void
+BatchMobilityModelVelocityTest::CheckPosition (Vector expected)
+{
+  Vector position = m_model->GetPosition ();
+  NS_TEST_EXPECT_MSG_EQ_TOL (position.x, expected.x, 1e-9, "Wrong x at " << Simulator::Now ().As (Time::S));
+  NS_TEST_EXPECT_MSG_EQ_TOL (position.y, expected.y, 1e-9, "Wrong y at " << Simulator::Now ().As (Time::S));
+  NS_TEST_EXPECT_MSG_EQ_TOL (position.z, expected.z, 1e-9, "Wrong z at " << Simulator::Now ().As (Time::S));
+}
+
+void
+BatchMobilityModelVelocityTest::DoRun (void)
+{
+  m_model = CreateObject<BatchMobilityModel> ();
+  Ptr<BatchMobilityModel> other = CreateObject<BatchMobilityModel> ();
+  other->SetVelocity (Vector (-1, -1, -1));
+  m_model->SetPosition (Vector (1, 2, 3));
+  m_model->SetVelocity (Vector (1, 0, 0));
+  m_model->Initialize ();
+  other->Initialize ();
+
+  Simulator::Schedule (Seconds (2.5), &BatchMobilityModelVelocityTest::CheckPosition, this, Vector (3.5, 2, 3));
+  Simulator::Schedule (Seconds (2.5), &BatchMobilityModel::SetVelocity, m_model, Vector (0, 2, 0));
+  Simulator::Schedule (Seconds (4), &BatchMobilityModelVelocityTest::CheckPosition, this, Vector (3.5, 5, 3));
+  Simulator::Schedule (Seconds (4), &MobilityModel::SetPosition, m_model, Vector (0, 0, 0));
+  Simulator::Schedule (Seconds (5), &BatchMobilityModelVelocityTest::CheckPosition, this, Vector (0, 2, 0));
+  Simulator::Run ();
+
+  NS_TEST_EXPECT_MSG_EQ (Simulator::Now (), Seconds (5), "The manager should not schedule events without waypoints");
+  Vector velocity = other->GetVelocity ();
+  NS_TEST_EXPECT_MSG_EQ (velocity.x, -1, "The velocity of the other model changed");
+  Vector position = other->GetPosition ();
+  NS_TEST_EXPECT_MSG_EQ_TOL (position.z, -5, 1e-9, "The other model moved incorrectly");
+  Simulator::Destroy ();
+  m_model = 0;
+}
+
+/**
+ * \ingroup mobility-test
+ * \ingroup tests
+ *
+ * \brief Check that BatchMobilityModel follows the same waypoints as
+ * RandomWaypointMobilityModel, whatever its batch update interval.
+ */
+class BatchMobilityModelWaypointTest : public TestCase
+{
+public:
+  /**
+   * Constructor
+   * \param interval the batch update interval
+   */
+  BatchMobilityModelWaypointTest (Time interval);
+
+private:
+  virtual void DoRun (void);
+  /**
+   * Compare the positions and velocities of both models.
+   */
+  void Compare (void);
+  /**
+   * Course change callback
+   * \param count the counter to increment
+   * \param model the mobility model
+   */
+  static void CourseChange (uint32_t *count, Ptr<const MobilityModel> model);
+  /**
+   * \return a position allocator returning the waypoints of the test.
+   */
+  static Ptr<PositionAllocator> CreateWaypoints (void);
+
+  Time m_interval; //!< the batch update interval
+  Ptr<MobilityModel> m_reference; //!< the reference model
+  Ptr<MobilityModel> m_batch; //!< the model under test
+  uint32_t m_referenceChanges; //!< number of course changes of m_reference
+  uint32_t m_batchChanges; //!< number of course changes of m_batch
+};
+
+BatchMobilityModelWaypointTest::BatchMobilityModelWaypointTest (Time interval)
+  : TestCase ("Check a batch mobility model against the random waypoint model, interval "
+              + std::to_string (interval.GetMilliSeconds ()) + " ms"),
+    m_interval (interval),
+    m_referenceChanges (0),
+    m_batchChanges (0)
+{
+}
+
+void
+BatchMobilityModelWaypointTest::CourseChange (uint32_t *count, Ptr<const MobilityModel> model)
+{
+  (*count)++;
+}
+
+Ptr<PositionAllocator>
+BatchMobilityModelWaypointTest::CreateWaypoints (void)
+{
+  Ptr<ListPositionAllocator> waypoints = CreateObject<ListPositionAllocator> ();
+  waypoints->Add (Vector (10, 0, 0));
+  waypoints->Add (Vector (10, 7, 0));
+  waypoints->Add (Vector (-3, 4, 1));
+  waypoints->Add (Vector (0, 0, 0));
+  return waypoints;
+}
+
+void
+BatchMobilityModelWaypointTest::Compare (void)
+{
+  Vector expected = m_reference->GetPosition ();
+  Vector position = m_batch->GetPosition ();
+  NS_TEST_EXPECT_MSG_EQ_TOL (position.x, expected.x, 1e-6, "Wrong x at " << Simulator::Now ().As (Time::S));
+  NS_TEST_EXPECT_MSG_EQ_TOL (position.y, expected.y, 1e-6, "Wrong y at " << Simulator::Now ().As (Time::S));
+  NS_TEST_EXPECT_MSG_EQ_TOL (position.z, expected.z, 1e-6, "Wrong z at " << Simulator::Now ().As (Time::S));
+  expected = m_reference->GetVelocity ();
+  Vector velocity = m_batch->GetVelocity ();
+  NS_TEST_EXPECT_MSG_EQ_TOL (velocity.x, expected.x, 1e-9, "Wrong velocity at " << Simulator::Now ().As (Time::S));
+  NS_TEST_EXPECT_MSG_EQ_TOL (velocity.y, expected.y, 1e-9, "Wrong velocity at " << Simulator::Now ().As (Time::S));
+  NS_TEST_EXPECT_MSG_EQ_TOL (velocity.z, expected.z, 1e-9, "Wrong velocity at " << Simulator::Now ().As (Time::S));
+  // the transitions due by now have been processed by the reads above
+  NS_TEST_EXPECT_MSG_EQ (m_batchChanges, m_referenceChanges, "Wrong number of course changes at " << Simulator::Now ().As (Time::S));
+}
+
+void
+BatchMobilityModelWaypointTest::DoRun (void)
+{
+  BatchMobilityManager::Get ()->SetAttribute ("Interval", TimeValue (m_interval));
+  m_reference = CreateObjectWithAttributes<RandomWaypointMobilityModel>
+      ("Speed", StringValue ("ns3::ConstantRandomVariable[Constant=2.0]"),
+       "Pause", StringValue ("ns3::ConstantRandomVariable[Constant=1.0]"),
+       "PositionAllocator", PointerValue (CreateWaypoints ()));
+  m_batch = CreateObjectWithAttributes<BatchMobilityModel>
+      ("Speed", StringValue ("ns3::ConstantRandomVariable[Constant=2.0]"),
+       "Pause", StringValue ("ns3::ConstantRandomVariable[Constant=1.0]"),
+       "PositionAllocator", PointerValue (CreateWaypoints ()));
+  m_reference->TraceConnectWithoutContext ("CourseChange", MakeBoundCallback (&CourseChange, &m_referenceChanges));
+  m_batch->TraceConnectWithoutContext ("CourseChange", MakeBoundCallback (&CourseChange, &m_batchChanges));
+  m_reference->Initialize ();
+  m_batch->Initialize ();
+
+  // sample at times which do not coincide with the waypoint transitions
+  for (Time t = MilliSeconds (370); t < Seconds (40); t += MilliSeconds (370))
+    {
+      Simulator::Schedule (t, &BatchMobilityModelWaypointTest::Compare, this);
+    }
+  Simulator::Stop (Seconds (40));
+  Simulator::Run ();
+  NS_TEST_EXPECT_MSG_GT (m_batchChanges, 10, "Too few waypoints were visited");
+  Simulator::Destroy ();
+  m_reference = 0;
+  m_batch = 0;
+}
+
+/**
+ * \ingroup mobility-test
+ * \ingroup tests
+ *
+ * \brief BatchMobilityModel Test Suite
+ */
+static struct BatchMobilityModelTestSuite : public TestSuite
+{
+  BatchMobilityModelTestSuite () : TestSuite ("batch-mobility-model", UNIT)
+  {
+    AddTestCase (new BatchMobilityModelVelocityTest (), TestCase::QUICK);
+    AddTestCase (new BatchMobilityModelWaypointTest (MilliSeconds (100)), TestCase::QUICK);
+    AddTestCase (new BatchMobilityModelWaypointTest (Seconds (5)), TestCase::QUICK);
+  }
+} g_batchMobilityModelTestSuite; ///< the test suite
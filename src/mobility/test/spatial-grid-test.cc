@@ -0,0 +1,166 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include "ns3/simulator.h"
+#include "ns3/constant-position-mobility-model.h"
+#include "ns3/constant-velocity-mobility-model.h"
+#include "ns3/spatial-grid.h"
+#include "ns3/test.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup mobility-test
+ * \ingroup tests
+ *
+ * \brief Spatial Grid Range Query Test
+ *
+ * Compares the range queries of a grid of static models with a
+ * linear scan, for ranges smaller and larger than the cells.
+ */
+class SpatialGridRangeTest : public TestCase
+{
+public:
+  SpatialGridRangeTest ();
+
+private:
+  virtual void DoRun (void);
+};
+
+SpatialGridRangeTest::SpatialGridRangeTest ()
+  : TestCase ("Check the range queries of a grid of static models")
+{
+}
+
+void
+SpatialGridRangeTest::DoRun (void)
+{
+  SpatialGrid grid (25);
+  std::vector<Ptr<MobilityModel> > models;
+  for (uint32_t i = 0; i < 100; i++)
+    {
+      Ptr<MobilityModel> model = CreateObject<ConstantPositionMobilityModel> ();
+      model->SetPosition (Vector (10.0 * (i % 10) - 20, 10.0 * (i / 10) - 20, 0));
+      models.push_back (model);
+      grid.Add (i, model);
+    }
+
+  const Vector positions[] = { Vector (25, 25, 0), Vector (-20, -20, 0), Vector (3, 71, 0), Vector (0, 0, 40) };
+  const double ranges[] = { 0, 10, 15, 42, 1000 };
+  for (const Vector &position : positions)
+    {
+      for (double range : ranges)
+        {
+          std::vector<uint32_t> expected;
+          for (uint32_t i = 0; i < models.size (); i++)
+            {
+              if (CalculateDistance (models[i]->GetPosition (), position) <= range)
+                {
+                  expected.push_back (i);
+                }
+            }
+          std::vector<uint32_t> ids;
+          grid.GetInRange (position, range, ids);
+          NS_TEST_EXPECT_MSG_EQ ((ids == expected), true, "Wrong models within " << range << " m of " << position);
+        }
+    }
+
+  // A model set to a new position leaves its cell
+  models[0]->SetPosition (Vector (500, 500, 0));
+  std::vector<uint32_t> ids;
+  grid.GetInRange (Vector (-20, -20, 0), 1, ids);
+  NS_TEST_EXPECT_MSG_EQ (ids.size (), 0, "Model 0 should have left its cell");
+  grid.GetInRange (Vector (500, 501, 0), 1, ids);
+  NS_TEST_ASSERT_MSG_EQ (ids.size (), 1, "Model 0 should be in its new cell");
+  NS_TEST_EXPECT_MSG_EQ (ids[0], 0, "Model 0 should be in its new cell");
+
+  grid.Clear ();
+  grid.GetInRange (Vector (0, 0, 0), 1000, ids);
+  NS_TEST_EXPECT_MSG_EQ (ids.size (), 0, "The grid should be empty");
+}
+
+/**
+ * \ingroup mobility-test
+ * \ingroup tests
+ *
+ * \brief Spatial Grid Moving Model Test
+ *
+ * Checks that a model is found at its current position while it
+ * moves, and after it stops.
+ */
+class SpatialGridMovingTest : public TestCase
+{
+public:
+  SpatialGridMovingTest ();
+
+private:
+  virtual void DoRun (void);
+  /**
+   * Check the models within range of a position.
+   * \param position The position.
+   * \param expected The number of models expected within 1 m.
+   */
+  void Check (Vector position, uint32_t expected);
+
+  SpatialGrid m_grid; ///< The grid
+};
+
+SpatialGridMovingTest::SpatialGridMovingTest ()
+  : TestCase ("Check the range queries of a moving model"),
+    m_grid (10)
+{
+}
+
+void
+SpatialGridMovingTest::Check (Vector position, uint32_t expected)
+{
+  std::vector<uint32_t> ids;
+  m_grid.GetInRange (position, 1, ids);
+  NS_TEST_EXPECT_MSG_EQ (ids.size (), expected, "Wrong number of models around " << position << " at " << Simulator::Now ().As (Time::S));
+}
+
+void
+SpatialGridMovingTest::DoRun (void)
+{
+  Ptr<ConstantVelocityMobilityModel> model = CreateObject<ConstantVelocityMobilityModel> ();
+  model->SetPosition (Vector (0, 0, 0));
+  m_grid.Add (7, model);
+  Check (Vector (0, 0, 0), 1);
+
+  model->SetVelocity (Vector (10, 0, 0));
+  Simulator::Schedule (Seconds (5), &SpatialGridMovingTest::Check, this, Vector (50, 0, 0), 1);
+  Simulator::Schedule (Seconds (5), &SpatialGridMovingTest::Check, this, Vector (0, 0, 0), 0);
+  Simulator::Schedule (Seconds (10), &ConstantVelocityMobilityModel::SetVelocity, model, Vector (0, 0, 0));
+  Simulator::Schedule (Seconds (20), &SpatialGridMovingTest::Check, this, Vector (100, 0, 0), 1);
+  Simulator::Run ();
+  Simulator::Destroy ();
+  m_grid.Clear ();
+}
+
+/**
+ * \ingroup mobility-test
+ * \ingroup tests
+ *
+ * \brief Spatial Grid Test Suite
+ */
+static struct SpatialGridTestSuite : public TestSuite
+{
+  SpatialGridTestSuite () : TestSuite ("spatial-grid", UNIT)
+  {
+    AddTestCase (new SpatialGridRangeTest (), TestCase::QUICK);
+    AddTestCase (new SpatialGridMovingTest (), TestCase::QUICK);
+  }
+} g_spatialGridTestSuite; ///< the test suite
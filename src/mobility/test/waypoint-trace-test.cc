@@ -0,0 +1,265 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <fstream>
+#include "ns3/simulator.h"
+#include "ns3/uinteger.h"
+#include "ns3/node-container.h"
+#include "ns3/ns2-mobility-helper.h"
+#include "ns3/waypoint-trace-helper.h"
+#include "ns3/streaming-waypoint-mobility-model.h"
+#include "ns3/test.h"
+
+using namespace ns3;
+
+/**
+ * \ingroup mobility-test
+ * \ingroup tests
+ *
+ * \brief Check that an ns-2 trace converted to a binary waypoint trace
+ * moves the nodes as the ns-2 trace does.
+ */
+class WaypointTraceNs2Test : public TestCase
+{
+public:
+  /**
+   * Constructor
+   * \param lookahead the lookahead of the streaming models
+   */
+  WaypointTraceNs2Test (uint32_t lookahead);
+
+private:
+  virtual void DoRun (void);
+  /**
+   * Compare the positions of the nodes moved by both helpers.
+   */
+  void Compare (void);
+
+  uint32_t m_lookahead; //!< lookahead of the streaming models
+  NodeContainer m_ns2; //!< the nodes moved by Ns2MobilityHelper
+  NodeContainer m_binary; //!< the nodes moved by WaypointTraceHelper
+};
+
+WaypointTraceNs2Test::WaypointTraceNs2Test (uint32_t lookahead)
+  : TestCase ("Check a binary waypoint trace against its ns-2 trace, lookahead "
+              + std::to_string (lookahead)),
+    m_lookahead (lookahead)
+{
+}
+
+void
+WaypointTraceNs2Test::Compare (void)
+{
+  for (uint32_t i = 0; i < m_ns2.GetN (); i++)
+    {
+      Ptr<MobilityModel> reference = m_ns2.Get (i)->GetObject<MobilityModel> ();
+      if (reference == 0)
+        {
+          // not in the ns-2 trace
+          continue;
+        }
+      Vector expected = reference->GetPosition ();
+      Ptr<StreamingWaypointMobilityModel> model = m_binary.Get (i)->GetObject<StreamingWaypointMobilityModel> ();
+      Vector position = model->GetPosition ();
+      NS_TEST_EXPECT_MSG_EQ_TOL (position.x, expected.x, 1e-3, "Wrong x for node " << i << " at " << Simulator::Now ().As (Time::S));
+      NS_TEST_EXPECT_MSG_EQ_TOL (position.y, expected.y, 1e-3, "Wrong y for node " << i << " at " << Simulator::Now ().As (Time::S));
+      NS_TEST_EXPECT_MSG_EQ_TOL (position.z, expected.z, 1e-3, "Wrong z for node " << i << " at " << Simulator::Now ().As (Time::S));
+      UintegerValue left;
+      model->GetAttribute ("WaypointsLeft", left);
+      NS_TEST_EXPECT_MSG_LT_OR_EQ (left.Get (), m_lookahead, "Too many waypoints read for node " << i);
+    }
+}
+
+void
+WaypointTraceNs2Test::DoRun (void)
+{
+  std::string ns2File = CreateTempDirFilename ("waypoint-trace-test.ns_movements");
+  std::string binaryFile = CreateTempDirFilename ("waypoint-trace-test.wpt");
+  std::ofstream of (ns2File.c_str ());
+  NS_TEST_ASSERT_MSG_EQ (of.is_open (), true, "Need to write tmp. file");
+  of << "$node_(0) set X_ 0.0\n"
+        "$node_(0) set Y_ 0.0\n"
+        "$node_(0) set Z_ 1.5\n"
+        "$ns_ at 1.0 \"$node_(0) setdest 10.0 0.0 2.0\"\n"
+        "$ns_ at 7.0 \"$node_(0) setdest 10.0 10.0 5.0\"\n"
+        "$ns_ at 8.0 \"$node_(0) setdest 0.0 10.0 1.0\"\n"      // interrupts the previous move
+        "$ns_ at 9.0 \"$node_(0) setdest 20.0 20.0 0.0\"\n"     // stops
+        "$ns_ at 10.5 \"$node_(0) setdest 40.0 40.0 4.0\"\n"
+        "$ns_ at 2.0 \"$node_(2) setdest 5.0 5.0 1.0\"\n"
+        "$ns_ at 3.0 \"$node_(2) setdest 5.0 5.0 1.0\"\n"
+        "$node_(2) set X_ 3.0\n"                                 // initial position at the end
+        "$node_(2) set Y_ 4.0\n";
+  of.close ();
+  Ns2MobilityHelper ns2 (ns2File);
+  ns2.ConvertToWaypointTrace (binaryFile);
+
+  m_ns2.Create (3);
+  m_binary.Create (3);
+  ns2.Install (m_ns2.Begin (), m_ns2.End ());
+  WaypointTraceHelper binary (binaryFile);
+  NS_TEST_EXPECT_MSG_EQ (binary.GetNNodes (), 3, "Wrong number of nodes in the binary trace");
+  binary.SetAttribute ("Lookahead", UintegerValue (m_lookahead));
+  binary.Install (m_binary);
+  NS_TEST_EXPECT_MSG_EQ ((m_binary.Get (1)->GetObject<MobilityModel> () != 0), true, "Node 1 has no mobility model");
+
+  // sample at times which do not coincide with the trace events
+  for (Time t = Seconds (0); t < Seconds (20); t += MilliSeconds (130))
+    {
+      Simulator::Schedule (t, &WaypointTraceNs2Test::Compare, this);
+    }
+  Simulator::Stop (Seconds (20));
+  Simulator::Run ();
+  Simulator::Destroy ();
+  m_ns2 = NodeContainer ();
+  m_binary = NodeContainer ();
+}
+
+/**
+ * \ingroup mobility-test
+ * \ingroup tests
+ *
+ * \brief Check the conversion of the scheduled sets of coordinates of
+ * an ns-2 trace.
+ *
+ * Ns2MobilityHelper applies them when it reads the trace rather than at
+ * their time, so they are checked against the expected positions.
+ */
+class WaypointTraceJumpTest : public TestCase
+{
+public:
+  WaypointTraceJumpTest ();
+
+private:
+  virtual void DoRun (void);
+  /**
+   * Check the position of the node.
+   * \param expected the expected position
+   */
+  void CheckPosition (Vector expected);
+
+  NodeContainer m_nodes; //!< the node
+};
+
+WaypointTraceJumpTest::WaypointTraceJumpTest ()
+  : TestCase ("Check the jumps of a binary waypoint trace converted from an ns-2 trace")
+{
+}
+
+void
+WaypointTraceJumpTest::CheckPosition (Vector expected)
+{
+  Vector position = m_nodes.Get (0)->GetObject<MobilityModel> ()->GetPosition ();
+  NS_TEST_EXPECT_MSG_EQ_TOL (position.x, expected.x, 1e-6, "Wrong x at " << Simulator::Now ().As (Time::S));
+  NS_TEST_EXPECT_MSG_EQ_TOL (position.y, expected.y, 1e-6, "Wrong y at " << Simulator::Now ().As (Time::S));
+  NS_TEST_EXPECT_MSG_EQ_TOL (position.z, expected.z, 1e-6, "Wrong z at " << Simulator::Now ().As (Time::S));
+}
+
+void
+WaypointTraceJumpTest::DoRun (void)
+{
+  std::string ns2File = CreateTempDirFilename ("waypoint-trace-jump-test.ns_movements");
+  std::string binaryFile = CreateTempDirFilename ("waypoint-trace-jump-test.wpt");
+  std::ofstream of (ns2File.c_str ());
+  NS_TEST_ASSERT_MSG_EQ (of.is_open (), true, "Need to write tmp. file");
+  of << "$node_(0) set X_ 1.0\n"
+        "$ns_ at 1.0 \"$node_(0) setdest 11.0 0.0 2.0\"\n"
+        "$ns_ at 2.0 \"$node_(0) set X_ 30.0\"\n"             // jumps while moving
+        "$ns_ at 2.0 \"$node_(0) set Y_ 40.0\"\n"
+        "$ns_ at 2.0 \"$node_(0) setdest 30.0 50.0 1.0\"\n"
+        "$ns_ at 5.0 \"$node_(0) set Z_ 2.0\"\n";              // jumps while moving
+  of.close ();
+  Ns2MobilityHelper (ns2File).ConvertToWaypointTrace (binaryFile);
+  m_nodes.Create (1);
+  WaypointTraceHelper (binaryFile).Install (m_nodes);
+
+  Simulator::Schedule (Seconds (1.5), &WaypointTraceJumpTest::CheckPosition, this, Vector (2, 0, 0));
+  Simulator::Schedule (Seconds (3), &WaypointTraceJumpTest::CheckPosition, this, Vector (30, 41, 0));
+  Simulator::Schedule (Seconds (6), &WaypointTraceJumpTest::CheckPosition, this, Vector (30, 43, 2));
+  Simulator::Run ();
+  Simulator::Destroy ();
+  m_nodes = NodeContainer ();
+}
+
+/**
+ * \ingroup mobility-test
+ * \ingroup tests
+ *
+ * \brief Check a binary waypoint trace written by WaypointTraceFile.
+ */
+class WaypointTraceFileTest : public TestCase
+{
+public:
+  WaypointTraceFileTest ();
+
+private:
+  virtual void DoRun (void);
+};
+
+WaypointTraceFileTest::WaypointTraceFileTest ()
+  : TestCase ("Check the write and read back of a binary waypoint trace")
+{
+}
+
+void
+WaypointTraceFileTest::DoRun (void)
+{
+  std::vector<std::vector<WaypointTraceRecord> > waypoints (3);
+  for (uint32_t i = 0; i < 100; i++)
+    {
+      WaypointTraceRecord record = { 0.5 * i, 1.0 * i, 2.0 * i, 3.0 };
+      waypoints[2].push_back (record);
+    }
+  WaypointTraceRecord record = { 1, 2, 3, 4 };
+  waypoints[0].push_back (record);
+  std::string filename = CreateTempDirFilename ("waypoint-trace-file-test.wpt");
+  WaypointTraceFile::Write (filename, waypoints);
+
+  Ptr<WaypointTraceFile> trace = Create<WaypointTraceFile> (filename);
+  NS_TEST_ASSERT_MSG_EQ (trace->GetNNodes (), 3, "Wrong number of nodes");
+  NS_TEST_EXPECT_MSG_EQ (trace->End (0) - trace->Begin (0), 1, "Wrong number of waypoints for node 0");
+  NS_TEST_EXPECT_MSG_EQ (trace->End (1) - trace->Begin (1), 0, "Wrong number of waypoints for node 1");
+  NS_TEST_ASSERT_MSG_EQ (trace->End (2) - trace->Begin (2), 100, "Wrong number of waypoints for node 2");
+  NS_TEST_EXPECT_MSG_EQ (trace->Begin (0)->z, 4, "Wrong waypoint for node 0");
+  NS_TEST_EXPECT_MSG_EQ (trace->Begin (2)[99].time, 49.5, "Wrong time for node 2");
+  NS_TEST_EXPECT_MSG_EQ (trace->Begin (2)[99].y, 198, "Wrong position for node 2");
+
+  // a model started in the middle of the trace starts on its current segment
+  Ptr<StreamingWaypointMobilityModel> model = CreateObject<StreamingWaypointMobilityModel> ();
+  Simulator::Schedule (Seconds (10.25), &StreamingWaypointMobilityModel::SetTrace, model, trace, 2);
+  Simulator::Stop (Seconds (20.25));
+  Simulator::Run ();
+  Vector position = model->GetPosition ();
+  NS_TEST_EXPECT_MSG_EQ_TOL (position.x, 40.5, 1e-9, "Wrong position");
+  NS_TEST_EXPECT_MSG_EQ_TOL (position.y, 81, 1e-9, "Wrong position");
+  Simulator::Destroy ();
+}
+
+/**
+ * \ingroup mobility-test
+ * \ingroup tests
+ *
+ * \brief Binary waypoint trace Test Suite
+ */
+static struct WaypointTraceTestSuite : public TestSuite
+{
+  WaypointTraceTestSuite () : TestSuite ("mobility-waypoint-trace", UNIT)
+  {
+    AddTestCase (new WaypointTraceFileTest (), TestCase::QUICK);
+    AddTestCase (new WaypointTraceNs2Test (1), TestCase::QUICK);
+    AddTestCase (new WaypointTraceJumpTest (), TestCase::QUICK);
+    AddTestCase (new WaypointTraceNs2Test (8), TestCase::QUICK);
+  }
+} g_waypointTraceTestSuite; ///< the test suite
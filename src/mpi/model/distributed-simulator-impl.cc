@@ -380,7 +380,10 @@ DistributedSimulatorImpl::Run (void)
       if (nextTime > m_grantedTime || IsLocalFinished () )
         {
           // Can't process next event, calculate a new LBTS
-          // First receive any pending messages
+          double syncStart = MPI_Wtime ();
+          // First send the packets batched during this window
+          GrantedTimeWindowMpiInterface::FlushMessages ();
+          // Then receive any pending messages
           GrantedTimeWindowMpiInterface::ReceiveMessages ();
           // reset next time
           nextTime = Next ();
@@ -430,6 +433,7 @@ DistributedSimulatorImpl::Run (void)
                   m_grantedTime = smallestTime + m_lookAhead;
                 }
             }
+          GrantedTimeWindowMpiInterface::g_syncTime += MPI_Wtime () - syncStart;
         }
 
       // Execute next event if it is within the current time window.
@@ -40,6 +40,7 @@
 #include "ns3/simulator-impl.h"
 #include "ns3/nstime.h"
 #include "ns3/log.h"
+#include "ns3/abort.h"
 
 #include <mpi.h>
 
@@ -84,10 +85,17 @@ bool                  GrantedTimeWindowMpiInterface::g_enabled = false;
 bool                  GrantedTimeWindowMpiInterface::g_mpiInitCalled = false;
 uint32_t              GrantedTimeWindowMpiInterface::g_rxCount = 0;
 uint32_t              GrantedTimeWindowMpiInterface::g_txCount = 0;
+uint64_t              GrantedTimeWindowMpiInterface::g_rxMessages = 0;
+uint64_t              GrantedTimeWindowMpiInterface::g_txMessages = 0;
+uint64_t              GrantedTimeWindowMpiInterface::g_rxBytes = 0;
+uint64_t              GrantedTimeWindowMpiInterface::g_txBytes = 0;
+double                GrantedTimeWindowMpiInterface::g_syncTime = 0;
 std::list<SentBuffer> GrantedTimeWindowMpiInterface::g_pendingTx;
 
 MPI_Request* GrantedTimeWindowMpiInterface::g_requests;
 char**       GrantedTimeWindowMpiInterface::g_pRxBuffers;
+uint8_t**    GrantedTimeWindowMpiInterface::g_pTxBuffers;
+uint32_t*    GrantedTimeWindowMpiInterface::g_txSizes;
 MPI_Comm     GrantedTimeWindowMpiInterface::g_communicator = MPI_COMM_WORLD;
 bool         GrantedTimeWindowMpiInterface::g_freeCommunicator = false;;
 
@@ -109,8 +117,11 @@ GrantedTimeWindowMpiInterface::Destroy ()
   for (uint32_t i = 0; i < GetSize (); ++i)
     {
       delete [] g_pRxBuffers[i];
+      delete [] g_pTxBuffers[i];
     }
   delete [] g_pRxBuffers;
+  delete [] g_pTxBuffers;
+  delete [] g_txSizes;
   delete [] g_requests;
 
   g_pendingTx.clear ();
@@ -199,10 +210,47 @@ GrantedTimeWindowMpiInterface::Enable (MPI_Comm communicator)
   g_requests = new MPI_Request[g_size];
   for (uint32_t i = 0; i < GetSize (); ++i)
     {
-      g_pRxBuffers[i] = new char[MAX_MPI_MSG_SIZE];
-      MPI_Irecv (g_pRxBuffers[i], MAX_MPI_MSG_SIZE, MPI_CHAR, MPI_ANY_SOURCE, 0,
+      g_pRxBuffers[i] = new char[MAX_MPI_BATCH_SIZE];
+      MPI_Irecv (g_pRxBuffers[i], MAX_MPI_BATCH_SIZE, MPI_CHAR, MPI_ANY_SOURCE, 0,
                  g_communicator, &g_requests[i]);
     }
+  // Batch buffers are allocated when the first packet of a batch is sent
+  g_pTxBuffers = new uint8_t*[g_size];
+  g_txSizes = new uint32_t[g_size];
+  for (uint32_t i = 0; i < GetSize (); ++i)
+    {
+      g_pTxBuffers[i] = 0;
+      g_txSizes[i] = 0;
+    }
+}
+
+/**
+ * \ingroup mpi
+ * Header of a packet in a batch message.
+ *
+ * The packets of a batch are stored back to back, each one as this
+ * header followed by the serialized packet, padded to a multiple of
+ * 8 bytes so that the next header is aligned.
+ */
+struct BatchRecordHeader
+{
+  uint64_t rxTime;  //!< Receive time at the destination node.
+  uint32_t node;    //!< Destination node id.
+  uint32_t dev;     //!< Destination device interface index.
+  uint32_t size;    //!< Serialized packet size.
+  uint32_t pad;     //!< Padding, keeps the packet data aligned.
+};
+
+/**
+ * Size of a batch record, including its padding.
+ *
+ * \param [in] serializedSize The serialized packet size.
+ * \return The record size.
+ */
+static uint32_t
+GetBatchRecordSize (uint32_t serializedSize)
+{
+  return sizeof (BatchRecordHeader) + ((serializedSize + 7) & ~7U);
 }
 
 void
@@ -210,30 +258,74 @@ GrantedTimeWindowMpiInterface::SendPacket (Ptr<Packet> p, const Time& rxTime, ui
 {
   NS_LOG_FUNCTION (this << p << rxTime.GetTimeStep () << node << dev);
 
-  SentBuffer sendBuf;
-  g_pendingTx.push_back (sendBuf);
-  std::list<SentBuffer>::reverse_iterator i = g_pendingTx.rbegin (); // Points to the last element
+  // Find the system id for the destination node
+  Ptr<Node> destNode = NodeList::GetNode (node);
+  uint32_t nodeSysId = destNode->GetSystemId ();
 
   uint32_t serializedSize = p->GetSerializedSize ();
-  uint8_t* buffer =  new uint8_t[serializedSize + 16];
-  i->SetBuffer (buffer);
+  uint32_t recordSize = GetBatchRecordSize (serializedSize);
+  NS_ABORT_MSG_IF (recordSize > MAX_MPI_BATCH_SIZE,
+                   "Packet of " << serializedSize << " bytes too large for an MPI message");
+
+  // The packet is only batched here: the batches are sent once per
+  // time window, just before synchronizing with the other ranks.
+  if (g_txSizes[nodeSysId] + recordSize > MAX_MPI_BATCH_SIZE)
+    {
+      FlushMessage (nodeSysId);
+    }
+  if (g_pTxBuffers[nodeSysId] == 0)
+    {
+      g_pTxBuffers[nodeSysId] = new uint8_t[MAX_MPI_BATCH_SIZE];
+    }
+  uint8_t* buffer = g_pTxBuffers[nodeSysId] + g_txSizes[nodeSysId];
   // Add the time, dest node and dest device
-  uint64_t t = rxTime.GetInteger ();
-  uint64_t* pTime = reinterpret_cast <uint64_t *> (buffer);
-  *pTime++ = t;
-  uint32_t* pData = reinterpret_cast<uint32_t *> (pTime);
-  *pData++ = node;
-  *pData++ = dev;
+  BatchRecordHeader* header = reinterpret_cast<BatchRecordHeader *> (buffer);
+  header->rxTime = rxTime.GetInteger ();
+  header->node = node;
+  header->dev = dev;
+  header->size = serializedSize;
+  header->pad = 0;
   // Serialize the packet
-  p->Serialize (reinterpret_cast<uint8_t *> (pData), serializedSize);
+  p->Serialize (buffer + sizeof (BatchRecordHeader), serializedSize);
+  g_txSizes[nodeSysId] += recordSize;
+  g_txCount++;
+}
 
-  // Find the system id for the destination node
-  Ptr<Node> destNode = NodeList::GetNode (node);
-  uint32_t nodeSysId = destNode->GetSystemId ();
+void
+GrantedTimeWindowMpiInterface::FlushMessage (uint32_t rank)
+{
+  NS_LOG_FUNCTION (rank);
+
+  if (g_txSizes[rank] == 0)
+    {
+      return;
+    }
 
-  MPI_Isend (reinterpret_cast<void *> (i->GetBuffer ()), serializedSize + 16, MPI_CHAR, nodeSysId,
+  // The batch buffer is handed over to the pending send, which
+  // releases it once the send is complete.
+  SentBuffer sendBuf;
+  g_pendingTx.push_back (sendBuf);
+  std::list<SentBuffer>::reverse_iterator i = g_pendingTx.rbegin (); // Points to the last element
+  i->SetBuffer (g_pTxBuffers[rank]);
+
+  MPI_Isend (reinterpret_cast<void *> (i->GetBuffer ()), g_txSizes[rank], MPI_CHAR, rank,
              0, g_communicator, (i->GetRequest ()));
-  g_txCount++;
+  g_txMessages++;
+  g_txBytes += g_txSizes[rank];
+
+  g_pTxBuffers[rank] = 0;
+  g_txSizes[rank] = 0;
+}
+
+void
+GrantedTimeWindowMpiInterface::FlushMessages ()
+{
+  NS_LOG_FUNCTION_NOARGS ();
+
+  for (uint32_t rank = 0; rank < g_size; ++rank)
+    {
+      FlushMessage (rank);
+    }
 }
 
 void
@@ -255,43 +347,48 @@ GrantedTimeWindowMpiInterface::ReceiveMessages ()
         }
       int count;
       MPI_Get_count (&status, MPI_CHAR, &count);
-      g_rxCount++; // Count this receive
-
-      // Get the meta data first
-      uint64_t* pTime = reinterpret_cast<uint64_t *> (g_pRxBuffers[index]);
-      uint64_t time = *pTime++;
-      uint32_t* pData = reinterpret_cast<uint32_t *> (pTime);
-      uint32_t node = *pData++;
-      uint32_t dev  = *pData++;
-
-      Time rxTime (time);
-
-      count -= sizeof (time) + sizeof (node) + sizeof (dev);
-
-      Ptr<Packet> p = Create<Packet> (reinterpret_cast<uint8_t *> (pData), count, true);
+      g_rxMessages++;
+      g_rxBytes += count;
 
-      // Find the correct node/device to schedule receive event
-      Ptr<Node> pNode = NodeList::GetNode (node);
-      Ptr<MpiReceiver> pMpiRec = 0;
-      uint32_t nDevices = pNode->GetNDevices ();
-      for (uint32_t i = 0; i < nDevices; ++i)
+      // Rebuild each packet of the batch straight from the receive buffer
+      uint8_t* buffer = reinterpret_cast<uint8_t *> (g_pRxBuffers[index]);
+      uint8_t* end = buffer + count;
+      while (buffer < end)
         {
-          Ptr<NetDevice> pThisDev = pNode->GetDevice (i);
-          if (pThisDev->GetIfIndex () == dev)
+          g_rxCount++; // Count this receive
+
+          // Get the meta data first
+          const BatchRecordHeader* header = reinterpret_cast<const BatchRecordHeader *> (buffer);
+          Time rxTime (header->rxTime);
+          uint32_t node = header->node;
+          uint32_t dev = header->dev;
+
+          Ptr<Packet> p = Create<Packet> (buffer + sizeof (BatchRecordHeader), header->size, true);
+          buffer += GetBatchRecordSize (header->size);
+
+          // Find the correct node/device to schedule receive event
+          Ptr<Node> pNode = NodeList::GetNode (node);
+          Ptr<MpiReceiver> pMpiRec = 0;
+          uint32_t nDevices = pNode->GetNDevices ();
+          for (uint32_t i = 0; i < nDevices; ++i)
             {
-              pMpiRec = pThisDev->GetObject<MpiReceiver> ();
-              break;
+              Ptr<NetDevice> pThisDev = pNode->GetDevice (i);
+              if (pThisDev->GetIfIndex () == dev)
+                {
+                  pMpiRec = pThisDev->GetObject<MpiReceiver> ();
+                  break;
+                }
             }
-        }
 
-      NS_ASSERT (pNode && pMpiRec);
+          NS_ASSERT (pNode && pMpiRec);
 
-      // Schedule the rx event
-      Simulator::ScheduleWithContext (pNode->GetId (), rxTime - Simulator::Now (),
-                                      &MpiReceiver::Receive, pMpiRec, p);
+          // Schedule the rx event
+          Simulator::ScheduleWithContext (pNode->GetId (), rxTime - Simulator::Now (),
+                                          &MpiReceiver::Receive, pMpiRec, p);
+        }
 
       // Re-queue the next read
-      MPI_Irecv (g_pRxBuffers[index], MAX_MPI_MSG_SIZE, MPI_CHAR, MPI_ANY_SOURCE, 0,
+      MPI_Irecv (g_pRxBuffers[index], MAX_MPI_BATCH_SIZE, MPI_CHAR, MPI_ANY_SOURCE, 0,
                  g_communicator, &g_requests[index]);
     }
 }
@@ -316,6 +413,17 @@ GrantedTimeWindowMpiInterface::TestSendComplete ()
     }
 }
 
+void
+GrantedTimeWindowMpiInterface::PrintStatistics (std::ostream &os)
+{
+  NS_LOG_FUNCTION (this << &os);
+
+  os << "rank " << g_sid
+     << " sent " << g_txCount << " packets in " << g_txMessages << " messages (" << g_txBytes << " bytes),"
+     << " received " << g_rxCount << " packets in " << g_rxMessages << " messages (" << g_rxBytes << " bytes),"
+     << " synchronization " << g_syncTime << " s" << std::endl;
+}
+
 void
 GrantedTimeWindowMpiInterface::Disable ()
 {
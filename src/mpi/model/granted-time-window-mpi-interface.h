@@ -30,6 +30,7 @@
 
 #include <stdint.h>
 #include <list>
+#include <ostream>
 
 #include "ns3/nstime.h"
 #include "ns3/buffer.h"
@@ -46,6 +47,13 @@ namespace ns3 {
  */
 const uint32_t MAX_MPI_MSG_SIZE = 2000;
 
+/**
+ * Maximum size of an MPI message carrying a batch of packets.
+ * The packets sent to a rank during a time window are serialized
+ * back to back into messages of at most this size.
+ */
+const uint32_t MAX_MPI_BATCH_SIZE = 65536;
+
 /**
  * \ingroup mpi
  *
@@ -109,6 +117,7 @@ public:
   virtual void Disable();
   virtual void SendPacket (Ptr<Packet> p, const Time &rxTime, uint32_t node, uint32_t dev);
   virtual MPI_Comm GetCommunicator();
+  virtual void PrintStatistics (std::ostream &os);
 
 private:
 
@@ -124,6 +133,17 @@ private:
    * Check for received messages complete
    */
   static void ReceiveMessages ();
+  /**
+   * Send the packets batched for each rank since the last call,
+   * one message per rank.
+   */
+  static void FlushMessages ();
+  /**
+   * Send the packets batched for one rank.
+   *
+   * \param rank The destination rank.
+   */
+  static void FlushMessage (uint32_t rank);
   /**
    * Check for completed sends
    */
@@ -148,6 +168,21 @@ private:
   /** Total packets sent. */
   static uint32_t g_txCount;
 
+  /** Total MPI messages received. */
+  static uint64_t g_rxMessages;
+
+  /** Total MPI messages sent. */
+  static uint64_t g_txMessages;
+
+  /** Total bytes received. */
+  static uint64_t g_rxBytes;
+
+  /** Total bytes sent. */
+  static uint64_t g_txBytes;
+
+  /** Wall clock time spent synchronizing with the other ranks, in seconds. */
+  static double g_syncTime;
+
   /** Has this interface been enabled. */
   static bool     g_enabled;
 
@@ -163,6 +198,12 @@ private:
   /** Data buffers for non-blocking reads. */
   static char**   g_pRxBuffers;
 
+  /** Data buffers for the packets batched for each rank. */
+  static uint8_t** g_pTxBuffers;
+
+  /** Bytes used in each of the batch buffers. */
+  static uint32_t* g_txSizes;
+
   /** List of pending non-blocking sends. */
   static std::list<SentBuffer> g_pendingTx;
 
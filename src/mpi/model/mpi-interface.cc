@@ -141,6 +141,12 @@ MpiInterface::GetCommunicator()
   return g_parallelCommunicationInterface->GetCommunicator ();
 }
 
+void
+MpiInterface::PrintStatistics (std::ostream &os)
+{
+  NS_ASSERT (g_parallelCommunicationInterface);
+  g_parallelCommunicationInterface->PrintStatistics (os);
+}
 
 void
 MpiInterface::Disable ()
@@ -31,6 +31,7 @@
 #include <ns3/packet.h>
 
 #include "mpi.h"
+#include <ostream>
 
 namespace ns3 {
 /**
@@ -150,6 +151,18 @@ public:
    */
   static MPI_Comm GetCommunicator();
 
+  /**
+   * \brief Print the communication statistics of this rank.
+   *
+   * Prints the number of packets, MPI messages and bytes sent and
+   * received by this rank, and the wall clock time it spent
+   * synchronizing with the other ranks, that is waiting for them
+   * rather than processing events.
+   *
+   * \param os The output stream.
+   */
+  static void PrintStatistics (std::ostream &os);
+
 private:
 
   /**
@@ -128,6 +128,13 @@ NullMessageSentBuffer::GetRequest ()
 uint32_t              NullMessageMpiInterface::g_sid = 0;
 uint32_t              NullMessageMpiInterface::g_size = 1;
 uint32_t              NullMessageMpiInterface::g_numNeighbors = 0;
+uint64_t              NullMessageMpiInterface::g_txCount = 0;
+uint64_t              NullMessageMpiInterface::g_rxCount = 0;
+uint64_t              NullMessageMpiInterface::g_txMessages = 0;
+uint64_t              NullMessageMpiInterface::g_rxMessages = 0;
+uint64_t              NullMessageMpiInterface::g_txBytes = 0;
+uint64_t              NullMessageMpiInterface::g_rxBytes = 0;
+double                NullMessageMpiInterface::g_syncTime = 0;
 bool                  NullMessageMpiInterface::g_enabled = false;
 bool                  NullMessageMpiInterface::g_mpiInitCalled = false;
 
@@ -291,6 +298,9 @@ NullMessageMpiInterface::SendPacket (Ptr<Packet> p, const Time& rxTime, uint32_t
 
   MPI_Isend (reinterpret_cast<void *> (iter->GetBuffer ()), bufferSize, MPI_CHAR, nodeSysId,
              0, g_communicator, (iter->GetRequest ()));
+  g_txCount++;
+  g_txMessages++;
+  g_txBytes += bufferSize;
 
   NullMessageSimulatorImpl::GetInstance ()->RescheduleNullMessageEvent (nodeSysId);
 }
@@ -322,6 +332,8 @@ NullMessageMpiInterface::SendNullMessage (const Time& guarantee_update, Ptr<Remo
 
   MPI_Isend (reinterpret_cast<void *> (iter->GetBuffer ()), bufferSize, MPI_CHAR, nodeSysId,
              0, g_communicator, (iter->GetRequest ()));
+  g_txMessages++;
+  g_txBytes += bufferSize;
 }
 
 void
@@ -366,7 +378,9 @@ NullMessageMpiInterface::ReceiveMessages (bool blocking)
 
       if (blocking)
         {
+          double waitStart = MPI_Wtime ();
           MPI_Waitany (g_numNeighbors, g_requests, &index, &status);
+          g_syncTime += MPI_Wtime () - waitStart;
           messageReceived = 1; /* Wait always implies message was received */
           stop = true;
         }
@@ -379,6 +393,8 @@ NullMessageMpiInterface::ReceiveMessages (bool blocking)
         {
           int count;
           MPI_Get_count (&status, MPI_CHAR, &count);
+          g_rxMessages++;
+          g_rxBytes += count;
 
           // Get the meta data first
           uint64_t* pTime = reinterpret_cast<uint64_t *> (g_pRxBuffers[index]);
@@ -394,6 +410,7 @@ NullMessageMpiInterface::ReceiveMessages (bool blocking)
           // rxtime == 0 means this is a Null Message
           if (rxTime > Time (0))
             {
+              g_rxCount++;
               count -= sizeof (time) + sizeof (guaranteeUpdate) + sizeof (node) + sizeof (dev);
 
               Ptr<Packet> p = Create<Packet> (reinterpret_cast<uint8_t *> (pData), count, true);
@@ -461,6 +478,17 @@ NullMessageMpiInterface::TestSendComplete ()
     }
 }
 
+void
+NullMessageMpiInterface::PrintStatistics (std::ostream &os)
+{
+  NS_LOG_FUNCTION (this << &os);
+
+  os << "rank " << g_sid
+     << " sent " << g_txCount << " packets in " << g_txMessages << " messages (" << g_txBytes << " bytes),"
+     << " received " << g_rxCount << " packets in " << g_rxMessages << " messages (" << g_rxBytes << " bytes),"
+     << " synchronization " << g_syncTime << " s" << std::endl;
+}
+
 void
 NullMessageMpiInterface::Disable ()
 {
@@ -34,6 +34,7 @@
 
 #include "mpi.h"
 #include <list>
+#include <ostream>
 
 namespace ns3 {
 
@@ -70,6 +71,7 @@ public:
   virtual void Disable ();
   virtual void SendPacket (Ptr<Packet> p, const Time &rxTime, uint32_t node, uint32_t dev);
   virtual MPI_Comm GetCommunicator();
+  virtual void PrintStatistics (std::ostream &os);
 
 private:
 
@@ -144,6 +146,27 @@ private:
   /** Number of neighbor tasks, tasks that this task shares a link with. */
   static uint32_t g_numNeighbors;
 
+  /** Total packets sent. */
+  static uint64_t g_txCount;
+
+  /** Total packets received. */
+  static uint64_t g_rxCount;
+
+  /** Total MPI messages, packets and Null Messages, sent. */
+  static uint64_t g_txMessages;
+
+  /** Total MPI messages, packets and Null Messages, received. */
+  static uint64_t g_rxMessages;
+
+  /** Total bytes sent. */
+  static uint64_t g_txBytes;
+
+  /** Total bytes received. */
+  static uint64_t g_rxBytes;
+
+  /** Wall clock time spent blocked waiting for messages, in seconds. */
+  static double g_syncTime;
+
   /** Has this interface been enabled. */
   static bool     g_enabled;
 
@@ -30,6 +30,7 @@
 
 #include <stdint.h>
 #include <list>
+#include <ostream>
 
 #include <ns3/object.h>
 #include <ns3/nstime.h>
@@ -99,6 +100,10 @@ public:
    * \copydoc MpiInterface::GetCommunicator
    */
   virtual MPI_Comm GetCommunicator () = 0;
+  /**
+   * \copydoc MpiInterface::PrintStatistics
+   */
+  virtual void PrintStatistics (std::ostream &os) = 0;
 private:
 };
 
@@ -187,6 +187,7 @@ Node::DoDispose ()
   NS_LOG_FUNCTION (this);
   m_deviceAdditionListeners.clear ();
   m_handlers.clear ();
+  m_segmentationHandlers.clear ();
   for (std::vector<Ptr<NetDevice> >::iterator i = m_devices.begin ();
        i != m_devices.end (); i++)
     {
@@ -274,6 +275,26 @@ Node::UnregisterProtocolHandler (ProtocolHandler handler)
     }
 }
 
+void
+Node::RegisterSegmentationHandler (SegmentationHandler handler, uint16_t protocolType)
+{
+  NS_LOG_FUNCTION (this << &handler << protocolType);
+  m_segmentationHandlers[protocolType] = handler;
+}
+
+bool
+Node::Segment (Ptr<const Packet> packet, uint16_t protocolType, std::list<Ptr<Packet> > &segments) const
+{
+  NS_LOG_FUNCTION (this << packet << protocolType);
+  std::map<uint16_t, SegmentationHandler>::const_iterator it = m_segmentationHandlers.find (protocolType);
+  if (it == m_segmentationHandlers.end ())
+    {
+      NS_LOG_LOGIC ("No segmentation handler for protocol " << protocolType);
+      return false;
+    }
+  return it->second (packet, segments);
+}
+
 bool
 Node::ChecksumEnabled (void)
 {
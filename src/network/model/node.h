@@ -22,6 +22,8 @@
 #define NODE_H
 
 #include <vector>
+#include <list>
+#include <map>
 
 #include "ns3/object.h"
 #include "ns3/callback.h"
@@ -182,6 +184,38 @@ public:
    */
   void UnregisterProtocolHandler (ProtocolHandler handler);
 
+  /**
+   * A segmentation handler splits a packet handed down larger than the
+   * MTU by a protocol with generic segmentation offload, e.g. a TCP
+   * super-segment, into the packets to transmit on the wire.
+   *
+   * \param packet the packet, starting with the header of the protocol
+   * \param segments the list to which the segments are appended
+   * \returns true if the packet was segmented
+   */
+  typedef Callback<bool, Ptr<const Packet>, std::list<Ptr<Packet> > &> SegmentationHandler;
+  /**
+   * \param handler the handler to register
+   * \param protocolType the EtherType of the packets split by the handler
+   *
+   * A single handler may be registered for each protocol.
+   */
+  void RegisterSegmentationHandler (SegmentationHandler handler, uint16_t protocolType);
+  /**
+   * \brief Split a packet larger than the MTU with the segmentation
+   * handler registered for its protocol.
+   *
+   * This is called by the devices which support generic segmentation
+   * offload, right before the transmission of the packet.
+   *
+   * \param packet the packet, starting with the header of the protocol
+   * \param protocolType the EtherType of the packet
+   * \param segments the list to which the segments are appended
+   * \returns true if the packet was segmented, false if no handler is
+   *          registered for the protocol or if the handler failed
+   */
+  bool Segment (Ptr<const Packet> packet, uint16_t protocolType, std::list<Ptr<Packet> > &segments) const;
+
   /**
    * A callback invoked whenever a device is added to a node.
    */
@@ -287,6 +321,7 @@ private:
   std::vector<Ptr<NetDevice> > m_devices; //!< Devices associated to this node
   std::vector<Ptr<Application> > m_applications; //!< Applications associated to this node
   ProtocolHandlerList m_handlers; //!< Protocol handlers in the node
+  std::map<uint16_t, SegmentationHandler> m_segmentationHandlers; //!< Segmentation handlers, by protocol
   DeviceAdditionListenerList m_deviceAdditionListeners; //!< Device addition listeners in the node
 };
 
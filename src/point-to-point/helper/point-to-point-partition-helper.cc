@@ -0,0 +1,383 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+#include <algorithm>
+#include <map>
+
+#include "ns3/assert.h"
+#include "ns3/log.h"
+#include "ns3/node.h"
+#include "point-to-point-helper.h"
+#include "point-to-point-partition-helper.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("PointToPointPartitionHelper");
+
+PointToPointPartitionHelper::PointToPointPartitionHelper ()
+  : m_tolerance (0.05)
+{
+}
+
+void
+PointToPointPartitionHelper::SetImbalanceTolerance (double tolerance)
+{
+  NS_ASSERT (tolerance >= 0);
+  m_tolerance = tolerance;
+}
+
+uint32_t
+PointToPointPartitionHelper::AddNode (double weight)
+{
+  NS_LOG_FUNCTION (this << weight);
+  NS_ASSERT (weight >= 0);
+  m_weights.push_back (weight);
+  m_adjacency.push_back (std::vector<uint32_t> ());
+  return m_weights.size () - 1;
+}
+
+void
+PointToPointPartitionHelper::AddLink (uint32_t a, uint32_t b, Time delay, double traffic)
+{
+  NS_LOG_FUNCTION (this << a << b << delay << traffic);
+  NS_ASSERT_MSG (a < m_weights.size () && b < m_weights.size (), "Unknown node");
+  NS_ASSERT_MSG (a != b, "A link must connect two different nodes");
+  Link link;
+  link.a = a;
+  link.b = b;
+  link.delay = delay;
+  link.traffic = traffic;
+  m_adjacency[a].push_back (m_links.size ());
+  m_adjacency[b].push_back (m_links.size ());
+  m_links.push_back (link);
+}
+
+uint32_t
+PointToPointPartitionHelper::FindGroup (std::vector<uint32_t> &group, uint32_t node)
+{
+  while (group[node] != node)
+    {
+      group[node] = group[group[node]];
+      node = group[node];
+    }
+  return node;
+}
+
+void
+PointToPointPartitionHelper::Partition (uint32_t nRanks)
+{
+  NS_LOG_FUNCTION (this << nRanks);
+  NS_ASSERT (nRanks > 0);
+
+  uint32_t nNodes = m_weights.size ();
+  m_systemIds.assign (nNodes, 0);
+  m_loads.assign (nRanks, 0);
+
+  double total = 0;
+  for (uint32_t i = 0; i < nNodes; ++i)
+    {
+      total += m_weights[i];
+    }
+  double capacity = total / nRanks * (1 + m_tolerance);
+
+  // Contract the links by increasing delay, so that the shortest
+  // links, which would limit the lookahead, stay within a rank.
+  std::vector<uint32_t> order (m_links.size ());
+  for (uint32_t i = 0; i < order.size (); ++i)
+    {
+      order[i] = i;
+    }
+  std::stable_sort (order.begin (), order.end (),
+                    [this] (uint32_t x, uint32_t y)
+                    {
+                      if (m_links[x].delay != m_links[y].delay)
+                        {
+                          return m_links[x].delay < m_links[y].delay;
+                        }
+                      return m_links[x].traffic > m_links[y].traffic;
+                    });
+  std::vector<uint32_t> group (nNodes);
+  std::vector<double> groupWeight (m_weights);
+  for (uint32_t i = 0; i < nNodes; ++i)
+    {
+      group[i] = i;
+    }
+  for (uint32_t i = 0; i < order.size (); ++i)
+    {
+      const Link &link = m_links[order[i]];
+      uint32_t ga = FindGroup (group, link.a);
+      uint32_t gb = FindGroup (group, link.b);
+      if (ga != gb && groupWeight[ga] + groupWeight[gb] <= capacity)
+        {
+          group[gb] = ga;
+          groupWeight[ga] += groupWeight[gb];
+        }
+    }
+
+  // Pack the groups onto the ranks, largest first, each one on the
+  // least loaded rank.
+  std::vector<std::pair<double, uint32_t> > groups;
+  for (uint32_t i = 0; i < nNodes; ++i)
+    {
+      if (FindGroup (group, i) == i)
+        {
+          groups.push_back (std::make_pair (-groupWeight[i], i));
+        }
+    }
+  std::sort (groups.begin (), groups.end ());
+  std::vector<uint32_t> groupRank (nNodes, 0);
+  for (uint32_t i = 0; i < groups.size (); ++i)
+    {
+      uint32_t rank = std::min_element (m_loads.begin (), m_loads.end ()) - m_loads.begin ();
+      groupRank[groups[i].second] = rank;
+      m_loads[rank] -= groups[i].first;
+    }
+  for (uint32_t i = 0; i < nNodes; ++i)
+    {
+      m_systemIds[i] = groupRank[FindGroup (group, i)];
+    }
+
+  Refine (capacity);
+
+  NS_LOG_INFO ("lookahead " << GetLookahead () << " imbalance " << GetImbalance ()
+                            << " cut traffic " << GetCutTraffic ());
+}
+
+void
+PointToPointPartitionHelper::Refine (double capacity)
+{
+  NS_LOG_FUNCTION (this << capacity);
+
+  // A node can only leave its rank if the links it keeps to that rank
+  // are not shorter than the lookahead, which thus never decreases.
+  Time lookahead = GetLookahead ();
+  uint32_t nNodes = m_weights.size ();
+  std::vector<bool> movable (nNodes);
+  std::vector<std::map<uint32_t, double> > traffic (nNodes);
+  for (uint32_t v = 0; v < nNodes; ++v)
+    {
+      movable[v] = true;
+      for (uint32_t i = 0; i < m_adjacency[v].size (); ++i)
+        {
+          const Link &link = m_links[m_adjacency[v][i]];
+          uint32_t peer = link.a == v ? link.b : link.a;
+          traffic[v][m_systemIds[peer]] += link.traffic;
+          if (m_systemIds[peer] == m_systemIds[v] && link.delay < lookahead)
+            {
+              movable[v] = false;
+            }
+        }
+    }
+  auto move = [&] (uint32_t v, uint32_t to)
+  {
+    uint32_t from = m_systemIds[v];
+    NS_LOG_LOGIC ("move node " << v << " from rank " << from << " to rank " << to);
+    m_loads[from] -= m_weights[v];
+    m_loads[to] += m_weights[v];
+    m_systemIds[v] = to;
+    for (uint32_t i = 0; i < m_adjacency[v].size (); ++i)
+      {
+        const Link &link = m_links[m_adjacency[v][i]];
+        uint32_t peer = link.a == v ? link.b : link.a;
+        traffic[peer][from] -= link.traffic;
+        traffic[peer][to] += link.traffic;
+      }
+    // The short links that became internal now pin both of their ends
+    for (uint32_t i = 0; i < m_adjacency[v].size (); ++i)
+      {
+        const Link &link = m_links[m_adjacency[v][i]];
+        uint32_t peer = link.a == v ? link.b : link.a;
+        if (m_systemIds[peer] == to && link.delay < lookahead)
+          {
+            movable[v] = false;
+            movable[peer] = false;
+          }
+      }
+  };
+
+  // First bring the overloaded ranks back under the capacity
+  for (uint32_t iteration = 0; iteration < nNodes; ++iteration)
+    {
+      uint32_t heaviest = std::max_element (m_loads.begin (), m_loads.end ()) - m_loads.begin ();
+      uint32_t lightest = std::min_element (m_loads.begin (), m_loads.end ()) - m_loads.begin ();
+      if (m_loads[heaviest] <= capacity)
+        {
+          break;
+        }
+      uint32_t best = nNodes;
+      double bestGain = 0;
+      for (uint32_t v = 0; v < nNodes; ++v)
+        {
+          if (m_systemIds[v] != heaviest || !movable[v]
+              || m_loads[lightest] + m_weights[v] >= m_loads[heaviest])
+            {
+              continue;
+            }
+          double gain = traffic[v][lightest] - traffic[v][heaviest];
+          if (best == nNodes || gain > bestGain)
+            {
+              best = v;
+              bestGain = gain;
+            }
+        }
+      if (best == nNodes)
+        {
+          break;
+        }
+      move (best, lightest);
+    }
+
+  // Then reduce the traffic crossing ranks
+  for (uint32_t pass = 0; pass < 10; ++pass)
+    {
+      bool improved = false;
+      for (uint32_t v = 0; v < nNodes; ++v)
+        {
+          if (!movable[v])
+            {
+              continue;
+            }
+          uint32_t from = m_systemIds[v];
+          uint32_t to = from;
+          double internal = traffic[v][from];
+          double bestGain = 0;
+          for (std::map<uint32_t, double>::const_iterator i = traffic[v].begin ();
+               i != traffic[v].end (); ++i)
+            {
+              double gain = i->second - internal;
+              if (i->first != from && gain > bestGain
+                  && m_loads[i->first] + m_weights[v] <= capacity)
+                {
+                  to = i->first;
+                  bestGain = gain;
+                }
+            }
+          if (to != from)
+            {
+              move (v, to);
+              improved = true;
+            }
+        }
+      if (!improved)
+        {
+          break;
+        }
+    }
+}
+
+uint32_t
+PointToPointPartitionHelper::GetSystemId (uint32_t node) const
+{
+  NS_ASSERT_MSG (node < m_systemIds.size (), "Unknown node, or Partition not called");
+  return m_systemIds[node];
+}
+
+Time
+PointToPointPartitionHelper::GetLookahead (void) const
+{
+  Time lookahead = Time::Max ();
+  for (uint32_t i = 0; i < m_links.size (); ++i)
+    {
+      const Link &link = m_links[i];
+      if (m_systemIds[link.a] != m_systemIds[link.b])
+        {
+          lookahead = std::min (lookahead, link.delay);
+        }
+    }
+  return lookahead;
+}
+
+double
+PointToPointPartitionHelper::GetImbalance (void) const
+{
+  double total = 0;
+  double heaviest = 0;
+  for (uint32_t i = 0; i < m_loads.size (); ++i)
+    {
+      total += m_loads[i];
+      heaviest = std::max (heaviest, m_loads[i]);
+    }
+  if (total == 0)
+    {
+      return 0;
+    }
+  return heaviest / (total / m_loads.size ()) - 1;
+}
+
+double
+PointToPointPartitionHelper::GetCutTraffic (void) const
+{
+  double cut = 0;
+  for (uint32_t i = 0; i < m_links.size (); ++i)
+    {
+      const Link &link = m_links[i];
+      if (m_systemIds[link.a] != m_systemIds[link.b])
+        {
+          cut += link.traffic;
+        }
+    }
+  return cut;
+}
+
+void
+PointToPointPartitionHelper::Print (std::ostream &os) const
+{
+  for (uint32_t rank = 0; rank < m_loads.size (); ++rank)
+    {
+      os << "rank " << rank << " load " << m_loads[rank] << std::endl;
+    }
+  Time lookahead = GetLookahead ();
+  os << "lookahead ";
+  if (lookahead == Time::Max ())
+    {
+      os << "unlimited";
+    }
+  else
+    {
+      os << lookahead.As (Time::US);
+    }
+  os << " imbalance " << GetImbalance ()
+     << " cut traffic " << GetCutTraffic () << std::endl;
+}
+
+NodeContainer
+PointToPointPartitionHelper::CreateNodes (void)
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT_MSG (m_systemIds.size () == m_weights.size (), "Partition not called");
+  for (uint32_t i = m_nodes.GetN (); i < m_systemIds.size (); ++i)
+    {
+      m_nodes.Add (CreateObject<Node> (m_systemIds[i]));
+    }
+  return m_nodes;
+}
+
+NetDeviceContainer
+PointToPointPartitionHelper::InstallLinks (PointToPointHelper &helper)
+{
+  NS_LOG_FUNCTION (this);
+  NS_ASSERT_MSG (m_nodes.GetN () == m_weights.size (), "CreateNodes not called");
+  NetDeviceContainer devices;
+  for (uint32_t i = 0; i < m_links.size (); ++i)
+    {
+      const Link &link = m_links[i];
+      helper.SetChannelAttribute ("Delay", TimeValue (link.delay));
+      devices.Add (helper.Install (m_nodes.Get (link.a), m_nodes.Get (link.b)));
+    }
+  return devices;
+}
+
+} // namespace ns3
@@ -0,0 +1,192 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef POINT_TO_POINT_PARTITION_HELPER_H
+#define POINT_TO_POINT_PARTITION_HELPER_H
+
+#include <ostream>
+#include <vector>
+
+#include "ns3/nstime.h"
+#include "ns3/net-device-container.h"
+#include "ns3/node-container.h"
+
+namespace ns3 {
+
+class PointToPointHelper;
+
+/**
+ * \brief Split a point-to-point topology over the ranks of a
+ * distributed simulation.
+ *
+ * The system id of a Node is fixed when the Node is created, so the
+ * topology is first described to this helper as a graph: one vertex
+ * per node, weighted by the expected load of the node, and one edge
+ * per point-to-point link, with the link delay and the expected
+ * traffic on the link.  Partition then assigns a rank to each vertex
+ * so that:
+ *
+ *  - the lookahead, which is the smallest delay of the links that
+ *    cross ranks, is as large as possible;
+ *  - the load of each rank stays within the imbalance tolerance of
+ *    the mean load;
+ *  - the traffic crossing ranks is as small as possible.
+ *
+ * Links are contracted by increasing delay for as long as the
+ * resulting groups fit in a rank, the groups are packed onto the
+ * ranks largest first, and the assignment is then refined by moving
+ * single nodes to the rank of their neighbors when this reduces the
+ * traffic crossing ranks without reducing the lookahead.
+ *
+ * CreateNodes and InstallLinks finally build the Nodes with the
+ * computed system ids and the links with the given delays; with MPI
+ * enabled, PointToPointHelper creates the remote channels of the
+ * links that cross ranks.
+ *
+ * \code
+ *   PointToPointPartitionHelper partition;
+ *   uint32_t a = partition.AddNode ();
+ *   uint32_t b = partition.AddNode ();
+ *   partition.AddLink (a, b, MilliSeconds (5));
+ *   partition.Partition (MpiInterface::GetSize ());
+ *   NodeContainer nodes = partition.CreateNodes ();
+ *   NetDeviceContainer devices = partition.InstallLinks (p2pHelper);
+ * \endcode
+ */
+class PointToPointPartitionHelper
+{
+public:
+  PointToPointPartitionHelper ();
+
+  /**
+   * Set the tolerated load imbalance.
+   *
+   * \param tolerance The maximum load of a rank, relative to the mean
+   * load, minus one.  Defaults to 0.05.
+   */
+  void SetImbalanceTolerance (double tolerance);
+
+  /**
+   * Add a node to the topology.
+   *
+   * \param weight The expected load of the node, for instance its
+   * expected number of events.
+   * \return The index of the node.
+   */
+  uint32_t AddNode (double weight = 1.0);
+
+  /**
+   * Add a point-to-point link to the topology.
+   *
+   * \param a The index of the first node.
+   * \param b The index of the second node.
+   * \param delay The delay of the link.
+   * \param traffic The expected traffic on the link, in any unit.
+   */
+  void AddLink (uint32_t a, uint32_t b, Time delay, double traffic = 1.0);
+
+  /**
+   * Assign a rank to each node.
+   *
+   * \param nRanks The number of ranks.
+   */
+  void Partition (uint32_t nRanks);
+
+  /**
+   * \param node The index of a node.
+   * \return The system id assigned to the node.
+   */
+  uint32_t GetSystemId (uint32_t node) const;
+
+  /**
+   * \return The smallest delay of the links that cross ranks, or
+   * Time::Max () when no link crosses ranks.
+   */
+  Time GetLookahead (void) const;
+
+  /**
+   * \return The maximum load of a rank relative to the mean load,
+   * minus one; zero for a perfectly balanced partition.
+   */
+  double GetImbalance (void) const;
+
+  /**
+   * \return The total traffic of the links that cross ranks.
+   */
+  double GetCutTraffic (void) const;
+
+  /**
+   * Print the load of each rank, the lookahead, the predicted
+   * imbalance and the traffic crossing ranks.
+   *
+   * \param os The output stream.
+   */
+  void Print (std::ostream &os) const;
+
+  /**
+   * Create one Node per node of the topology, with the system id
+   * assigned by Partition.
+   *
+   * \return The nodes, in the order they were added.
+   */
+  NodeContainer CreateNodes (void);
+
+  /**
+   * Install the links of the topology between the nodes built by
+   * CreateNodes, setting the channel delay of each link.
+   *
+   * \param helper The helper used to install each link.
+   * \return The devices, two per link, in the order the links were
+   * added.
+   */
+  NetDeviceContainer InstallLinks (PointToPointHelper &helper);
+
+private:
+  /// A point-to-point link of the topology.
+  struct Link
+  {
+    uint32_t a;      //!< First node.
+    uint32_t b;      //!< Second node.
+    Time delay;      //!< Link delay.
+    double traffic;  //!< Expected traffic.
+  };
+
+  /**
+   * \param group The group of each node.
+   * \param node A node.
+   * \return The root of the group of the node.
+   */
+  static uint32_t FindGroup (std::vector<uint32_t> &group, uint32_t node);
+
+  /**
+   * Move single nodes out of the overloaded ranks, then to the rank
+   * of their neighbors while it reduces the traffic crossing ranks.
+   *
+   * \param capacity The maximum load of a rank.
+   */
+  void Refine (double capacity);
+
+  double m_tolerance;                        //!< Tolerated imbalance.
+  std::vector<double> m_weights;             //!< Load of each node.
+  std::vector<Link> m_links;                 //!< Links.
+  std::vector<std::vector<uint32_t> > m_adjacency;  //!< Links of each node.
+  std::vector<uint32_t> m_systemIds;         //!< Rank of each node.
+  std::vector<double> m_loads;               //!< Load of each rank.
+  NodeContainer m_nodes;                     //!< Nodes built by CreateNodes.
+};
+
+} // namespace ns3
+
+#endif /* POINT_TO_POINT_PARTITION_HELPER_H */
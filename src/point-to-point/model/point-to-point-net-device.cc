@@ -24,6 +24,7 @@
 #include "ns3/error-model.h"
 #include "ns3/trace-source-accessor.h"
 #include "ns3/uinteger.h"
+#include "ns3/boolean.h"
 #include "ns3/pointer.h"
 #include "point-to-point-net-device.h"
 #include "point-to-point-channel.h"
@@ -57,6 +58,13 @@ PointToPointNetDevice::GetTypeId (void)
                    DataRateValue (DataRate ("32768b/s")),
                    MakeDataRateAccessor (&PointToPointNetDevice::m_bps),
                    MakeDataRateChecker ())
+    .AddAttribute ("Gso",
+                   "If true, the packets larger than the MTU handed down by a protocol "
+                   "with generic segmentation offload (e.g. TCP super-segments) are split "
+                   "into wire packets right before their transmission",
+                   BooleanValue (true),
+                   MakeBooleanAccessor (&PointToPointNetDevice::m_gso),
+                   MakeBooleanChecker ())
     .AddAttribute ("ReceiveErrorModel", 
                    "The receiver error model used to simulate packet loss",
                    PointerValue (),
@@ -177,7 +185,8 @@ PointToPointNetDevice::PointToPointNetDevice ()
     m_txMachineState (READY),
     m_channel (0),
     m_linkUp (false),
-    m_currentPkt (0)
+    m_currentPkt (0),
+    m_gso (true)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -214,6 +223,7 @@ PointToPointNetDevice::DoDispose ()
   m_channel = 0;
   m_receiveErrorModel = 0;
   m_currentPkt = 0;
+  m_segments.clear ();
   m_queue = 0;
   NetDevice::DoDispose ();
 }
@@ -281,7 +291,7 @@ PointToPointNetDevice::TransmitComplete (void)
   m_phyTxEndTrace (m_currentPkt);
   m_currentPkt = 0;
 
-  Ptr<Packet> p = m_queue->Dequeue ();
+  Ptr<Packet> p = DequeueWirePacket ();
   if (p == 0)
     {
       NS_LOG_LOGIC ("No pending packets in device queue after tx complete");
@@ -296,6 +306,42 @@ PointToPointNetDevice::TransmitComplete (void)
   TransmitStart (p);
 }
 
+Ptr<Packet>
+PointToPointNetDevice::DequeueWirePacket (void)
+{
+  NS_LOG_FUNCTION (this);
+  Ptr<Packet> p;
+  if (!m_segments.empty ())
+    {
+      p = m_segments.front ();
+      m_segments.pop_front ();
+      return p;
+    }
+  p = m_queue->Dequeue ();
+  PppHeader ppp;
+  if (p == 0 || !m_gso || p->GetSize () <= m_mtu + ppp.GetSerializedSize ())
+    {
+      return p;
+    }
+  // a super-segment, which occupied a single slot of the queue
+  Ptr<Packet> datagram = p->Copy ();
+  uint16_t protocol;
+  ProcessHeader (datagram, protocol);
+  if (m_node == 0 || !m_node->Segment (datagram, protocol, m_segments))
+    {
+      NS_LOG_LOGIC ("Packet larger than the MTU not segmented");
+      return p;
+    }
+  NS_LOG_LOGIC ("Super-segment split into " << m_segments.size () << " packets");
+  for (std::list<Ptr<Packet> >::iterator it = m_segments.begin (); it != m_segments.end (); it++)
+    {
+      AddHeader (*it, protocol);
+    }
+  p = m_segments.front ();
+  m_segments.pop_front ();
+  return p;
+}
+
 bool
 PointToPointNetDevice::Attach (Ptr<PointToPointChannel> ch)
 {
@@ -541,7 +587,7 @@ PointToPointNetDevice::Send (
       // 
       if (m_txMachineState == READY)
         {
-          packet = m_queue->Dequeue ();
+          packet = DequeueWirePacket ();
           m_snifferTrace (packet);
           m_promiscSnifferTrace (packet);
           bool ret = TransmitStart (packet);
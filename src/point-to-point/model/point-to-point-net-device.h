@@ -20,6 +20,7 @@
 #define POINT_TO_POINT_NET_DEVICE_H
 
 #include <cstring>
+#include <list>
 #include "ns3/address.h"
 #include "ns3/node.h"
 #include "ns3/net-device.h"
@@ -275,6 +276,15 @@ private:
    */
   void TransmitComplete (void);
 
+  /**
+   * Get the next packet to put on the wire: the next segment of the
+   * super-segment being transmitted, if any, or the next packet of the
+   * queue, which is split by the node if it is larger than the MTU.
+   *
+   * \returns the packet, or 0 if there is nothing to transmit
+   */
+  Ptr<Packet> DequeueWirePacket (void);
+
   /**
    * \brief Make the link up and running
    *
@@ -457,6 +467,13 @@ private:
 
   Ptr<Packet> m_currentPkt; //!< Current packet processed
 
+  /**
+   * Whether the packets larger than the MTU are split right before their
+   * transmission (generic segmentation offload)
+   */
+  bool m_gso;
+  std::list<Ptr<Packet> > m_segments; //!< Segments left to transmit of the current super-segment
+
   /**
    * \brief PPP to Ethernet protocol number mapping
    * \param protocol A PPP protocol number
@@ -24,8 +24,14 @@
 #include "ns3/point-to-point-net-device.h"
 #include "ns3/point-to-point-channel.h"
 #include "ns3/net-device-queue-interface.h"
+#include "ns3/point-to-point-helper.h"
+#include "ns3/point-to-point-partition-helper.h"
+#include "ns3/node.h"
+#include "ns3/boolean.h"
+#include "ns3/data-rate.h"
 
 #include <string>
+#include <vector>
 
 using namespace ns3;
 
@@ -130,6 +136,209 @@ PointToPointTest::DoRun (void)
   Simulator::Destroy ();
 }
 
+/**
+ * \brief Test the partition of a topology over several ranks
+ *
+ * Two clusters of nodes linked by short links are bridged by two
+ * long links; the nodes of the clusters are interleaved so that the
+ * clusters have to be found from the links.
+ */
+class PointToPointPartitionTest : public TestCase
+{
+public:
+  /**
+   * \brief Create the test
+   */
+  PointToPointPartitionTest ();
+
+  /**
+   * \brief Run the test
+   */
+  virtual void DoRun (void);
+};
+
+PointToPointPartitionTest::PointToPointPartitionTest ()
+  : TestCase ("PointToPoint partition")
+{
+}
+
+void
+PointToPointPartitionTest::DoRun (void)
+{
+  PointToPointPartitionHelper partition;
+  for (uint32_t i = 0; i < 8; ++i)
+    {
+      partition.AddNode ();
+    }
+  // Cluster of the even nodes and cluster of the odd nodes
+  for (uint32_t i = 0; i < 6; ++i)
+    {
+      partition.AddLink (i, i + 2, MilliSeconds (1), 10);
+    }
+  partition.AddLink (0, 1, MilliSeconds (10));
+  partition.AddLink (6, 7, MilliSeconds (20));
+
+  partition.Partition (1);
+  NS_TEST_EXPECT_MSG_EQ (partition.GetLookahead (), Time::Max (), "No link should cross ranks");
+  NS_TEST_EXPECT_MSG_EQ (partition.GetCutTraffic (), 0, "No link should cross ranks");
+
+  partition.Partition (2);
+  NS_TEST_EXPECT_MSG_EQ (partition.GetLookahead (), MilliSeconds (10), "Only the long links should cross ranks");
+  NS_TEST_EXPECT_MSG_EQ (partition.GetCutTraffic (), 2, "Only the long links should cross ranks");
+  NS_TEST_EXPECT_MSG_EQ (partition.GetImbalance (), 0, "The ranks should have the same load");
+  for (uint32_t i = 0; i < 8; ++i)
+    {
+      NS_TEST_EXPECT_MSG_EQ (partition.GetSystemId (i), partition.GetSystemId (i % 2), "Node " << i << " should be in the rank of its cluster");
+    }
+  NS_TEST_EXPECT_MSG_NE (partition.GetSystemId (0), partition.GetSystemId (1), "The clusters should be in different ranks");
+
+  NodeContainer nodes = partition.CreateNodes ();
+  NS_TEST_ASSERT_MSG_EQ (nodes.GetN (), 8, "One node per node of the topology");
+  for (uint32_t i = 0; i < 8; ++i)
+    {
+      NS_TEST_EXPECT_MSG_EQ (nodes.Get (i)->GetSystemId (), partition.GetSystemId (i), "Wrong system id");
+    }
+  PointToPointHelper p2p;
+  NetDeviceContainer devices = partition.InstallLinks (p2p);
+  NS_TEST_ASSERT_MSG_EQ (devices.GetN (), 16, "Two devices per link");
+  TimeValue delay;
+  devices.Get (15)->GetChannel ()->GetAttribute ("Delay", delay);
+  NS_TEST_EXPECT_MSG_EQ (delay.Get (), MilliSeconds (20), "Wrong link delay");
+
+  Simulator::Destroy ();
+}
+
+/**
+ * \brief Test the segmentation of the packets larger than the MTU
+ *
+ * A packet larger than the MTU occupies a single slot of the device
+ * queue and is split, by the segmentation handler of the node, into
+ * wire packets sent back to back; with the Gso attribute unset, it is
+ * sent as is.
+ */
+class PointToPointGsoTest : public TestCase
+{
+public:
+  /**
+   * \brief Create the test
+   */
+  PointToPointGsoTest ();
+
+  /**
+   * \brief Run the test
+   */
+  virtual void DoRun (void);
+
+private:
+  /**
+   * \brief Split a packet into segments of 1000 bytes
+   *
+   * \param packet The packet.
+   * \param segments The segments.
+   * \return true
+   */
+  static bool Segment (Ptr<const Packet> packet, std::list<Ptr<Packet> > &segments);
+  /**
+   * \brief Callback function which records the received packets
+   *
+   * \param dev The receiving device.
+   * \param pkt The received packet.
+   * \param mode The protocol mode used.
+   * \param sender The sender address.
+   *
+   * \return A boolean indicating packet handled properly.
+   */
+  bool RxPacket (Ptr<NetDevice> dev, Ptr<const Packet> pkt, uint16_t mode, const Address &sender);
+
+  std::vector<Ptr<const Packet> > m_recvdPackets; //!< received packets
+  std::vector<Time> m_recvdTimes;                 //!< reception times
+};
+
+PointToPointGsoTest::PointToPointGsoTest ()
+  : TestCase ("PointToPoint segmentation offload")
+{
+}
+
+bool
+PointToPointGsoTest::Segment (Ptr<const Packet> packet, std::list<Ptr<Packet> > &segments)
+{
+  for (uint32_t offset = 0; offset < packet->GetSize (); offset += 1000)
+    {
+      segments.push_back (packet->CreateFragment (offset, std::min<uint32_t> (1000, packet->GetSize () - offset)));
+    }
+  return true;
+}
+
+bool
+PointToPointGsoTest::RxPacket (Ptr<NetDevice> dev, Ptr<const Packet> pkt, uint16_t mode, const Address &sender)
+{
+  m_recvdPackets.push_back (pkt);
+  m_recvdTimes.push_back (Simulator::Now ());
+  return true;
+}
+
+void
+PointToPointGsoTest::DoRun (void)
+{
+  std::vector<uint8_t> txBuffer (3500);
+  for (uint32_t i = 0; i < txBuffer.size (); i++)
+    {
+      txBuffer[i] = static_cast<uint8_t> (i);
+    }
+
+  for (bool gso : {true, false})
+    {
+      m_recvdPackets.clear ();
+      m_recvdTimes.clear ();
+      Ptr<Node> a = CreateObject<Node> ();
+      Ptr<Node> b = CreateObject<Node> ();
+      a->RegisterSegmentationHandler (MakeCallback (&PointToPointGsoTest::Segment), 0x800);
+      Ptr<PointToPointNetDevice> devA = CreateObject<PointToPointNetDevice> ();
+      Ptr<PointToPointNetDevice> devB = CreateObject<PointToPointNetDevice> ();
+      Ptr<PointToPointChannel> channel = CreateObject<PointToPointChannel> ();
+      devA->SetAttribute ("DataRate", DataRateValue (DataRate ("8Mbps")));
+      devA->SetAttribute ("Gso", BooleanValue (gso));
+      devA->Attach (channel);
+      devA->SetAddress (Mac48Address::Allocate ());
+      Ptr<DropTailQueue<Packet> > queue = CreateObject<DropTailQueue<Packet> > ();
+      devA->SetQueue (queue);
+      devB->Attach (channel);
+      devB->SetAddress (Mac48Address::Allocate ());
+      devB->SetQueue (CreateObject<DropTailQueue<Packet> > ());
+      a->AddDevice (devA);
+      b->AddDevice (devB);
+      devB->SetReceiveCallback (MakeCallback (&PointToPointGsoTest::RxPacket, this));
+
+      Simulator::Schedule (Seconds (1.0), &PointToPointNetDevice::Send, devA,
+                           Create<Packet> (txBuffer.data (), txBuffer.size ()), devA->GetBroadcast (), 0x800);
+      Simulator::Run ();
+
+      NS_TEST_EXPECT_MSG_EQ (queue->GetTotalReceivedPackets (), 1, "The packet should occupy a single slot of the queue");
+      if (!gso)
+        {
+          NS_TEST_ASSERT_MSG_EQ (m_recvdPackets.size (), 1, "The packet should not be split");
+          NS_TEST_EXPECT_MSG_EQ (m_recvdPackets[0]->GetSize (), txBuffer.size (), "Wrong packet size");
+          Simulator::Destroy ();
+          continue;
+        }
+      NS_TEST_ASSERT_MSG_EQ (m_recvdPackets.size (), 4, "The packet should be split in four segments");
+      std::vector<uint8_t> rxBuffer;
+      Time end = Seconds (1.0);
+      for (uint32_t i = 0; i < m_recvdPackets.size (); i++)
+        {
+          uint32_t size = m_recvdPackets[i]->GetSize ();
+          NS_TEST_EXPECT_MSG_EQ (size, (i < 3 ? 1000 : 500), "Wrong size of segment " << i);
+          rxBuffer.resize (rxBuffer.size () + size);
+          m_recvdPackets[i]->CopyData (&rxBuffer[rxBuffer.size () - size], size);
+          // each wire packet, with its PPP header, is sent right after the previous one
+          end += MicroSeconds (size + 2);
+          NS_TEST_EXPECT_MSG_EQ (m_recvdTimes[i], end, "Wrong reception time of segment " << i);
+        }
+      NS_TEST_EXPECT_MSG_EQ ((rxBuffer == txBuffer), true, "The segments should carry the packet");
+      Simulator::Destroy ();
+    }
+}
+
 /**
  * \brief TestSuite for PointToPoint module
  */
@@ -146,6 +355,8 @@ PointToPointTestSuite::PointToPointTestSuite ()
   : TestSuite ("devices-point-to-point", UNIT)
 {
   AddTestCase (new PointToPointTest, TestCase::QUICK);
+  AddTestCase (new PointToPointPartitionTest, TestCase::QUICK);
+  AddTestCase (new PointToPointGsoTest, TestCase::QUICK);
 }
 
 static PointToPointTestSuite g_pointToPointTestSuite; //!< The testsuite
@@ -28,6 +28,7 @@
 #include "ns3/double.h"
 #include "ns3/string.h"
 #include "ns3/pointer.h"
+#include "ns3/simulator.h"
 #include <cmath>
 
 namespace ns3 {
@@ -932,4 +933,118 @@ RangePropagationLossModel::DoAssignStreams (int64_t stream)
 
 // ------------------------------------------------------------------------- //
 
+NS_OBJECT_ENSURE_REGISTERED (CachedPropagationLossModel);
+
+TypeId
+CachedPropagationLossModel::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::CachedPropagationLossModel")
+    .SetParent<PropagationLossModel> ()
+    .SetGroupName ("Propagation")
+    .AddConstructor<CachedPropagationLossModel> ()
+    .AddAttribute ("PropagationLossModel",
+                   "The propagation loss model whose losses are stored.",
+                   PointerValue (),
+                   MakePointerAccessor (&CachedPropagationLossModel::m_model),
+                   MakePointerChecker<PropagationLossModel> ())
+    .AddAttribute ("MaxAge",
+                   "The maximum age of a stored loss, or 0 if unlimited.",
+                   TimeValue (Seconds (0)),
+                   MakeTimeAccessor (&CachedPropagationLossModel::m_maxAge),
+                   MakeTimeChecker ())
+  ;
+  return tid;
+}
+
+CachedPropagationLossModel::CachedPropagationLossModel ()
+  : PropagationLossModel ()
+{
+}
+
+CachedPropagationLossModel::~CachedPropagationLossModel ()
+{
+}
+
+void
+CachedPropagationLossModel::DoDispose (void)
+{
+  // the callbacks were made with a const pointer, see GetEpoch
+  const CachedPropagationLossModel *self = this;
+  for (auto &mobility : m_mobilities)
+    {
+      mobility.second.m_mobility->TraceDisconnectWithoutContext ("CourseChange",
+                                                                 MakeCallback (&CachedPropagationLossModel::NotifyCourseChange, self));
+    }
+  m_mobilities.clear ();
+  m_losses.clear ();
+  m_model = 0;
+  PropagationLossModel::DoDispose ();
+}
+
+const CachedPropagationLossModel::MobilityState *
+CachedPropagationLossModel::GetState (Ptr<MobilityModel> mobility) const
+{
+  auto it = m_mobilities.find (PeekPointer (mobility));
+  if (it == m_mobilities.end ())
+    {
+      MobilityState state;
+      state.m_mobility = mobility;
+      state.m_epoch = 0;
+      state.m_static = (mobility->GetVelocity () == Vector (0, 0, 0));
+      it = m_mobilities.insert (std::make_pair (PeekPointer (mobility), state)).first;
+      mobility->TraceConnectWithoutContext ("CourseChange",
+                                            MakeCallback (&CachedPropagationLossModel::NotifyCourseChange, this));
+    }
+  return &it->second;
+}
+
+void
+CachedPropagationLossModel::NotifyCourseChange (Ptr<const MobilityModel> mobility) const
+{
+  auto it = m_mobilities.find (PeekPointer (mobility));
+  NS_ASSERT (it != m_mobilities.end ());
+  it->second.m_epoch++;
+  it->second.m_static = (mobility->GetVelocity () == Vector (0, 0, 0));
+  NS_LOG_DEBUG ("course change, epoch " << it->second.m_epoch << " static " << it->second.m_static);
+}
+
+double
+CachedPropagationLossModel::DoCalcRxPower (double txPowerDbm,
+                                           Ptr<MobilityModel> a,
+                                           Ptr<MobilityModel> b) const
+{
+  NS_ASSERT_MSG (m_model, "Set the PropagationLossModel attribute first");
+  // the states are stored in the entry, whose lookup is the only one on a hit
+  CachedLoss &loss = m_losses[std::make_pair (PeekPointer (a), PeekPointer (b))];
+  if (loss.m_tx == 0)
+    {
+      loss.m_tx = GetState (a);
+      loss.m_rx = GetState (b);
+      loss.m_txEpoch = loss.m_tx->m_epoch + 1;
+    }
+  if (!loss.m_tx->m_static || !loss.m_rx->m_static)
+    {
+      return m_model->CalcRxPower (txPowerDbm, a, b);
+    }
+
+  if (loss.m_txEpoch != loss.m_tx->m_epoch || loss.m_rxEpoch != loss.m_rx->m_epoch
+      || (!m_maxAge.IsZero () && Simulator::Now () - loss.m_time > m_maxAge))
+    {
+      loss.m_txEpoch = loss.m_tx->m_epoch;
+      loss.m_rxEpoch = loss.m_rx->m_epoch;
+      loss.m_time = Simulator::Now ();
+      loss.m_lossDb = txPowerDbm - m_model->CalcRxPower (txPowerDbm, a, b);
+      NS_LOG_DEBUG ("computed loss " << loss.m_lossDb << " dB");
+    }
+  return txPowerDbm - loss.m_lossDb;
+}
+
+int64_t
+CachedPropagationLossModel::DoAssignStreams (int64_t stream)
+{
+  return m_model ? m_model->AssignStreams (stream) : 0;
+}
+
+// ------------------------------------------------------------------------- //
+
 } // namespace ns3
@@ -26,8 +26,10 @@
 #define PROPAGATION_LOSS_MODEL_H
 
 #include "ns3/object.h"
+#include "ns3/nstime.h"
 #include "ns3/random-variable-stream.h"
 #include <map>
+#include <unordered_map>
 
 namespace ns3 {
 
@@ -856,6 +858,117 @@ private:
   double m_range; //!< Maximum Transmission Range (meters)
 };
 
+/**
+ * \ingroup propagation
+ *
+ * \brief Memoizes the loss of another propagation loss model between
+ * nodes that do not move.
+ *
+ * The loss computed by the model set in the PropagationLossModel attribute
+ * is stored for each (transmitter, receiver) pair, and reused as long as
+ * none of the two mobility models changed course and both have a null
+ * velocity. The course changes are tracked through the "CourseChange" trace
+ * source of the mobility models; pairs involving a moving node are never
+ * stored. Each link of a static scenario is thus computed once, including
+ * the channel condition, distance and shadowing computations of models such
+ * as ThreeGppPropagationLossModel.
+ *
+ * The loss is assumed not to depend on the transmit power, as for the
+ * chaining of propagation loss models. The stored losses of models that
+ * vary over time, such as JakesPropagationLossModel or a
+ * ThreeGppPropagationLossModel whose channel condition is periodically
+ * updated, can be limited in age through the MaxAge attribute; the stored
+ * losses of random models are frozen.
+ */
+class CachedPropagationLossModel : public PropagationLossModel
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+  CachedPropagationLossModel ();
+  virtual ~CachedPropagationLossModel ();
+
+protected:
+  virtual void DoDispose (void);
+
+private:
+  /**
+   * \brief Copy constructor
+   *
+   * Defined and unimplemented to avoid misuse
+   */
+  CachedPropagationLossModel (const CachedPropagationLossModel&);
+  /**
+   * \brief Copy constructor
+   *
+   * Defined and unimplemented to avoid misuse
+   * \returns
+   */
+  CachedPropagationLossModel& operator= (const CachedPropagationLossModel&);
+  virtual double DoCalcRxPower (double txPowerDbm,
+                                Ptr<MobilityModel> a,
+                                Ptr<MobilityModel> b) const;
+  virtual int64_t DoAssignStreams (int64_t stream);
+
+  /// The state of a tracked mobility model
+  struct MobilityState
+  {
+    Ptr<MobilityModel> m_mobility; //!< the mobility model
+    uint32_t m_epoch;              //!< incremented at each course change
+    bool m_static;                 //!< true if the velocity is null
+  };
+
+  /**
+   * Get the state of a mobility model, starting to track its course
+   * changes if it is seen for the first time
+   * \param mobility the mobility model
+   * \returns the state of the mobility model
+   */
+  const MobilityState * GetState (Ptr<MobilityModel> mobility) const;
+
+  /**
+   * Invalidate the losses involving a mobility model
+   * \param mobility the mobility model which changed course
+   */
+  void NotifyCourseChange (Ptr<const MobilityModel> mobility) const;
+
+  /// A stored loss
+  struct CachedLoss
+  {
+    const MobilityState *m_tx = 0; //!< the state of the transmitter
+    const MobilityState *m_rx = 0; //!< the state of the receiver
+    uint32_t m_txEpoch = 0; //!< the epoch of the transmitter when computed
+    uint32_t m_rxEpoch = 0; //!< the epoch of the receiver when computed
+    Time m_time;        //!< the time when computed
+    double m_lossDb;    //!< the loss (dB)
+  };
+
+  /// Typedef: transmitter and receiver mobility models
+  typedef std::pair<const MobilityModel *, const MobilityModel *> MobilityPair;
+
+  /// Hash function of a MobilityPair
+  struct MobilityPairHash
+  {
+    /**
+     * \param pair the pair to hash
+     * \returns the hash of the pair
+     */
+    std::size_t operator() (const MobilityPair &pair) const
+    {
+      return std::hash<const MobilityModel *> () (pair.first) * 31
+             + std::hash<const MobilityModel *> () (pair.second);
+    }
+  };
+
+  Ptr<PropagationLossModel> m_model; //!< the model whose losses are stored
+  Time m_maxAge; //!< the maximum age of a stored loss, 0 if unlimited
+  mutable std::unordered_map<const MobilityModel *, MobilityState> m_mobilities; //!< the tracked mobility models
+  mutable std::unordered_map<MobilityPair, CachedLoss, MobilityPairHash> m_losses; //!< the stored losses
+};
+
 } // namespace ns3
 
 #endif /* PROPAGATION_LOSS_MODEL_H */
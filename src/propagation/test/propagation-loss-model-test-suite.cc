@@ -23,6 +23,9 @@
 #include "ns3/double.h"
 #include "ns3/propagation-loss-model.h"
 #include "ns3/constant-position-mobility-model.h"
+#include "ns3/constant-velocity-mobility-model.h"
+#include "ns3/pointer.h"
+#include "ns3/string.h"
 #include "ns3/simulator.h"
 
 using namespace ns3;
@@ -436,6 +439,75 @@ RangePropagationLossModelTestCase::DoRun (void)
   Simulator::Destroy ();
 }
 
+class CachedPropagationLossModelTestCase : public TestCase
+{
+public:
+  CachedPropagationLossModelTestCase ();
+  virtual ~CachedPropagationLossModelTestCase ();
+
+private:
+  virtual void DoRun (void);
+};
+
+CachedPropagationLossModelTestCase::CachedPropagationLossModelTestCase ()
+  : TestCase ("Test CachedPropagationLossModel")
+{
+}
+
+CachedPropagationLossModelTestCase::~CachedPropagationLossModelTestCase ()
+{
+}
+
+void
+CachedPropagationLossModelTestCase::DoRun (void)
+{
+  Ptr<MobilityModel> a = CreateObject<ConstantPositionMobilityModel> ();
+  a->SetPosition (Vector (0,0,0));
+  Ptr<MobilityModel> b = CreateObject<ConstantPositionMobilityModel> ();
+  b->SetPosition (Vector (10,0,0));
+  Ptr<ConstantVelocityMobilityModel> c = CreateObject<ConstantVelocityMobilityModel> ();
+  c->SetPosition (Vector (20,0,0));
+
+  // a random loss changes at every computation
+  Ptr<RandomPropagationLossModel> random = CreateObject<RandomPropagationLossModel> ();
+  random->SetAttribute ("Variable", StringValue ("ns3::UniformRandomVariable[Min=0.0|Max=100.0]"));
+  Ptr<CachedPropagationLossModel> lossModel = CreateObject<CachedPropagationLossModel> ();
+  lossModel->SetAttribute ("PropagationLossModel", PointerValue (random));
+  lossModel->SetAttribute ("MaxAge", TimeValue (Seconds (1)));
+
+  double ab = lossModel->CalcRxPower (0, a, b);
+  double ba = lossModel->CalcRxPower (0, b, a);
+  NS_TEST_EXPECT_MSG_NE (ab, ba, "The losses should be stored per direction");
+  NS_TEST_EXPECT_MSG_EQ (lossModel->CalcRxPower (0, a, b), ab, "The loss a -> b should be stored");
+  NS_TEST_EXPECT_MSG_EQ (lossModel->CalcRxPower (10, a, b), ab + 10, "The loss should not depend on the transmit power");
+  NS_TEST_EXPECT_MSG_EQ (lossModel->CalcRxPower (0, b, a), ba, "The loss b -> a should be stored");
+
+  // a course change invalidates the losses of the node
+  b->SetPosition (Vector (15,0,0));
+  double ab2 = lossModel->CalcRxPower (0, a, b);
+  NS_TEST_EXPECT_MSG_NE (ab2, ab, "The loss a -> b should be recomputed after a course change");
+  NS_TEST_EXPECT_MSG_EQ (lossModel->CalcRxPower (0, a, b), ab2, "The new loss a -> b should be stored");
+
+  // the losses of a moving node are never stored, until it stops
+  double ac = lossModel->CalcRxPower (0, a, c);
+  NS_TEST_EXPECT_MSG_EQ (lossModel->CalcRxPower (0, a, c), ac, "The loss a -> c should be stored");
+  c->SetVelocity (Vector (1,0,0));
+  double ac2 = lossModel->CalcRxPower (0, a, c);
+  NS_TEST_EXPECT_MSG_NE (lossModel->CalcRxPower (0, a, c), ac2, "The loss a -> c should not be stored");
+  c->SetVelocity (Vector (0,0,0));
+  double ac3 = lossModel->CalcRxPower (0, a, c);
+  NS_TEST_EXPECT_MSG_EQ (lossModel->CalcRxPower (0, a, c), ac3, "The loss a -> c should be stored again");
+
+  // the stored losses expire after MaxAge
+  Simulator::Stop (Seconds (2));
+  Simulator::Run ();
+  NS_TEST_EXPECT_MSG_NE (lossModel->CalcRxPower (0, a, b), ab2, "The loss a -> b should have expired");
+
+  lossModel->Dispose ();
+  b->SetPosition (Vector (20,0,0));
+  Simulator::Destroy ();
+}
+
 class PropagationLossModelsTestSuite : public TestSuite
 {
 public:
@@ -450,6 +522,7 @@ PropagationLossModelsTestSuite::PropagationLossModelsTestSuite ()
   AddTestCase (new LogDistancePropagationLossModelTestCase, TestCase::QUICK);
   AddTestCase (new MatrixPropagationLossModelTestCase, TestCase::QUICK);
   AddTestCase (new RangePropagationLossModelTestCase, TestCase::QUICK);
+  AddTestCase (new CachedPropagationLossModelTestCase, TestCase::QUICK);
 }
 
 static PropagationLossModelsTestSuite propagationLossModelsTestSuite;
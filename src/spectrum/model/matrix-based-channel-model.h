@@ -28,6 +28,7 @@
 #include <ns3/vector.h>
 #include <ns3/phased-array-model.h>
 #include <tuple>
+#include <vector>
 
 namespace ns3 {
 
@@ -52,7 +53,117 @@ public:
   typedef std::vector<DoubleVector> Double2DVector; //!< type definition for matrices of doubles
   typedef std::vector<Double2DVector> Double3DVector; //!< type definition for 3D matrices of doubles
   typedef std::vector<PhasedArrayModel::ComplexVector> Complex2DVector; //!< type definition for complex matrices
-  typedef std::vector<Complex2DVector> Complex3DVector; //!< type definition for complex 3D matrices
+
+  /**
+   * Dense 3D matrix of complex values, stored in a single contiguous
+   * array with the page index varying the fastest: the values of all
+   * the pages of a (row, column) element are contiguous, so that loops
+   * over the pages (e.g., the clusters of a channel matrix) access
+   * memory sequentially and can be vectorized.
+   */
+  class Complex3DVector
+  {
+  public:
+    /**
+     * Create an empty matrix
+     */
+    Complex3DVector ()
+      : m_numRows (0),
+        m_numCols (0),
+        m_numPages (0)
+    {
+    }
+
+    /**
+     * Create a matrix of zeros
+     * \param numRows the number of rows
+     * \param numCols the number of columns
+     * \param numPages the number of pages
+     */
+    Complex3DVector (size_t numRows, size_t numCols, size_t numPages)
+      : m_numRows (numRows),
+        m_numCols (numCols),
+        m_numPages (numPages),
+        m_values (numRows * numCols * numPages)
+    {
+    }
+
+    /**
+     * \return the number of rows
+     */
+    size_t GetNumRows () const
+    {
+      return m_numRows;
+    }
+
+    /**
+     * \return the number of columns
+     */
+    size_t GetNumCols () const
+    {
+      return m_numCols;
+    }
+
+    /**
+     * \return the number of pages
+     */
+    size_t GetNumPages () const
+    {
+      return m_numPages;
+    }
+
+    /**
+     * \param row the row index
+     * \param col the column index
+     * \param page the page index
+     * \return a reference to the value at (row, col, page)
+     */
+    std::complex<double> & operator() (size_t row, size_t col, size_t page)
+    {
+      NS_ASSERT (row < m_numRows && col < m_numCols && page < m_numPages);
+      return m_values[(row * m_numCols + col) * m_numPages + page];
+    }
+
+    /**
+     * \param row the row index
+     * \param col the column index
+     * \param page the page index
+     * \return a const reference to the value at (row, col, page)
+     */
+    const std::complex<double> & operator() (size_t row, size_t col, size_t page) const
+    {
+      NS_ASSERT (row < m_numRows && col < m_numCols && page < m_numPages);
+      return m_values[(row * m_numCols + col) * m_numPages + page];
+    }
+
+    /**
+     * \param row the row index
+     * \param col the column index
+     * \return a pointer to the GetNumPages () contiguous values of (row, col)
+     */
+    std::complex<double> * GetPages (size_t row, size_t col)
+    {
+      NS_ASSERT (row < m_numRows && col < m_numCols);
+      return m_values.data () + (row * m_numCols + col) * m_numPages;
+    }
+
+    /**
+     * \param row the row index
+     * \param col the column index
+     * \return a const pointer to the GetNumPages () contiguous values of (row, col)
+     */
+    const std::complex<double> * GetPages (size_t row, size_t col) const
+    {
+      NS_ASSERT (row < m_numRows && col < m_numCols);
+      return m_values.data () + (row * m_numCols + col) * m_numPages;
+    }
+
+  private:
+    size_t m_numRows;  //!< the number of rows
+    size_t m_numCols;  //!< the number of columns
+    size_t m_numPages; //!< the number of pages
+    std::vector<std::complex<double> > m_values; //!< the values, page index first
+  };
 
 
   /**
@@ -60,7 +171,7 @@ public:
    */
   struct ChannelMatrix : public SimpleRefCount<ChannelMatrix>
   {
-    Complex3DVector    m_channel; //!< channel matrix H[u][s][n].
+    Complex3DVector    m_channel; //!< channel matrix H[u][s][n], accessed as m_channel (u, s, n).
     DoubleVector       m_delay; //!< cluster delay in nanoseconds.
     Double2DVector     m_angle; //!< cluster angle angle[direction][n], where direction = 0(AOA), 1(ZOA), 2(AOD), 3(ZOD) in degree.
     Time               m_generatedTime; //!< generation time
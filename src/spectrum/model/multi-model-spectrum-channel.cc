@@ -20,6 +20,7 @@
 
 #include <algorithm>
 #include <iostream>
+#include <map>
 #include <utility>
 #include <ns3/object.h>
 #include <ns3/simulator.h>
@@ -90,6 +91,7 @@ MultiModelSpectrumChannel::DoDispose ()
   NS_LOG_FUNCTION (this);
   m_txSpectrumModelInfoMap.clear ();
   m_rxSpectrumModelInfoMap.clear ();
+  m_rxInRange.clear ();
   SpectrumChannel::DoDispose ();
 }
 
@@ -134,6 +136,7 @@ MultiModelSpectrumChannel::AddRx (Ptr<SpectrumPhy> phy)
     }
 
   ++m_numDevices;
+  IndexRx (phy);
 
   RxSpectrumModelInfoMap_t::iterator rxInfoIterator = m_rxSpectrumModelInfoMap.find (rxSpectrumModelUid);
 
@@ -235,6 +238,19 @@ MultiModelSpectrumChannel::StartTx (Ptr<SpectrumSignalParameters> txParams)
   NS_LOG_LOGIC ("converter map size: " << txInfoIteratorerator->second.m_spectrumConverterMap.size ());
   NS_LOG_LOGIC ("converter map first element: " << txInfoIteratorerator->second.m_spectrumConverterMap.begin ()->first);
 
+  // With a maximum range, only the PHYs within range of the
+  // transmitter are considered, grouped by RX SpectrumModel
+  bool inRangeOnly = m_maxRange > 0 && txMobility;
+  std::map<SpectrumModelUid_t, std::vector<Ptr<SpectrumPhy> > > rxPhysInRange;
+  if (inRangeOnly)
+    {
+      GetRxInRange (txMobility, m_rxInRange);
+      for (auto rxPhyIterator = m_rxInRange.begin (); rxPhyIterator != m_rxInRange.end (); ++rxPhyIterator)
+        {
+          rxPhysInRange[(*rxPhyIterator)->GetRxSpectrumModel ()->GetUid ()].push_back (*rxPhyIterator);
+        }
+    }
+
   for (RxSpectrumModelInfoMap_t::const_iterator rxInfoIterator = m_rxSpectrumModelInfoMap.begin ();
        rxInfoIterator != m_rxSpectrumModelInfoMap.end ();
        ++rxInfoIterator)
@@ -242,6 +258,12 @@ MultiModelSpectrumChannel::StartTx (Ptr<SpectrumSignalParameters> txParams)
       SpectrumModelUid_t rxSpectrumModelUid = rxInfoIterator->second.m_rxSpectrumModel->GetUid ();
       NS_LOG_LOGIC ("rxSpectrumModelUids " << rxSpectrumModelUid);
 
+      const std::vector<Ptr<SpectrumPhy> > &rxPhys = inRangeOnly ? rxPhysInRange[rxSpectrumModelUid] : rxInfoIterator->second.m_rxPhys;
+      if (rxPhys.empty ())
+        {
+          continue;
+        }
+
       Ptr <SpectrumValue> convertedTxPowerSpectrum;
       if (txSpectrumModelUid == rxSpectrumModelUid)
         {
@@ -260,8 +282,8 @@ MultiModelSpectrumChannel::StartTx (Ptr<SpectrumSignalParameters> txParams)
           convertedTxPowerSpectrum = rxConverterIterator->second.Convert (txParams->psd);
         }
 
-      for (auto rxPhyIterator = rxInfoIterator->second.m_rxPhys.begin ();
-           rxPhyIterator != rxInfoIterator->second.m_rxPhys.end ();
+      for (auto rxPhyIterator = rxPhys.begin ();
+           rxPhyIterator != rxPhys.end ();
            ++rxPhyIterator)
         {
           NS_ASSERT_MSG ((*rxPhyIterator)->GetRxSpectrumModel ()->GetUid () == rxSpectrumModelUid,
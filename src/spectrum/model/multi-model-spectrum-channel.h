@@ -157,6 +157,11 @@ private:
    */
   TxSpectrumModelInfoMap_t m_txSpectrumModelInfoMap;
 
+  /**
+   * SpectrumPhy instances within MaxRange of the current transmitter.
+   */
+  std::vector<Ptr<SpectrumPhy> > m_rxInRange;
+
 
   /**
    * Data structure holding, for each RX spectrum model, all the
@@ -54,6 +54,7 @@ SingleModelSpectrumChannel::DoDispose ()
 {
   NS_LOG_FUNCTION (this);
   m_phyList.clear ();
+  m_rxInRange.clear ();
   m_spectrumModel = 0;
   SpectrumChannel::DoDispose ();
 }
@@ -76,6 +77,7 @@ SingleModelSpectrumChannel::AddRx (Ptr<SpectrumPhy> phy)
 {
   NS_LOG_FUNCTION (this << phy);
   m_phyList.push_back (phy);
+  IndexRx (phy);
 }
 
 
@@ -106,8 +108,15 @@ SingleModelSpectrumChannel::StartTx (Ptr<SpectrumSignalParameters> txParams)
 
   Ptr<MobilityModel> senderMobility = txParams->txPhy->GetMobility ();
 
-  for (PhyList::const_iterator rxPhyIterator = m_phyList.begin ();
-       rxPhyIterator != m_phyList.end ();
+  const PhyList *rxPhys = &m_phyList;
+  if (m_maxRange > 0 && senderMobility)
+    {
+      GetRxInRange (senderMobility, m_rxInRange);
+      rxPhys = &m_rxInRange;
+    }
+
+  for (PhyList::const_iterator rxPhyIterator = rxPhys->begin ();
+       rxPhyIterator != rxPhys->end ();
        ++rxPhyIterator)
     {
       if ((*rxPhyIterator) != txParams->txPhy)
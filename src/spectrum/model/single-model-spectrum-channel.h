@@ -77,6 +77,11 @@ private:
    */
   PhyList m_phyList;
 
+  /**
+   * SpectrumPhy instances within MaxRange of the current transmitter.
+   */
+  PhyList m_rxInRange;
+
   /**
    * SpectrumModel that this channel instance is supporting.
    */
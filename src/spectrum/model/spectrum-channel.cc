@@ -18,6 +18,8 @@
  * Author: Nicola Baldo <nbaldo@cttc.es>
  */
 
+#include <algorithm>
+
 #include <ns3/log.h>
 #include <ns3/double.h>
 #include <ns3/pointer.h>
@@ -32,6 +34,7 @@ NS_LOG_COMPONENT_DEFINE ("SpectrumChannel");
 NS_OBJECT_ENSURE_REGISTERED (SpectrumChannel);
 
 SpectrumChannel::SpectrumChannel ()
+  : m_nLocatedRx (0)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -47,6 +50,10 @@ SpectrumChannel::DoDispose ()
   m_propagationLoss = 0;
   m_propagationDelay = 0;
   m_spectrumPropagationLoss = 0;
+  m_rxGrid.Clear ();
+  m_indexedRx.clear ();
+  m_unlocatedRx.clear ();
+  m_nLocatedRx = 0;
 }
 
 TypeId
@@ -70,6 +77,18 @@ SpectrumChannel::GetTypeId (void)
                    MakeDoubleAccessor (&SpectrumChannel::m_maxLossDb),
                    MakeDoubleChecker<double> ())
 
+    .AddAttribute ("MaxRange",
+                   "If positive, transmissions are only passed to the "
+                   "receiving PHYs within this distance, in meters, of the "
+                   "transmitting PHY; the others are neither evaluated "
+                   "by the propagation models nor scheduled. The receiving "
+                   "PHYs are found through a grid of the non-moving PHYs, "
+                   "updated on the course changes of their mobility model. "
+                   "The default value disables the cutoff.",
+                   DoubleValue (0),
+                   MakeDoubleAccessor (&SpectrumChannel::m_maxRange),
+                   MakeDoubleChecker<double> (0))
+
     .AddAttribute ("PropagationLossModel",
                    "A pointer to the propagation loss model attached to this channel.",
                    PointerValue (0),
@@ -155,5 +174,52 @@ SpectrumChannel::GetPropagationLossModel ()
   return m_propagationLoss;
 }
 
+void
+SpectrumChannel::IndexRx (Ptr<SpectrumPhy> phy)
+{
+  NS_LOG_FUNCTION (this << phy);
+  if (std::find (m_indexedRx.begin (), m_indexedRx.end (), phy) == m_indexedRx.end ())
+    {
+      m_indexedRx.push_back (phy);
+    }
+}
+
+void
+SpectrumChannel::GetRxInRange (Ptr<const MobilityModel> txMobility, std::vector<Ptr<SpectrumPhy> > &phys)
+{
+  NS_LOG_FUNCTION (this << txMobility);
+  NS_ASSERT (m_maxRange > 0);
+  if (m_nLocatedRx == 0)
+    {
+      m_rxGrid.SetCellSize (m_maxRange);
+    }
+  // The mobility model of a PHY is usually set after the PHY is added
+  // to the channel, so it is only looked up on the first transmission
+  for (; m_nLocatedRx < m_indexedRx.size (); ++m_nLocatedRx)
+    {
+      Ptr<MobilityModel> mobility = m_indexedRx[m_nLocatedRx]->GetMobility ();
+      if (mobility)
+        {
+          m_rxGrid.Add (m_nLocatedRx, mobility);
+        }
+      else
+        {
+          m_unlocatedRx.push_back (m_nLocatedRx);
+        }
+    }
+
+  m_rxGrid.GetInRange (txMobility->GetPosition (), m_maxRange, m_rxIds);
+  if (!m_unlocatedRx.empty ())
+    {
+      m_rxIds.insert (m_rxIds.end (), m_unlocatedRx.begin (), m_unlocatedRx.end ());
+      std::sort (m_rxIds.begin (), m_rxIds.end ());
+    }
+  phys.clear ();
+  for (std::vector<uint32_t>::const_iterator i = m_rxIds.begin (); i != m_rxIds.end (); ++i)
+    {
+      phys.push_back (m_indexedRx[*i]);
+    }
+}
+
 
 } // namespace
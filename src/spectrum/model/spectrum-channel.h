@@ -32,6 +32,7 @@
 #include <ns3/spectrum-phy.h>
 #include <ns3/traced-callback.h>
 #include <ns3/mobility-model.h>
+#include <ns3/spatial-grid.h>
 
 namespace ns3 {
 
@@ -157,6 +158,23 @@ public:
   typedef void (* SignalParametersTracedCallback) (Ptr<SpectrumSignalParameters> params);
 
 protected:
+  /**
+   * Record a receiving PHY for the range queries of GetRxInRange.
+   * Adding a PHY twice has no effect.
+   *
+   * \param phy The receiving PHY.
+   */
+  void IndexRx (Ptr<SpectrumPhy> phy);
+
+  /**
+   * Get the receiving PHYs within MaxRange of a transmitter.
+   *
+   * The receiving PHYs without a mobility model are always returned.
+   *
+   * \param txMobility The mobility model of the transmitter.
+   * \param [out] phys The receiving PHYs, in the order they were indexed.
+   */
+  void GetRxInRange (Ptr<const MobilityModel> txMobility, std::vector<Ptr<SpectrumPhy> > &phys);
 
   /**
    * The `PathLoss` trace source. Exporting the pointers to the Tx and Rx
@@ -183,6 +201,14 @@ protected:
    */
   double m_maxLossDb;
 
+  /**
+   * Maximum range [m].
+   *
+   * When positive, only the devices within this distance of the
+   * transmitter are considered.
+   */
+  double m_maxRange;
+
   /**
    * Single-frequency propagation loss model to be used with this channel.
    */
@@ -198,7 +224,12 @@ protected:
    */
   Ptr<SpectrumPropagationLossModel> m_spectrumPropagationLoss;
 
-
+private:
+  std::vector<Ptr<SpectrumPhy> > m_indexedRx;  //!< Receiving PHYs, by id in the grid.
+  uint32_t m_nLocatedRx;                       //!< Number of receiving PHYs looked up for a mobility model.
+  std::vector<uint32_t> m_unlocatedRx;         //!< Ids of the receiving PHYs without mobility model.
+  SpatialGrid m_rxGrid;                        //!< Receiving PHYs with a mobility model.
+  std::vector<uint32_t> m_rxIds;               //!< Result of the last range query.
 };
 
 
@@ -27,6 +27,7 @@
 #include "ns3/double.h"
 #include "ns3/string.h"
 #include "ns3/integer.h"
+#include "ns3/uinteger.h"
 #include <algorithm>
 #include <random>
 #include "ns3/log.h"
@@ -160,15 +161,26 @@ static const double sqrtC_office_NLOS[6][6] = {
   {0, -0.069282, 0.295397, 0.430696, 0.468462, 0.709214},
 };
 
+Ptr<ThreeGppChannelModel::RandomVariables>
+ThreeGppChannelModel::CreateRandomVariables (void)
+{
+  Ptr<ThreeGppChannelModel::RandomVariables> rv = Create<ThreeGppChannelModel::RandomVariables> ();
+  rv->m_uniformRv = CreateObject<UniformRandomVariable> ();
+  rv->m_uniformRvShuffle = CreateObject<UniformRandomVariable> ();
+
+  rv->m_normalRv = CreateObject<NormalRandomVariable> ();
+  rv->m_normalRv->SetAttribute ("Mean", DoubleValue (0.0));
+  rv->m_normalRv->SetAttribute ("Variance", DoubleValue (1.0));
+  return rv;
+}
+
 ThreeGppChannelModel::ThreeGppChannelModel ()
+#ifdef HAVE_PTHREAD_H
+  : m_poolStop (false)
+#endif
 {
   NS_LOG_FUNCTION (this);
-  m_uniformRv = CreateObject<UniformRandomVariable> ();
-  m_uniformRvShuffle = CreateObject<UniformRandomVariable> ();
-
-  m_normalRv = CreateObject<NormalRandomVariable> ();
-  m_normalRv->SetAttribute ("Mean", DoubleValue (0.0));
-  m_normalRv->SetAttribute ("Variance", DoubleValue (1.0));
+  m_randomVariables = CreateRandomVariables ();
 }
 
 ThreeGppChannelModel::~ThreeGppChannelModel ()
@@ -179,7 +191,26 @@ ThreeGppChannelModel::~ThreeGppChannelModel ()
 void
 ThreeGppChannelModel::DoDispose ()
 {
+#ifdef HAVE_PTHREAD_H
+  {
+    CriticalSection cs (m_poolMutex);
+    m_poolStop = true;
+  }
+  m_poolWork.SetCondition (true);
+  m_poolWork.Broadcast ();
+  for (auto &thread : m_poolThreads)
+    {
+      thread->Join ();
+    }
+  m_poolThreads.clear ();
+  m_poolQueue.clear ();
+#endif
+  for (auto &entry : m_channelMap)
+    {
+      entry.second.m_pregenerationEvent.Cancel ();
+    }
   m_channelMap.clear ();
+  m_lruList.clear ();
   m_channelConditionModel->Dispose ();
   m_channelConditionModel = nullptr;
 }
@@ -215,6 +246,27 @@ ThreeGppChannelModel::GetTypeId (void)
                    TimeValue (MilliSeconds (0)),
                    MakeTimeAccessor (&ThreeGppChannelModel::m_updatePeriod),
                    MakeTimeChecker ())
+    .AddAttribute ("MaxChannels",
+                   "The maximum number of channel matrices kept in memory; "
+                   "the least recently used ones are evicted first. "
+                   "0 means no limit.",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&ThreeGppChannelModel::m_maxChannels),
+                   MakeUintegerChecker<uint32_t> ())
+    .AddAttribute ("PregenerationThreads",
+                   "The number of worker threads generating the realization "
+                   "of the next update period of the pairs requested in the "
+                   "current one. 0 disables the pre-generation. "
+                   "Ignored if UpdatePeriod is 0.",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&ThreeGppChannelModel::m_pregenerationThreads),
+                   MakeUintegerChecker<uint32_t> ())
+    .AddAttribute ("PregenerationLead",
+                   "How long before the end of the update period of a pair "
+                   "the pre-generation of its next realization starts",
+                   TimeValue (MilliSeconds (1)),
+                   MakeTimeAccessor (&ThreeGppChannelModel::m_pregenerationLead),
+                   MakeTimeChecker ())
     // attributes for the blockage model
     .AddAttribute ("Blockage",
                    "Enable blockage model A (sec 7.6.4.1)",
@@ -986,62 +1038,274 @@ ThreeGppChannelModel::GetChannel (Ptr<const MobilityModel> aMob,
   // Check if the channel is present in the map and return it, otherwise
   // generate a new channel
   bool update = false;
-  bool notFound = false;
-  Ptr<ThreeGppChannelMatrix> channelMatrix;
-  if (m_channelMap.find (channelId) != m_channelMap.end ())
+  auto it = m_channelMap.find (channelId);
+  if (it != m_channelMap.end ())
     {
       // channel matrix present in the map
       NS_LOG_DEBUG ("channel matrix present in the map");
-      channelMatrix = m_channelMap[channelId];
+      m_lruList.splice (m_lruList.begin (), m_lruList, it->second.m_lruIt);
 
       // check if it has to be updated
-      update = ChannelMatrixNeedsUpdate (channelMatrix, condition);
+      update = ChannelMatrixNeedsUpdate (it->second.m_channel, condition);
     }
   else
     {
       NS_LOG_DEBUG ("channel matrix not found");
-      notFound = true;
+      ChannelEntry entry;
+      if (m_pregenerationThreads > 0 && !m_updatePeriod.IsZero ())
+        {
+          entry.m_randomVariables = CreateRandomVariables ();
+        }
+      m_lruList.push_front (channelId);
+      entry.m_lruIt = m_lruList.begin ();
+      it = m_channelMap.insert (std::make_pair (channelId, entry)).first;
+      update = true;
     }
 
+  ChannelEntry &entry = it->second;
+  entry.m_lastAccess = Simulator::Now ();
+  entry.m_aMob = aMob;
+  entry.m_bMob = bMob;
+  entry.m_aAntenna = aAntenna;
+  entry.m_bAntenna = bAntenna;
+
   // If the channel is not present in the map or if it has to be updated
   // generate a new realization
-  if (notFound || update)
+  if (update)
     {
-      // channel matrix not found or has to be updated, generate a new one
-      Angles txAngle (bMob->GetPosition (), aMob->GetPosition ());
-      Angles rxAngle (aMob->GetPosition (), bMob->GetPosition ());
+      Ptr<ThreeGppChannelMatrix> channelMatrix;
+      if (entry.m_job)
+        {
+          // the job is always completed, so that the random variables of the
+          // pair are drawn in the same way whatever the timing of the threads
+          CompleteGenerationJob (*entry.m_job);
+          if (Simulator::Now () - entry.m_job->m_startTime <= m_updatePeriod
+              && entry.m_job->m_channelCondition->IsEqual (condition))
+            {
+              NS_LOG_DEBUG ("use the pre-generated channel matrix");
+              channelMatrix = entry.m_job->m_channel;
+              channelMatrix->m_nodeIds = entry.m_job->m_nodeIds;
+            }
+          entry.m_job = nullptr;
+        }
+      entry.m_pregenerationEvent.Cancel ();
+
+      if (!channelMatrix)
+        {
+          Ptr<GenerationJob> job = CreateGenerationJob (aMob, bMob, aAntenna, bAntenna, condition,
+                                                        entry.m_randomVariables ? entry.m_randomVariables : m_randomVariables);
+          RunGenerationJob (*job);
+          channelMatrix = job->m_channel;
+          channelMatrix->m_nodeIds = job->m_nodeIds;
+        }
+      channelMatrix->m_channelCondition = condition;
+      channelMatrix->m_generatedTime = Simulator::Now ();
 
-      double x = aMob->GetPosition ().x - bMob->GetPosition ().x;
-      double y = aMob->GetPosition ().y - bMob->GetPosition ().y;
-      double distance2D = sqrt (x * x + y * y);
+      // store or replace the channel matrix in the channel map
+      entry.m_channel = channelMatrix;
+      SchedulePregeneration (channelId, entry);
+      EvictChannels ();
+      return channelMatrix;
+    }
 
-      // NOTE we assume hUT = min (height(a), height(b)) and
-      // hBS = max (height (a), height (b))
-      double hUt = std::min (aMob->GetPosition ().z, bMob->GetPosition ().z);
-      double hBs = std::max (aMob->GetPosition ().z, bMob->GetPosition ().z);
+  return entry.m_channel;
+}
 
-      // TODO this is not currently used, it is needed for the computation of the
-      // additional blockage in case of spatial consistent update
-      // I do not know who is the UT, I can use the relative distance between
-      // tx and rx instead
-      Vector locUt = Vector (0.0, 0.0, 0.0);
+Ptr<ThreeGppChannelModel::GenerationJob>
+ThreeGppChannelModel::CreateGenerationJob (Ptr<const MobilityModel> aMob,
+                                           Ptr<const MobilityModel> bMob,
+                                           Ptr<const PhasedArrayModel> aAntenna,
+                                           Ptr<const PhasedArrayModel> bAntenna,
+                                           Ptr<const ChannelCondition> condition,
+                                           Ptr<const RandomVariables> rv) const
+{
+  NS_LOG_FUNCTION (this);
 
-      channelMatrix = GetNewChannel (locUt, condition, aAntenna, bAntenna, rxAngle, txAngle, distance2D, hBs, hUt);
-      channelMatrix->m_nodeIds = std::make_pair (aMob->GetObject<Node> ()->GetId (), bMob->GetObject<Node> ()->GetId ());
+  Ptr<GenerationJob> job = Create<GenerationJob> (Angles (aMob->GetPosition (), bMob->GetPosition ()),
+                                                  Angles (bMob->GetPosition (), aMob->GetPosition ()));
+  job->m_startTime = Simulator::Now ();
+  job->m_nodeIds = std::make_pair (aMob->GetObject<Node> ()->GetId (), bMob->GetObject<Node> ()->GetId ());
+  job->m_channelCondition = condition;
+  job->m_sAntenna = aAntenna;
+  job->m_uAntenna = bAntenna;
+
+  double x = aMob->GetPosition ().x - bMob->GetPosition ().x;
+  double y = aMob->GetPosition ().y - bMob->GetPosition ().y;
+  job->m_dis2D = sqrt (x * x + y * y);
+
+  // NOTE we assume hUT = min (height(a), height(b)) and
+  // hBS = max (height (a), height (b))
+  job->m_hUt = std::min (aMob->GetPosition ().z, bMob->GetPosition ().z);
+  job->m_hBs = std::max (aMob->GetPosition ().z, bMob->GetPosition ().z);
+
+  job->m_randomVariables = rv;
+  job->m_started = false;
+  job->m_done = false;
+  return job;
+}
 
-      // store or replace the channel matrix in the channel map
-      m_channelMap[channelId] = channelMatrix;
+void
+ThreeGppChannelModel::RunGenerationJob (GenerationJob &job) const
+{
+  // TODO this is not currently used, it is needed for the computation of the
+  // additional blockage in case of spatial consistent update
+  // I do not know who is the UT, I can use the relative distance between
+  // tx and rx instead
+  Vector locUt = Vector (0.0, 0.0, 0.0);
+
+  job.m_channel = GetNewChannel (locUt, job.m_channelCondition, job.m_sAntenna, job.m_uAntenna,
+                                 job.m_uAngle, job.m_sAngle, job.m_dis2D, job.m_hBs, job.m_hUt,
+                                 *job.m_randomVariables);
+}
+
+void
+ThreeGppChannelModel::CompleteGenerationJob (GenerationJob &job)
+{
+  NS_LOG_FUNCTION (this);
+#ifdef HAVE_PTHREAD_H
+  bool started;
+  {
+    CriticalSection cs (m_poolMutex);
+    started = job.m_started;
+    if (!started)
+      {
+        job.m_started = true;
+        m_poolQueue.remove (&job);
+      }
+  }
+  while (started)
+    {
+      {
+        CriticalSection cs (m_poolMutex);
+        if (job.m_done)
+          {
+            return;
+          }
+      }
+      m_poolDone.TimedWait (100000);
+    }
+#endif
+  if (!job.m_done)
+    {
+      RunGenerationJob (job);
+      job.m_done = true;
+    }
+}
+
+void
+ThreeGppChannelModel::SchedulePregeneration (uint32_t channelId, ChannelEntry &entry)
+{
+  if (!entry.m_randomVariables)
+    {
+      return;
+    }
+  Time delay = Max (m_updatePeriod - m_pregenerationLead, Time (0));
+  entry.m_pregenerationEvent = Simulator::Schedule (delay, &ThreeGppChannelModel::StartPregeneration,
+                                                    this, channelId);
+}
+
+void
+ThreeGppChannelModel::StartPregeneration (uint32_t channelId)
+{
+  NS_LOG_FUNCTION (this << channelId);
+
+  auto it = m_channelMap.find (channelId);
+  NS_ASSERT_MSG (it != m_channelMap.end (), "The event should have been canceled");
+  ChannelEntry &entry = it->second;
+  if (entry.m_lastAccess <= entry.m_channel->m_generatedTime)
+    {
+      NS_LOG_DEBUG ("channel not requested in this update period");
+      return;
+    }
+
+  // the worker thread must not share the reference count of the channel
+  // condition with the main thread, hence the copy
+  Ptr<const ChannelCondition> current = entry.m_channel->m_channelCondition;
+  Ptr<const ChannelCondition> condition = CreateObject<ChannelCondition> (current->GetLosCondition (),
+                                                                          current->GetO2iCondition ());
+  entry.m_job = CreateGenerationJob (entry.m_aMob, entry.m_bMob, entry.m_aAntenna, entry.m_bAntenna,
+                                     condition, entry.m_randomVariables);
+
+#ifdef HAVE_PTHREAD_H
+  while (m_poolThreads.size () < m_pregenerationThreads)
+    {
+      Ptr<SystemThread> thread = Create<SystemThread> (MakeCallback (&ThreeGppChannelModel::PregenerationWorker, this));
+      thread->Start ();
+      m_poolThreads.push_back (thread);
     }
+  {
+    CriticalSection cs (m_poolMutex);
+    m_poolQueue.push_back (PeekPointer (entry.m_job));
+  }
+  m_poolWork.SetCondition (true);
+  m_poolWork.Signal ();
+#endif
+  // without threads, the job is run when the channel is requested
+}
 
-  return channelMatrix;
+#ifdef HAVE_PTHREAD_H
+void
+ThreeGppChannelModel::PregenerationWorker (void)
+{
+  while (true)
+    {
+      GenerationJob *job = 0;
+      {
+        CriticalSection cs (m_poolMutex);
+        if (m_poolStop)
+          {
+            return;
+          }
+        if (!m_poolQueue.empty ())
+          {
+            job = m_poolQueue.front ();
+            m_poolQueue.pop_front ();
+            job->m_started = true;
+          }
+      }
+      if (job == 0)
+        {
+          m_poolWork.TimedWait (1000000);
+          continue;
+        }
+      RunGenerationJob (*job);
+      {
+        CriticalSection cs (m_poolMutex);
+        job->m_done = true;
+      }
+      m_poolDone.SetCondition (true);
+      m_poolDone.Broadcast ();
+    }
+}
+#endif
+
+void
+ThreeGppChannelModel::EvictChannels (void)
+{
+  while (m_maxChannels > 0 && m_channelMap.size () > m_maxChannels)
+    {
+      uint32_t channelId = m_lruList.back ();
+      NS_LOG_DEBUG ("evict the channel matrix " << channelId);
+      ChannelEntry &entry = m_channelMap.at (channelId);
+      if (entry.m_job)
+        {
+          // complete the job anyway to keep the random variables of the pair,
+          // which are evicted too, independent of the timing of the threads
+          CompleteGenerationJob (*entry.m_job);
+        }
+      entry.m_pregenerationEvent.Cancel ();
+      m_channelMap.erase (channelId);
+      m_lruList.pop_back ();
+    }
 }
 
 Ptr<ThreeGppChannelModel::ThreeGppChannelMatrix>
 ThreeGppChannelModel::GetNewChannel (Vector locUT, Ptr<const ChannelCondition> channelCondition,
-                                     Ptr<const PhasedArrayModel> sAntenna,
-                                     Ptr<const PhasedArrayModel> uAntenna,
+                                     const Ptr<const PhasedArrayModel> &sAntenna,
+                                     const Ptr<const PhasedArrayModel> &uAntenna,
                                      Angles &uAngle, Angles &sAngle,
-                                     double dis2D, double hBS, double hUT) const
+                                     double dis2D, double hBS, double hUT,
+                                     const RandomVariables &rv) const
 {
   NS_LOG_FUNCTION (this);
 
@@ -1057,7 +1321,6 @@ ThreeGppChannelModel::GetNewChannel (Vector locUT, Ptr<const ChannelCondition> c
   // create a channel matrix instance
   Ptr<ThreeGppChannelMatrix> channelParams = Create<ThreeGppChannelMatrix> ();
   channelParams->m_channelCondition = channelCondition; // set the channel condition
-  channelParams->m_generatedTime = Simulator::Now ();
 
   // compute the 3D distance using eq. 7.4-1
   double dis3D = std::sqrt (dis2D * dis2D + (hBS - hUT) * (hBS - hUT));
@@ -1079,7 +1342,7 @@ ThreeGppChannelModel::GetNewChannel (Vector locUT, Ptr<const ChannelCondition> c
   //Generate paramNum independent LSPs.
   for (uint8_t iter = 0; iter < paramNum; iter++)
     {
-      LSPsIndep.push_back (m_normalRv->GetValue ());
+      LSPsIndep.push_back (rv.m_normalRv->GetValue ());
     }
   for (uint8_t row = 0; row < paramNum; row++)
     {
@@ -1127,7 +1390,7 @@ ThreeGppChannelModel::GetNewChannel (Vector locUT, Ptr<const ChannelCondition> c
   double minTau = 100.0;
   for (uint8_t cIndex = 0; cIndex < numOfCluster; cIndex++)
     {
-      double tau = -1 * table3gpp->m_rTau * DS * log (m_uniformRv->GetValue (0,1)); //(7.5-1)
+      double tau = -1 * table3gpp->m_rTau * DS * log (rv.m_uniformRv->GetValue (0,1)); //(7.5-1)
       if (minTau > tau)
         {
           minTau = tau;
@@ -1150,7 +1413,7 @@ ThreeGppChannelModel::GetNewChannel (Vector locUT, Ptr<const ChannelCondition> c
   for (uint8_t cIndex = 0; cIndex < numOfCluster; cIndex++)
     {
       double power = exp (-1 * clusterDelay[cIndex] * (table3gpp->m_rTau - 1) / table3gpp->m_rTau / DS) *
-        pow (10,-1 * m_normalRv->GetValue () * table3gpp->m_perClusterShadowingStd / 10);                       //(7.5-5)
+        pow (10,-1 * rv.m_normalRv->GetValue () * table3gpp->m_perClusterShadowingStd / 10);                       //(7.5-5)
       powerSum += power;
       clusterPower.push_back (power);
     }
@@ -1329,21 +1592,21 @@ ThreeGppChannelModel::GetNewChannel (Vector locUT, Ptr<const ChannelCondition> c
   for (uint8_t cIndex = 0; cIndex < numReducedCluster; cIndex++)
     {
       int Xn = 1;
-      if (m_uniformRv->GetValue (0,1) < 0.5)
+      if (rv.m_uniformRv->GetValue (0,1) < 0.5)
         {
           Xn = -1;
         }
-      clusterAoa[cIndex] = clusterAoa[cIndex] * Xn + (m_normalRv->GetValue () * ASA / 7) + RadiansToDegrees (uAngle.GetAzimuth ());        //(7.5-11)
-      clusterAod[cIndex] = clusterAod[cIndex] * Xn + (m_normalRv->GetValue () * ASD / 7) + RadiansToDegrees (sAngle.GetAzimuth ());
+      clusterAoa[cIndex] = clusterAoa[cIndex] * Xn + (rv.m_normalRv->GetValue () * ASA / 7) + RadiansToDegrees (uAngle.GetAzimuth ());        //(7.5-11)
+      clusterAod[cIndex] = clusterAod[cIndex] * Xn + (rv.m_normalRv->GetValue () * ASD / 7) + RadiansToDegrees (sAngle.GetAzimuth ());
       if (o2i)
         {
-          clusterZoa[cIndex] = clusterZoa[cIndex] * Xn + (m_normalRv->GetValue () * ZSA / 7) + 90;            //(7.5-16)
+          clusterZoa[cIndex] = clusterZoa[cIndex] * Xn + (rv.m_normalRv->GetValue () * ZSA / 7) + 90;            //(7.5-16)
         }
       else
         {
-          clusterZoa[cIndex] = clusterZoa[cIndex] * Xn + (m_normalRv->GetValue () * ZSA / 7) + RadiansToDegrees (uAngle.GetInclination ());            //(7.5-16)
+          clusterZoa[cIndex] = clusterZoa[cIndex] * Xn + (rv.m_normalRv->GetValue () * ZSA / 7) + RadiansToDegrees (uAngle.GetInclination ());            //(7.5-16)
         }
-      clusterZod[cIndex] = clusterZod[cIndex] * Xn + (m_normalRv->GetValue () * ZSD / 7) + RadiansToDegrees (sAngle.GetInclination ()) + table3gpp->m_offsetZOD;        //(7.5-19)
+      clusterZod[cIndex] = clusterZod[cIndex] * Xn + (rv.m_normalRv->GetValue () * ZSD / 7) + RadiansToDegrees (sAngle.GetInclination ()) + table3gpp->m_offsetZOD;        //(7.5-19)
 
     }
 
@@ -1448,7 +1711,7 @@ ThreeGppChannelModel::GetNewChannel (Vector locUT, Ptr<const ChannelCondition> c
   DoubleVector attenuation_dB;
   if (m_blockage)
     {
-      attenuation_dB = CalcAttenuationOfBlockage (channelParams, clusterAoa, clusterZoa);
+      attenuation_dB = CalcAttenuationOfBlockage (channelParams, clusterAoa, clusterZoa, rv);
       for (uint8_t cInd = 0; cInd < numReducedCluster; cInd++)
         {
           clusterPower[cInd] = clusterPower[cInd] / pow (10,attenuation_dB[cInd] / 10);
@@ -1463,10 +1726,10 @@ ThreeGppChannelModel::GetNewChannel (Vector locUT, Ptr<const ChannelCondition> c
   //shuffle all the arrays to perform random coupling
   for (uint8_t cIndex = 0; cIndex < numReducedCluster; cIndex++)
     {
-      Shuffle (&rayAod_radian[cIndex][0], &rayAod_radian[cIndex][raysPerCluster]);
-      Shuffle (&rayAoa_radian[cIndex][0], &rayAoa_radian[cIndex][raysPerCluster]);
-      Shuffle (&rayZod_radian[cIndex][0], &rayZod_radian[cIndex][raysPerCluster]);
-      Shuffle (&rayZoa_radian[cIndex][0], &rayZoa_radian[cIndex][raysPerCluster]);
+      Shuffle (&rayAod_radian[cIndex][0], &rayAod_radian[cIndex][raysPerCluster], rv);
+      Shuffle (&rayAoa_radian[cIndex][0], &rayAoa_radian[cIndex][raysPerCluster], rv);
+      Shuffle (&rayZod_radian[cIndex][0], &rayZod_radian[cIndex][raysPerCluster], rv);
+      Shuffle (&rayZoa_radian[cIndex][0], &rayZoa_radian[cIndex][raysPerCluster], rv);
     }
 
   //Step 9: Generate the cross polarization power ratios
@@ -1482,11 +1745,11 @@ ThreeGppChannelModel::GetNewChannel (Vector locUT, Ptr<const ChannelCondition> c
           double uXprLinear = pow (10, table3gpp->m_uXpr / 10); // convert to linear
           double sigXprLinear = pow (10, table3gpp->m_sigXpr / 10); // convert to linear
 
-          temp.push_back (std::pow (10, (m_normalRv->GetValue () * sigXprLinear + uXprLinear) / 10));
+          temp.push_back (std::pow (10, (rv.m_normalRv->GetValue () * sigXprLinear + uXprLinear) / 10));
           DoubleVector temp3; // used to store the PHI valuse
           for (uint8_t pInd = 0; pInd < 4; pInd++)
             {
-              temp3.push_back (m_uniformRv->GetValue (-1 * M_PI, M_PI));
+              temp3.push_back (rv.m_uniformRv->GetValue (-1 * M_PI, M_PI));
             }
           temp2.push_back (temp3);
         }
@@ -1498,8 +1761,6 @@ ThreeGppChannelModel::GetNewChannel (Vector locUT, Ptr<const ChannelCondition> c
   //Step 11: Generate channel coefficients for each cluster n and each receiver
   // and transmitter element pair u,s.
 
-  Complex3DVector H_NLOS; // channel coefficients H_NLOS [u][s][n],
-  // where u and s are receive and transmit antenna element, n is cluster index.
   uint64_t uSize = uAntenna->GetNumberOfElements ();
   uint64_t sSize = sAntenna->GetNumberOfElements ();
 
@@ -1525,163 +1786,174 @@ ThreeGppChannelModel::GetNewChannel (Vector locUT, Ptr<const ChannelCondition> c
 
   NS_LOG_INFO ("1st strongest cluster:" << (int)cluster1st << ", 2nd strongest cluster:" << (int)cluster2nd);
 
-  Complex3DVector H_usn;  //channel coffecient H_usn[u][s][n];
   // NOTE Since each of the strongest 2 clusters are divided into 3 sub-clusters,
-  // the total cluster will be numReducedCLuster + 4.
+  // the total cluster will be numReducedCLuster + 4. The sub-clusters 2 and 3
+  // of the strongest cluster with the lowest index come first, as their delays
+  // and angles below.
+  uint8_t numSubClusters = (cluster1st == cluster2nd) ? 2 : 4;
+  Complex3DVector H_usn (uSize, sSize, numReducedCluster + numSubClusters); //channel coffecient H_usn[u][s][n];
+
+  // The ray terms which do not depend on the antenna elements are computed
+  // once: the field patterns and the polarization term (7.5-22, 7.5-28),
+  // multiplied by the rx phase of each u element, and the tx phase of each
+  // s element. Rays are indexed by r = nIndex * raysPerCluster + mIndex.
+  std::size_t numRays = numReducedCluster * raysPerCluster;
+  PhasedArrayModel::ComplexVector rxRays (uSize * numRays); // polarization term * rx phase, per u
+  PhasedArrayModel::ComplexVector txRays (sSize * numRays); // tx phase, per s
+  for (uint8_t nIndex = 0; nIndex < numReducedCluster; nIndex++)
+    {
+      for (uint8_t mIndex = 0; mIndex < raysPerCluster; mIndex++)
+        {
+          std::size_t rIndex = nIndex * raysPerCluster + mIndex;
+          const DoubleVector &initialPhase = clusterPhase[nIndex][mIndex];
+          double k = crossPolarizationPowerRatios[nIndex][mIndex];
 
-  H_usn.resize (uSize);
-  for (uint64_t uIndex = 0; uIndex < uSize; uIndex++)
+          double rxFieldPatternPhi, rxFieldPatternTheta, txFieldPatternPhi, txFieldPatternTheta;
+          std::tie (rxFieldPatternPhi, rxFieldPatternTheta) = uAntenna->GetElementFieldPattern (Angles (rayAoa_radian[nIndex][mIndex], rayZoa_radian[nIndex][mIndex]));
+          std::tie (txFieldPatternPhi, txFieldPatternTheta) = sAntenna->GetElementFieldPattern (Angles (rayAod_radian[nIndex][mIndex], rayZod_radian[nIndex][mIndex]));
+
+          std::complex<double> polarization = (exp (std::complex<double> (0, initialPhase[0])) * rxFieldPatternTheta * txFieldPatternTheta +
+                                               +exp (std::complex<double> (0, initialPhase[1])) * std::sqrt (1 / k) * rxFieldPatternTheta * txFieldPatternPhi +
+                                               +exp (std::complex<double> (0, initialPhase[2])) * std::sqrt (1 / k) * rxFieldPatternPhi * txFieldPatternTheta +
+                                               +exp (std::complex<double> (0, initialPhase[3])) * rxFieldPatternPhi * txFieldPatternPhi);
+
+          //lambda_0 is accounted in the antenna spacing uLoc and sLoc.
+          for (uint64_t uIndex = 0; uIndex < uSize; uIndex++)
+            {
+              Vector uLoc = uAntenna->GetElementLocation (uIndex);
+              double rxPhaseDiff = 2 * M_PI * (sin (rayZoa_radian[nIndex][mIndex]) * cos (rayAoa_radian[nIndex][mIndex]) * uLoc.x
+                                               + sin (rayZoa_radian[nIndex][mIndex]) * sin (rayAoa_radian[nIndex][mIndex]) * uLoc.y
+                                               + cos (rayZoa_radian[nIndex][mIndex]) * uLoc.z);
+              rxRays[uIndex * numRays + rIndex] = polarization * exp (std::complex<double> (0, rxPhaseDiff));
+            }
+          for (uint64_t sIndex = 0; sIndex < sSize; sIndex++)
+            {
+              Vector sLoc = sAntenna->GetElementLocation (sIndex);
+              double txPhaseDiff = 2 * M_PI * (sin (rayZod_radian[nIndex][mIndex]) * cos (rayAod_radian[nIndex][mIndex]) * sLoc.x
+                                               + sin (rayZod_radian[nIndex][mIndex]) * sin (rayAod_radian[nIndex][mIndex]) * sLoc.y
+                                               + cos (rayZod_radian[nIndex][mIndex]) * sLoc.z);
+              txRays[sIndex * numRays + rIndex] = exp (std::complex<double> (0, txPhaseDiff));
+            }
+        }
+    }
+  // NOTE Doppler is computed in the CalcBeamformingGain function and is simplified to only account for the center anngle of each cluster.
+
+  // the sub-cluster (0, 1 or 2 for 1, 2 or 3) of each ray of the strongest clusters (7.5-28)
+  std::vector<uint8_t> subCluster (raysPerCluster, 0);
+  for (uint8_t mIndex = 0; mIndex < raysPerCluster; mIndex++)
+    {
+      switch (mIndex)
+        {
+          case 9:
+          case 10:
+          case 11:
+          case 12:
+          case 17:
+          case 18:
+            subCluster[mIndex] = 1;
+            break;
+          case 13:
+          case 14:
+          case 15:
+          case 16:
+            subCluster[mIndex] = 2;
+            break;
+          default:                      //case 1,2,3,4,5,6,7,8,19,20
+            break;
+        }
+    }
+
+  // the terms of the LOS ray (7.5-29) which do not depend on both u and s
+  PhasedArrayModel::ComplexVector rxLos, txLos;
+  if (los)
     {
-      H_usn[uIndex].resize (sSize);
+      double rxFieldPatternPhi, rxFieldPatternTheta, txFieldPatternPhi, txFieldPatternTheta;
+      std::tie (rxFieldPatternPhi, rxFieldPatternTheta) = uAntenna->GetElementFieldPattern (Angles (uAngle.GetAzimuth (), uAngle.GetInclination ()));
+      std::tie (txFieldPatternPhi, txFieldPatternTheta) = sAntenna->GetElementFieldPattern (Angles (sAngle.GetAzimuth (), sAngle.GetInclination ()));
+
+      double lambda = 3e8 / m_frequency; // the wavelength of the carrier frequency
+
+      std::complex<double> ray = (rxFieldPatternTheta * txFieldPatternTheta - rxFieldPatternPhi * txFieldPatternPhi)
+        * exp (std::complex<double> (0, -2 * M_PI * dis3D / lambda));
+      for (uint64_t uIndex = 0; uIndex < uSize; uIndex++)
+        {
+          Vector uLoc = uAntenna->GetElementLocation (uIndex);
+          double rxPhaseDiff = 2 * M_PI * (sin (uAngle.GetInclination ()) * cos (uAngle.GetAzimuth ()) * uLoc.x
+                                           + sin (uAngle.GetInclination ()) * sin (uAngle.GetAzimuth ()) * uLoc.y
+                                           + cos (uAngle.GetInclination ()) * uLoc.z);
+          rxLos.push_back (ray * exp (std::complex<double> (0, rxPhaseDiff)));
+        }
       for (uint64_t sIndex = 0; sIndex < sSize; sIndex++)
         {
-          H_usn[uIndex][sIndex].resize (numReducedCluster);
+          Vector sLoc = sAntenna->GetElementLocation (sIndex);
+          double txPhaseDiff = 2 * M_PI * (sin (sAngle.GetInclination ()) * cos (sAngle.GetAzimuth ()) * sLoc.x
+                                           + sin (sAngle.GetInclination ()) * sin (sAngle.GetAzimuth ()) * sLoc.y
+                                           + cos (sAngle.GetInclination ()) * sLoc.z);
+          txLos.push_back (exp (std::complex<double> (0, txPhaseDiff)));
         }
     }
 
   // The following for loops computes the channel coefficients
+  std::vector<double> rayRe (numRays), rayIm (numRays); // the rays of a (u, s) pair
   for (uint64_t uIndex = 0; uIndex < uSize; uIndex++)
     {
-      Vector uLoc = uAntenna->GetElementLocation (uIndex);
-
+      const std::complex<double> *rx = &rxRays[uIndex * numRays];
       for (uint64_t sIndex = 0; sIndex < sSize; sIndex++)
         {
+          const std::complex<double> *tx = &txRays[sIndex * numRays];
+          // multiply the rx and tx terms of all the rays of the pair, in a
+          // loop over contiguous arrays that the compiler can vectorize
+          for (std::size_t rIndex = 0; rIndex < numRays; rIndex++)
+            {
+              double a = rx[rIndex].real (), b = rx[rIndex].imag ();
+              double c = tx[rIndex].real (), d = tx[rIndex].imag ();
+              rayRe[rIndex] = a * c - b * d;
+              rayIm[rIndex] = a * d + b * c;
+            }
 
-          Vector sLoc = sAntenna->GetElementLocation (sIndex);
-
+          std::complex<double> *H = H_usn.GetPages (uIndex, sIndex);
           for (uint8_t nIndex = 0; nIndex < numReducedCluster; nIndex++)
             {
+              std::size_t first = nIndex * raysPerCluster;
               //Compute the N-2 weakest cluster, only vertical polarization. (7.5-22)
               if (nIndex != cluster1st && nIndex != cluster2nd)
                 {
                   std::complex<double> rays (0,0);
                   for (uint8_t mIndex = 0; mIndex < raysPerCluster; mIndex++)
                     {
-                      DoubleVector initialPhase = clusterPhase[nIndex][mIndex];
-                      double k = crossPolarizationPowerRatios[nIndex][mIndex];
-                      //lambda_0 is accounted in the antenna spacing uLoc and sLoc.
-                      double rxPhaseDiff = 2 * M_PI * (sin (rayZoa_radian[nIndex][mIndex]) * cos (rayAoa_radian[nIndex][mIndex]) * uLoc.x
-                                                       + sin (rayZoa_radian[nIndex][mIndex]) * sin (rayAoa_radian[nIndex][mIndex]) * uLoc.y
-                                                       + cos (rayZoa_radian[nIndex][mIndex]) * uLoc.z);
-
-                      double txPhaseDiff = 2 * M_PI * (sin (rayZod_radian[nIndex][mIndex]) * cos (rayAod_radian[nIndex][mIndex]) * sLoc.x
-                                                       + sin (rayZod_radian[nIndex][mIndex]) * sin (rayAod_radian[nIndex][mIndex]) * sLoc.y
-                                                       + cos (rayZod_radian[nIndex][mIndex]) * sLoc.z);
-                      // NOTE Doppler is computed in the CalcBeamformingGain function and is simplified to only account for the center anngle of each cluster.
-
-                      double rxFieldPatternPhi, rxFieldPatternTheta, txFieldPatternPhi, txFieldPatternTheta;
-                      std::tie (rxFieldPatternPhi, rxFieldPatternTheta) = uAntenna->GetElementFieldPattern (Angles (rayAoa_radian[nIndex][mIndex], rayZoa_radian[nIndex][mIndex]));
-                      std::tie (txFieldPatternPhi, txFieldPatternTheta) = sAntenna->GetElementFieldPattern (Angles (rayAod_radian[nIndex][mIndex], rayZod_radian[nIndex][mIndex]));
-
-                      rays += (exp (std::complex<double> (0, initialPhase[0])) * rxFieldPatternTheta * txFieldPatternTheta +
-                               +exp (std::complex<double> (0, initialPhase[1])) * std::sqrt (1 / k) * rxFieldPatternTheta * txFieldPatternPhi +
-                               +exp (std::complex<double> (0, initialPhase[2])) * std::sqrt (1 / k) * rxFieldPatternPhi * txFieldPatternTheta +
-                               +exp (std::complex<double> (0, initialPhase[3])) * rxFieldPatternPhi * txFieldPatternPhi)
-                        * exp (std::complex<double> (0, rxPhaseDiff))
-                        * exp (std::complex<double> (0, txPhaseDiff));
+                      rays += std::complex<double> (rayRe[first + mIndex], rayIm[first + mIndex]);
                     }
                   rays *= sqrt (clusterPower[nIndex] / raysPerCluster);
-                  H_usn[uIndex][sIndex][nIndex] = rays;
+                  H[nIndex] = rays;
                 }
               else  //(7.5-28)
                 {
-                  std::complex<double> raysSub1 (0,0);
-                  std::complex<double> raysSub2 (0,0);
-                  std::complex<double> raysSub3 (0,0);
-
+                  std::complex<double> raysSub[3] = {0, 0, 0};
                   for (uint8_t mIndex = 0; mIndex < raysPerCluster; mIndex++)
                     {
-                      double k = crossPolarizationPowerRatios[nIndex][mIndex];
-
-                      //ZML:Just remind me that the angle offsets for the 3 subclusters were not generated correctly.
-
-                      DoubleVector initialPhase = clusterPhase[nIndex][mIndex];
-                      double rxPhaseDiff = 2 * M_PI * (sin (rayZoa_radian[nIndex][mIndex]) * cos (rayAoa_radian[nIndex][mIndex]) * uLoc.x
-                                                       + sin (rayZoa_radian[nIndex][mIndex]) * sin (rayAoa_radian[nIndex][mIndex]) * uLoc.y
-                                                       + cos (rayZoa_radian[nIndex][mIndex]) * uLoc.z);
-                      double txPhaseDiff = 2 * M_PI * (sin (rayZod_radian[nIndex][mIndex]) * cos (rayAod_radian[nIndex][mIndex]) * sLoc.x
-                                                       + sin (rayZod_radian[nIndex][mIndex]) * sin (rayAod_radian[nIndex][mIndex]) * sLoc.y
-                                                       + cos (rayZod_radian[nIndex][mIndex]) * sLoc.z);
-
-                      double rxFieldPatternPhi, rxFieldPatternTheta, txFieldPatternPhi, txFieldPatternTheta;
-                      std::tie (rxFieldPatternPhi, rxFieldPatternTheta) = uAntenna->GetElementFieldPattern (Angles (rayAoa_radian[nIndex][mIndex], rayZoa_radian[nIndex][mIndex]));
-                      std::tie (txFieldPatternPhi, txFieldPatternTheta) = sAntenna->GetElementFieldPattern (Angles (rayAod_radian[nIndex][mIndex], rayZod_radian[nIndex][mIndex]));
-
-                      switch (mIndex)
-                        {
-                          case 9:
-                          case 10:
-                          case 11:
-                          case 12:
-                          case 17:
-                          case 18:
-                            raysSub2 += (exp (std::complex<double> (0, initialPhase[0])) * rxFieldPatternTheta * txFieldPatternTheta +
-                                         +exp (std::complex<double> (0, initialPhase[1])) * std::sqrt (1 / k) * rxFieldPatternTheta * txFieldPatternPhi +
-                                         +exp (std::complex<double> (0, initialPhase[2])) * std::sqrt (1 / k) * rxFieldPatternPhi * txFieldPatternTheta +
-                                         +exp (std::complex<double> (0, initialPhase[3])) * rxFieldPatternPhi * txFieldPatternPhi)
-                              * exp (std::complex<double> (0, rxPhaseDiff))
-                              * exp (std::complex<double> (0, txPhaseDiff));
-                            break;
-                          case 13:
-                          case 14:
-                          case 15:
-                          case 16:
-                            raysSub3 += (exp (std::complex<double> (0, initialPhase[0])) * rxFieldPatternTheta * txFieldPatternTheta +
-                                         +exp (std::complex<double> (0, initialPhase[1])) * std::sqrt (1 / k) * rxFieldPatternTheta * txFieldPatternPhi +
-                                         +exp (std::complex<double> (0, initialPhase[2])) * std::sqrt (1 / k) * rxFieldPatternPhi * txFieldPatternTheta +
-                                         +exp (std::complex<double> (0, initialPhase[3])) * rxFieldPatternPhi * txFieldPatternPhi)
-                              * exp (std::complex<double> (0, rxPhaseDiff))
-                              * exp (std::complex<double> (0, txPhaseDiff));
-                            break;
-                          default:                      //case 1,2,3,4,5,6,7,8,19,20
-                            raysSub1 += (exp (std::complex<double> (0, initialPhase[0])) * rxFieldPatternTheta * txFieldPatternTheta +
-                                         +exp (std::complex<double> (0, initialPhase[1])) * std::sqrt (1 / k) * rxFieldPatternTheta * txFieldPatternPhi +
-                                         +exp (std::complex<double> (0, initialPhase[2])) * std::sqrt (1 / k) * rxFieldPatternPhi * txFieldPatternTheta +
-                                         +exp (std::complex<double> (0, initialPhase[3])) * rxFieldPatternPhi * txFieldPatternPhi)
-                              * exp (std::complex<double> (0, rxPhaseDiff))
-                              * exp (std::complex<double> (0, txPhaseDiff));
-                            break;
-                        }
+                      raysSub[subCluster[mIndex]] += std::complex<double> (rayRe[first + mIndex], rayIm[first + mIndex]);
                     }
-                  raysSub1 *= sqrt (clusterPower[nIndex] / raysPerCluster);
-                  raysSub2 *= sqrt (clusterPower[nIndex] / raysPerCluster);
-                  raysSub3 *= sqrt (clusterPower[nIndex] / raysPerCluster);
-                  H_usn[uIndex][sIndex][nIndex] = raysSub1;
-                  H_usn[uIndex][sIndex].push_back (raysSub2);
-                  H_usn[uIndex][sIndex].push_back (raysSub3);
-
+                  uint8_t subClusterIndex = numReducedCluster;
+                  if (cluster1st != cluster2nd && nIndex == std::max (cluster1st, cluster2nd))
+                    {
+                      subClusterIndex += 2;
+                    }
+                  H[nIndex] = raysSub[0] * sqrt (clusterPower[nIndex] / raysPerCluster);
+                  H[subClusterIndex] = raysSub[1] * sqrt (clusterPower[nIndex] / raysPerCluster);
+                  H[subClusterIndex + 1] = raysSub[2] * sqrt (clusterPower[nIndex] / raysPerCluster);
                 }
             }
           if (los) //(7.5-29) && (7.5-30)
             {
-              std::complex<double> ray (0,0);
-              double rxPhaseDiff = 2 * M_PI * (sin (uAngle.GetInclination ()) * cos (uAngle.GetAzimuth ()) * uLoc.x
-                                               + sin (uAngle.GetInclination ()) * sin (uAngle.GetAzimuth ()) * uLoc.y
-                                               + cos (uAngle.GetInclination ()) * uLoc.z);
-              double txPhaseDiff = 2 * M_PI * (sin (sAngle.GetInclination ()) * cos (sAngle.GetAzimuth ()) * sLoc.x
-                                               + sin (sAngle.GetInclination ()) * sin (sAngle.GetAzimuth ()) * sLoc.y
-                                               + cos (sAngle.GetInclination ()) * sLoc.z);
-
-              double rxFieldPatternPhi, rxFieldPatternTheta, txFieldPatternPhi, txFieldPatternTheta;
-              std::tie (rxFieldPatternPhi, rxFieldPatternTheta) = uAntenna->GetElementFieldPattern (Angles (uAngle.GetAzimuth (), uAngle.GetInclination ()));
-              std::tie (txFieldPatternPhi, txFieldPatternTheta) = sAntenna->GetElementFieldPattern (Angles (sAngle.GetAzimuth (), sAngle.GetInclination ()));
-
-              double lambda = 3e8 / m_frequency; // the wavelength of the carrier frequency
-
-              ray = (rxFieldPatternTheta * txFieldPatternTheta - rxFieldPatternPhi * txFieldPatternPhi)
-                * exp (std::complex<double> (0, -2 * M_PI * dis3D / lambda))
-                * exp (std::complex<double> (0, rxPhaseDiff))
-                * exp (std::complex<double> (0, txPhaseDiff));
+              std::complex<double> ray = rxLos[uIndex] * txLos[sIndex];
 
               double K_linear = pow (10,K_factor / 10);
               // the LOS path should be attenuated if blockage is enabled.
-              H_usn[uIndex][sIndex][0] = sqrt (1 / (K_linear + 1)) * H_usn[uIndex][sIndex][0] + sqrt (K_linear / (1 + K_linear)) * ray / pow (10,attenuation_dB[0] / 10);           //(7.5-30) for tau = tau1
-              double tempSize = H_usn[uIndex][sIndex].size ();
-              for (uint8_t nIndex = 1; nIndex < tempSize; nIndex++)
+              H[0] = sqrt (1 / (K_linear + 1)) * H[0] + sqrt (K_linear / (1 + K_linear)) * ray / pow (10,attenuation_dB[0] / 10);           //(7.5-30) for tau = tau1
+              for (std::size_t nIndex = 1; nIndex < H_usn.GetNumPages (); nIndex++)
                 {
-                  H_usn[uIndex][sIndex][nIndex] *= sqrt (1 / (K_linear + 1)); //(7.5-30) for tau = tau2...taunN
+                  H[nIndex] *= sqrt (1 / (K_linear + 1)); //(7.5-30) for tau = tau2...taunN
                 }
-
             }
         }
     }
@@ -1745,7 +2017,7 @@ ThreeGppChannelModel::GetNewChannel (Vector locUT, Ptr<const ChannelCondition> c
 
     }
 
-  NS_LOG_INFO ("size of coefficient matrix =[" << H_usn.size () << "][" << H_usn[0].size () << "][" << H_usn[0][0].size () << "]");
+  NS_LOG_INFO ("size of coefficient matrix =[" << H_usn.GetNumRows () << "][" << H_usn.GetNumCols () << "][" << H_usn.GetNumPages () << "]");
 
   channelParams->m_channel = H_usn;
   channelParams->m_delay = clusterDelay;
@@ -1783,7 +2055,8 @@ ThreeGppChannelModel::WrapAngles (double azimuthRad, double inclinationRad)
 MatrixBasedChannelModel::DoubleVector
 ThreeGppChannelModel::CalcAttenuationOfBlockage (Ptr<ThreeGppChannelModel::ThreeGppChannelMatrix> params,
                                                  const DoubleVector &clusterAOA,
-                                                 const DoubleVector &clusterZOA) const
+                                                 const DoubleVector &clusterZOA,
+                                                 const RandomVariables &rv) const
 {
   NS_LOG_FUNCTION (this);
 
@@ -1821,17 +2094,17 @@ ThreeGppChannelModel::CalcAttenuationOfBlockage (Ptr<ThreeGppChannelModel::Three
         {
           //draw value from table 7.6.4.1-2 Blocking region parameters
           DoubleVector table;
-          table.push_back (m_normalRv->GetValue ()); //phi_k: store the normal RV that will be mapped to uniform (0,360) later.
+          table.push_back (rv.m_normalRv->GetValue ()); //phi_k: store the normal RV that will be mapped to uniform (0,360) later.
           if (m_scenario == "InH-OfficeMixed" || m_scenario == "InH-OfficeOpen")
             {
-              table.push_back (m_uniformRv->GetValue (15, 45)); //x_k
+              table.push_back (rv.m_uniformRv->GetValue (15, 45)); //x_k
               table.push_back (90);  //Theta_k
-              table.push_back (m_uniformRv->GetValue (5, 15)); //y_k
+              table.push_back (rv.m_uniformRv->GetValue (5, 15)); //y_k
               table.push_back (2);  //r
             }
           else
             {
-              table.push_back (m_uniformRv->GetValue (5, 15)); //x_k
+              table.push_back (rv.m_uniformRv->GetValue (5, 15)); //x_k
               table.push_back (90);  //Theta_k
               table.push_back (5);  //y_k
               table.push_back (10);  //r
@@ -1894,7 +2167,7 @@ ThreeGppChannelModel::CalcAttenuationOfBlockage (Ptr<ThreeGppChannelModel::Three
 
               //Generate a new correlated normal RV with the following formula
               params->m_nonSelfBlocking[blockInd][PHI_INDEX] =
-                R * params->m_nonSelfBlocking[blockInd][PHI_INDEX] + sqrt (1 - R * R) * m_normalRv->GetValue ();
+                R * params->m_nonSelfBlocking[blockInd][PHI_INDEX] + sqrt (1 - R * R) * rv.m_normalRv->GetValue ();
             }
         }
 
@@ -2002,11 +2275,11 @@ ThreeGppChannelModel::CalcAttenuationOfBlockage (Ptr<ThreeGppChannelModel::Three
 
 
 void
-ThreeGppChannelModel::Shuffle (double * first, double * last) const
+ThreeGppChannelModel::Shuffle (double * first, double * last, const RandomVariables &rv) const
 {
   for (auto i = (last - first) - 1; i > 0; --i)
     {
-      std::swap (first[i], first[m_uniformRvShuffle->GetInteger (0, i)]);
+      std::swap (first[i], first[rv.m_uniformRvShuffle->GetInteger (0, i)]);
     }
 }
 
@@ -2014,9 +2287,9 @@ int64_t
 ThreeGppChannelModel::AssignStreams (int64_t stream)
 {
   NS_LOG_FUNCTION (this << stream);
-  m_normalRv->SetStream (stream);
-  m_uniformRv->SetStream (stream + 1);
-  m_uniformRvShuffle->SetStream (stream + 2);
+  m_randomVariables->m_normalRv->SetStream (stream);
+  m_randomVariables->m_uniformRv->SetStream (stream + 1);
+  m_randomVariables->m_uniformRvShuffle->SetStream (stream + 2);
   return 3;
 }
 
@@ -28,9 +28,17 @@
 #include <ns3/nstime.h>
 #include <ns3/random-variable-stream.h>
 #include <ns3/boolean.h>
+#include <ns3/event-id.h>
+#include <list>
 #include <unordered_map>
 #include <ns3/channel-condition-model.h>
 #include <ns3/matrix-based-channel-model.h>
+#include "ns3/core-config.h"
+#ifdef HAVE_PTHREAD_H
+#include <ns3/system-condition.h>
+#include <ns3/system-mutex.h>
+#include <ns3/system-thread.h>
+#endif
 
 namespace ns3 {
 
@@ -109,6 +117,12 @@ public:
    * be updated, it generates a new uncorrelated channel matrix using the
    * method GetNewChannel and updates m_channelMap.
    *
+   * If the realization of the next update period was pre-generated by a
+   * worker thread (see the PregenerationThreads attribute), it is adopted
+   * instead of generating a new one, provided that the channel condition
+   * did not change meanwhile. If the map holds more than MaxChannels
+   * channels, the least recently used ones are evicted.
+   *
    * \param aMob mobility model of the a device
    * \param bMob mobility model of the b device
    * \param aAntenna antenna of the a device
@@ -123,12 +137,19 @@ public:
    * \brief Assign a fixed random variable stream number to the random variables
    * used by this model.
    *
+   * The random variables of the pairs of nodes, used when the pre-generation
+   * is enabled, are not covered by this method: they are created, and their
+   * stream numbers automatically assigned, in the order in which the pairs
+   * are first requested.
+   *
    * \param stream first stream index to use
    * \return the number of stream indices assigned by this model
    */
   int64_t AssignStreams (int64_t stream);
   
 private:
+  struct RandomVariables;
+
   /**
    * Wrap an (azimuth, inclination) angle pair in a valid range.
    * Specifically, inclination must be in [0, M_PI] and azimuth in [0, 2*M_PI).
@@ -147,8 +168,9 @@ private:
    * \brief Shuffle the elements of a simple sequence container of type double
    * \param first Pointer to the first element among the elements to be shuffled
    * \param last Pointer to the last element among the elements to be shuffled
+   * \param rv the random variables to draw from
    */
-  void Shuffle (double * first, double * last) const;
+  void Shuffle (double * first, double * last, const RandomVariables &rv) const;
   /**
    * Extends the struct ChannelMatrix by including information that are used 
    * within the class ThreeGppChannelModel
@@ -173,6 +195,69 @@ private:
     double m_dis3D; //!< 3D distance between tx and rx
   };
 
+  /**
+   * The random variables used to generate the channel realizations, either
+   * those of the model or those of a pair of nodes
+   */
+  struct RandomVariables : public SimpleRefCount<RandomVariables>
+  {
+    Ptr<UniformRandomVariable> m_uniformRv; //!< uniform random variable
+    Ptr<NormalRandomVariable> m_normalRv; //!< normal random variable
+    Ptr<UniformRandomVariable> m_uniformRvShuffle; //!< uniform random variable used to shuffle array in GetNewChannel
+  };
+
+  /**
+   * The inputs and the result of the generation of a channel realization.
+   * The worker threads only access the objects referenced by a job through
+   * const references, since the reference counts are not thread safe: the
+   * main thread creates and releases these references.
+   */
+  struct GenerationJob : public SimpleRefCount<GenerationJob>
+  {
+    /**
+     * Constructor
+     * \param uAngle the u node angle
+     * \param sAngle the s node angle
+     */
+    GenerationJob (const Angles &uAngle, const Angles &sAngle)
+      : m_uAngle (uAngle),
+        m_sAngle (sAngle)
+    {
+    }
+
+    Time m_startTime; //!< the time the job was created
+    std::pair<uint32_t, uint32_t> m_nodeIds; //!< the ids of the s and u nodes
+    Ptr<const ChannelCondition> m_channelCondition; //!< the channel condition, a private copy if run by a worker thread
+    Ptr<const PhasedArrayModel> m_sAntenna; //!< the s node antenna array
+    Ptr<const PhasedArrayModel> m_uAntenna; //!< the u node antenna array
+    Angles m_uAngle; //!< the u node angle
+    Angles m_sAngle; //!< the s node angle
+    double m_dis2D; //!< the 2D distance between tx and rx
+    double m_hBs; //!< the height of the BS
+    double m_hUt; //!< the height of the UT
+    Ptr<const RandomVariables> m_randomVariables; //!< the random variables of the pair
+    Ptr<ThreeGppChannelMatrix> m_channel; //!< the realization, set by the thread running the job
+    bool m_started; //!< true if a thread took the job, protected by m_poolMutex
+    bool m_done; //!< true if m_channel is set, protected by m_poolMutex
+  };
+
+  /**
+   * An entry of the channel map
+   */
+  struct ChannelEntry
+  {
+    Ptr<ThreeGppChannelMatrix> m_channel; //!< the channel realization
+    std::list<uint32_t>::iterator m_lruIt; //!< the position of the entry in m_lruList
+    Time m_lastAccess; //!< the time of the last request of the channel
+    Ptr<const MobilityModel> m_aMob; //!< mobility model of the a device in the last request
+    Ptr<const MobilityModel> m_bMob; //!< mobility model of the b device in the last request
+    Ptr<const PhasedArrayModel> m_aAntenna; //!< antenna of the a device in the last request
+    Ptr<const PhasedArrayModel> m_bAntenna; //!< antenna of the b device in the last request
+    Ptr<RandomVariables> m_randomVariables; //!< the random variables of the pair, if the pre-generation is enabled
+    Ptr<GenerationJob> m_job; //!< the pre-generation of the next realization, if any
+    EventId m_pregenerationEvent; //!< the event starting the pre-generation
+  };
+
   /**
    * Data structure that stores the parameters of 3GPP TR 38.901, Table 7.5-6,
    * for a certain scenario
@@ -228,24 +313,28 @@ private:
    * \param dis2D the 2D distance between tx and rx
    * \param hBS the height of the BS
    * \param hUT the height of the UT
-   * \return the channel realization
+   * \param rv the random variables to draw from
+   * \return the channel realization, without the generation time
    */
   Ptr<ThreeGppChannelMatrix> GetNewChannel (Vector locUT, Ptr<const ChannelCondition> channelCondition,
-                                            Ptr<const PhasedArrayModel> sAntenna,
-                                            Ptr<const PhasedArrayModel> uAntenna,
+                                            const Ptr<const PhasedArrayModel> &sAntenna,
+                                            const Ptr<const PhasedArrayModel> &uAntenna,
                                             Angles &uAngle, Angles &sAngle,
-                                            double dis2D, double hBS, double hUT) const;
+                                            double dis2D, double hBS, double hUT,
+                                            const RandomVariables &rv) const;
 
   /**
    * Applies the blockage model A described in 3GPP TR 38.901
    * \param params the channel matrix
    * \param clusterAOA vector containing the azimuth angle of arrival for each cluster
    * \param clusterZOA vector containing the zenith angle of arrival for each cluster
+   * \param rv the random variables to draw from
    * \return vector containing the power attenuation for each cluster
    */
   DoubleVector CalcAttenuationOfBlockage (Ptr<ThreeGppChannelMatrix> params,
                                           const DoubleVector &clusterAOA,
-                                          const DoubleVector &clusterZOA) const;
+                                          const DoubleVector &clusterZOA,
+                                          const RandomVariables &rv) const;
 
   /**
    * Check if the channel matrix has to be updated
@@ -255,14 +344,89 @@ private:
    */
   bool ChannelMatrixNeedsUpdate (Ptr<const ThreeGppChannelMatrix> channelMatrix, Ptr<const ChannelCondition> channelCondition) const;
 
-  std::unordered_map<uint32_t, Ptr<ThreeGppChannelMatrix> > m_channelMap; //!< map containing the channel realizations
+  /**
+   * Create the random variables used to generate the channel realizations
+   * \return the random variables
+   */
+  static Ptr<RandomVariables> CreateRandomVariables (void);
+
+  /**
+   * Prepare the generation of a new channel realization between two devices
+   * \param aMob mobility model of the a device
+   * \param bMob mobility model of the b device
+   * \param aAntenna antenna of the a device
+   * \param bAntenna antenna of the b device
+   * \param condition the channel condition
+   * \param rv the random variables to draw from
+   * \return the generation job
+   */
+  Ptr<GenerationJob> CreateGenerationJob (Ptr<const MobilityModel> aMob,
+                                          Ptr<const MobilityModel> bMob,
+                                          Ptr<const PhasedArrayModel> aAntenna,
+                                          Ptr<const PhasedArrayModel> bAntenna,
+                                          Ptr<const ChannelCondition> condition,
+                                          Ptr<const RandomVariables> rv) const;
+
+  /**
+   * Run a generation job, setting its channel realization
+   * \param job the job
+   */
+  void RunGenerationJob (GenerationJob &job) const;
+
+  /**
+   * Wait for a queued generation job to be done, running it in the calling
+   * thread if no worker thread took it yet
+   * \param job the job
+   */
+  void CompleteGenerationJob (GenerationJob &job);
+
+  /**
+   * Schedule the pre-generation of the realization following the current
+   * one of a pair, if the pre-generation is enabled
+   * \param channelId the key of the pair
+   * \param entry the entry of the pair
+   */
+  void SchedulePregeneration (uint32_t channelId, ChannelEntry &entry);
+
+  /**
+   * Queue the pre-generation of the next realization of a pair, if the
+   * pair was requested since its current realization was generated
+   * \param channelId the key of the pair
+   */
+  void StartPregeneration (uint32_t channelId);
+
+  /**
+   * Remove the least recently used entries of the channel map until it holds
+   * at most m_maxChannels entries
+   */
+  void EvictChannels (void);
+
+#ifdef HAVE_PTHREAD_H
+  /**
+   * The main loop of the worker threads
+   */
+  void PregenerationWorker (void);
+#endif
+
+  std::unordered_map<uint32_t, ChannelEntry> m_channelMap; //!< map containing the channel realizations
+  std::list<uint32_t> m_lruList; //!< the keys of m_channelMap, most recently used first
+  uint32_t m_maxChannels; //!< the maximum number of channels in m_channelMap, 0 if unbounded
+  uint32_t m_pregenerationThreads; //!< the number of worker threads pre-generating channels, 0 to disable
+  Time m_pregenerationLead; //!< the time before expiration when the pre-generation starts
   Time m_updatePeriod; //!< the channel update period
   double m_frequency; //!< the operating frequency
   std::string m_scenario; //!< the 3GPP scenario
   Ptr<ChannelConditionModel> m_channelConditionModel; //!< the channel condition model
-  Ptr<UniformRandomVariable> m_uniformRv; //!< uniform random variable
-  Ptr<NormalRandomVariable> m_normalRv; //!< normal random variable
-  Ptr<UniformRandomVariable> m_uniformRvShuffle; //!< uniform random variable used to shuffle array in GetNewChannel
+  Ptr<RandomVariables> m_randomVariables; //!< the random variables of the model
+
+#ifdef HAVE_PTHREAD_H
+  std::vector<Ptr<SystemThread> > m_poolThreads; //!< the worker threads
+  std::list<GenerationJob *> m_poolQueue; //!< the jobs waiting for a worker thread
+  bool m_poolStop; //!< true when the worker threads have to exit
+  SystemMutex m_poolMutex; //!< protects m_poolQueue, m_poolStop and the job states
+  SystemCondition m_poolWork; //!< signaled when a job is queued
+  SystemCondition m_poolDone; //!< signaled when a job is done
+#endif
 
   // parameters for the blockage model
   bool m_blockage; //!< enables the blockage model A
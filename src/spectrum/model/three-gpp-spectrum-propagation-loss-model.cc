@@ -30,6 +30,7 @@
 #include "ns3/string.h"
 #include "ns3/simulator.h"
 #include "ns3/pointer.h"
+#include <algorithm>
 #include <map>
 
 namespace ns3 {
@@ -134,22 +135,42 @@ ThreeGppSpectrumPropagationLossModel::CalcLongTerm (Ptr<const MatrixBasedChannel
   NS_LOG_DEBUG ("CalcLongTerm with sAntenna " << sAntenna << " uAntenna " << uAntenna);
   //store the long term part to reduce computation load
   //only the small scale fading needs to be updated if the large scale parameters and antenna weights remain unchanged.
-  PhasedArrayModel::ComplexVector longTerm;
-  uint8_t numCluster = static_cast<uint8_t> (params->m_channel[0][0].size ());
-
-  for (uint8_t cIndex = 0; cIndex < numCluster; cIndex++)
+  const MatrixBasedChannelModel::Complex3DVector &channel = params->m_channel;
+  std::size_t numCluster = channel.GetNumPages ();
+
+  // For each s, rxSum[n] = sum over u of uW[u] * H[u][s][n] and txSum[n] += sW[s] * rxSum[n].
+  // The clusters of an element of H are contiguous, so the inner loops
+  // run over contiguous arrays and can be vectorized.
+  std::vector<double> rxSumRe (numCluster), rxSumIm (numCluster);
+  std::vector<double> txSumRe (numCluster, 0), txSumIm (numCluster, 0);
+  for (uint16_t sIndex = 0; sIndex < sAntenna; sIndex++)
     {
-      std::complex<double> txSum (0,0);
-      for (uint16_t sIndex = 0; sIndex < sAntenna; sIndex++)
+      std::fill (rxSumRe.begin (), rxSumRe.end (), 0);
+      std::fill (rxSumIm.begin (), rxSumIm.end (), 0);
+      for (uint16_t uIndex = 0; uIndex < uAntenna; uIndex++)
         {
-          std::complex<double> rxSum (0,0);
-          for (uint16_t uIndex = 0; uIndex < uAntenna; uIndex++)
+          double wRe = uW[uIndex].real ();
+          double wIm = uW[uIndex].imag ();
+          const std::complex<double> *h = channel.GetPages (uIndex, sIndex);
+          for (std::size_t cIndex = 0; cIndex < numCluster; cIndex++)
             {
-              rxSum = rxSum + uW[uIndex] * params->m_channel[uIndex][sIndex][cIndex];
+              rxSumRe[cIndex] += wRe * h[cIndex].real () - wIm * h[cIndex].imag ();
+              rxSumIm[cIndex] += wRe * h[cIndex].imag () + wIm * h[cIndex].real ();
             }
-          txSum = txSum + sW[sIndex] * rxSum;
         }
-      longTerm.push_back (txSum);
+      double wRe = sW[sIndex].real ();
+      double wIm = sW[sIndex].imag ();
+      for (std::size_t cIndex = 0; cIndex < numCluster; cIndex++)
+        {
+          txSumRe[cIndex] += wRe * rxSumRe[cIndex] - wIm * rxSumIm[cIndex];
+          txSumIm[cIndex] += wRe * rxSumIm[cIndex] + wIm * rxSumRe[cIndex];
+        }
+    }
+
+  PhasedArrayModel::ComplexVector longTerm (numCluster);
+  for (std::size_t cIndex = 0; cIndex < numCluster; cIndex++)
+    {
+      longTerm[cIndex] = std::complex<double> (txSumRe[cIndex], txSumIm[cIndex]);
     }
   return longTerm;
 }
@@ -165,7 +186,7 @@ ThreeGppSpectrumPropagationLossModel::CalcBeamformingGain (Ptr<SpectrumValue> tx
   Ptr<SpectrumValue> tempPsd = Copy<SpectrumValue> (txPsd);
 
   //channel[rx][tx][cluster]
-  uint8_t numCluster = static_cast<uint8_t> (params->m_channel[0][0].size ());
+  uint8_t numCluster = static_cast<uint8_t> (params->m_channel.GetNumPages ());
 
   // compute the doppler term
   // NOTE the update of Doppler is simplified by only taking the center angle of
@@ -205,20 +226,62 @@ ThreeGppSpectrumPropagationLossModel::CalcBeamformingGain (Ptr<SpectrumValue> tx
 
   // apply the doppler term and the propagation delay to the long term component
   // to obtain the beamforming gain
+  std::vector<double> weightRe (numCluster), weightIm (numCluster);
+  for (uint8_t cIndex = 0; cIndex < numCluster; cIndex++)
+    {
+      std::complex<double> weight = longTerm[cIndex] * doppler[cIndex];
+      weightRe[cIndex] = weight.real ();
+      weightIm[cIndex] = weight.imag ();
+    }
+
+  // The delay terms exp (-j 2 pi fsb tau_n) of two consecutive sub-bands
+  // differ by the rotation exp (-j 2 pi spacing tau_n), which is constant
+  // over evenly spaced sub-bands: the delay terms are computed exactly for
+  // the first sub-band and whenever the spacing changes, and otherwise
+  // obtained by rotating those of the previous sub-band.
+  std::vector<double> delayRe (numCluster), delayIm (numCluster);
+  std::vector<double> rotationRe (numCluster), rotationIm (numCluster);
+  double previousFsb = 0;
+  double spacing = 0;
   auto vit = tempPsd->ValuesBegin (); // psd iterator
   auto sbit = tempPsd->ConstBandsBegin(); // band iterator
   while (vit != tempPsd->ValuesEnd ())
     {
-      std::complex<double> subsbandGain (0.0,0.0);
-      if ((*vit) != 0.00)
+      double fsb = (*sbit).fc; // center frequency of the sub-band
+      if (vit == tempPsd->ValuesBegin () || std::abs (fsb - previousFsb - spacing) > 1e-9 * std::abs (spacing))
         {
-          double fsb = (*sbit).fc; // center frequency of the sub-band
+          spacing = fsb - previousFsb;
           for (uint8_t cIndex = 0; cIndex < numCluster; cIndex++)
             {
               double delay = -2 * M_PI * fsb * (params->m_delay[cIndex]);
-              subsbandGain = subsbandGain + longTerm[cIndex] * doppler[cIndex] * exp (std::complex<double> (0, delay));
+              delayRe[cIndex] = cos (delay);
+              delayIm[cIndex] = sin (delay);
+              double rotation = -2 * M_PI * spacing * (params->m_delay[cIndex]);
+              rotationRe[cIndex] = cos (rotation);
+              rotationIm[cIndex] = sin (rotation);
             }
-          *vit = (*vit) * (norm (subsbandGain));
+        }
+      else
+        {
+          for (uint8_t cIndex = 0; cIndex < numCluster; cIndex++)
+            {
+              double re = delayRe[cIndex] * rotationRe[cIndex] - delayIm[cIndex] * rotationIm[cIndex];
+              delayIm[cIndex] = delayRe[cIndex] * rotationIm[cIndex] + delayIm[cIndex] * rotationRe[cIndex];
+              delayRe[cIndex] = re;
+            }
+        }
+      previousFsb = fsb;
+
+      if ((*vit) != 0.00)
+        {
+          double gainRe = 0;
+          double gainIm = 0;
+          for (uint8_t cIndex = 0; cIndex < numCluster; cIndex++)
+            {
+              gainRe += weightRe[cIndex] * delayRe[cIndex] - weightIm[cIndex] * delayIm[cIndex];
+              gainIm += weightRe[cIndex] * delayIm[cIndex] + weightIm[cIndex] * delayRe[cIndex];
+            }
+          *vit = (*vit) * (gainRe * gainRe + gainIm * gainIm);
         }
       vit++;
       sbit++;
@@ -236,17 +299,9 @@ ThreeGppSpectrumPropagationLossModel::GetLongTerm (uint32_t aId, uint32_t bId,
 
   // check if the channel matrix was generated considering a as the s-node and
   // b as the u-node or viceversa
-  PhasedArrayModel::ComplexVector sW, uW;
-  if (!channelMatrix->IsReverse (aId, bId))
-  {
-    sW = aW;
-    uW = bW;
-  }
-  else
-  {
-    sW = bW;
-    uW = aW;
-  }
+  bool reverse = channelMatrix->IsReverse (aId, bId);
+  const PhasedArrayModel::ComplexVector &sW = reverse ? bW : aW;
+  const PhasedArrayModel::ComplexVector &uW = reverse ? aW : bW;
 
   // compute the long term key, the key is unique for each tx-rx pair
   uint32_t x1 = std::min (aId, bId);
@@ -262,10 +317,12 @@ ThreeGppSpectrumPropagationLossModel::GetLongTerm (uint32_t aId, uint32_t bId,
     NS_LOG_DEBUG ("found the long term component in the map");
     longTerm = m_longTermMap[longTermId]->m_longTerm;
 
-    // check if the channel matrix has been updated
+    // check if the channel matrix has been updated (a matrix evicted from
+    // the cache of the channel model may be regenerated at the same time,
+    // hence the comparison of the matrices rather than of their generation times)
     // or the s beam has been changed
     // or the u beam has been changed
-    update = (m_longTermMap[longTermId]->m_channel->m_generatedTime != channelMatrix->m_generatedTime
+    update = (m_longTermMap[longTermId]->m_channel != channelMatrix
               || m_longTermMap[longTermId]->m_sW != sW
               || m_longTermMap[longTermId]->m_uW != uW);
 
@@ -95,7 +95,7 @@ ThreeGppChannelMatrixComputationTest::DoComputeNorm (Ptr<ThreeGppChannelModel> c
   Ptr<const ThreeGppChannelModel::ChannelMatrix> channelMatrix = channelModel->GetChannel (txMob, rxMob, txAntenna, rxAntenna);
 
   double channelNorm = 0;
-  uint8_t numTotClusters = channelMatrix->m_channel.at (0).at (0).size ();
+  uint8_t numTotClusters = channelMatrix->m_channel.GetNumPages ();
   for (uint8_t cIndex = 0; cIndex < numTotClusters; cIndex++)
   {
     double clusterNorm = 0;
@@ -103,7 +103,7 @@ ThreeGppChannelMatrixComputationTest::DoComputeNorm (Ptr<ThreeGppChannelModel> c
     {
       for (uint32_t uIndex = 0; uIndex < rxAntennaElements; uIndex++)
       {
-        clusterNorm += std::pow (std::abs (channelMatrix->m_channel.at (uIndex).at (sIndex).at (cIndex)), 2);
+        clusterNorm += std::pow (std::abs (channelMatrix->m_channel (uIndex, sIndex, cIndex)), 2);
       }
     }
     channelNorm += clusterNorm;
@@ -165,8 +165,8 @@ ThreeGppChannelMatrixComputationTest::DoRun (void)
   Ptr<const ThreeGppChannelModel::ChannelMatrix> channelMatrix = channelModel->GetChannel (txMob, rxMob, txAntenna, rxAntenna);
 
   // check the channel matrix dimensions
-  NS_TEST_ASSERT_MSG_EQ (channelMatrix->m_channel.at (0).size (), txAntennaElements [0] * txAntennaElements [1], "The second dimension of H should be equal to the number of tx antenna elements");
-  NS_TEST_ASSERT_MSG_EQ (channelMatrix->m_channel.size (), rxAntennaElements [0] * rxAntennaElements [1], "The first dimension of H should be equal to the number of rx antenna elements");
+  NS_TEST_ASSERT_MSG_EQ (channelMatrix->m_channel.GetNumCols (), txAntennaElements [0] * txAntennaElements [1], "The second dimension of H should be equal to the number of tx antenna elements");
+  NS_TEST_ASSERT_MSG_EQ (channelMatrix->m_channel.GetNumRows (), rxAntennaElements [0] * rxAntennaElements [1], "The first dimension of H should be equal to the number of rx antenna elements");
 
   // test if the channel matrix is correctly generated
   uint16_t numIt = 1000;
@@ -345,6 +345,125 @@ ThreeGppChannelMatrixUpdateTest::DoRun (void)
   Simulator::Destroy ();
 }
 
+/**
+ * Test case for the ThreeGppChannelModel class.
+ * It checks that, with the MaxChannels attribute, the least recently used
+ * channel realizations are evicted, and that the realizations pre-generated
+ * by the worker threads (PregenerationThreads attribute) replace the
+ * expired ones.
+ */
+class ThreeGppChannelMatrixCacheTest : public TestCase
+{
+public:
+  /**
+   * Constructor
+   */
+  ThreeGppChannelMatrixCacheTest ();
+
+  /**
+   * Destructor
+   */
+  virtual ~ThreeGppChannelMatrixCacheTest ();
+
+private:
+  /**
+   * Build the test scenario
+   */
+  virtual void DoRun (void);
+
+  /**
+   * Get the channel matrix between two nodes and check if it was updated
+   * since the previous call for the same pair
+   * \param a the index of the first node
+   * \param b the index of the second node
+   * \param update whether if the channel matrix should be updated or not
+   */
+  void DoGetChannel (uint32_t a, uint32_t b, bool update);
+
+  Ptr<ThreeGppChannelModel> m_channelModel; //!< the channel model
+  std::vector<Ptr<MobilityModel> > m_mobility; //!< the mobility models of the nodes
+  std::vector<Ptr<PhasedArrayModel> > m_antennas; //!< the antennas of the nodes
+  std::map<std::pair<uint32_t, uint32_t>, Ptr<const ThreeGppChannelModel::ChannelMatrix> > m_channels; //!< the last channel matrix of each pair
+};
+
+ThreeGppChannelMatrixCacheTest::ThreeGppChannelMatrixCacheTest ()
+  : TestCase ("Check the eviction and the pre-generation of the channel realizations")
+{
+}
+
+ThreeGppChannelMatrixCacheTest::~ThreeGppChannelMatrixCacheTest ()
+{
+}
+
+void
+ThreeGppChannelMatrixCacheTest::DoGetChannel (uint32_t a, uint32_t b, bool update)
+{
+  Ptr<const ThreeGppChannelModel::ChannelMatrix> channelMatrix = m_channelModel->GetChannel (m_mobility[a], m_mobility[b],
+                                                                                               m_antennas[a], m_antennas[b]);
+  Ptr<const ThreeGppChannelModel::ChannelMatrix> &previous = m_channels[std::make_pair (a, b)];
+  if (previous != 0)
+    {
+      NS_TEST_ASSERT_MSG_EQ ((previous != channelMatrix), update, Simulator::Now ().GetMilliSeconds ()
+                             << " The channel matrix between " << a << " and " << b << " is not correctly updated");
+    }
+  if (update)
+    {
+      NS_TEST_ASSERT_MSG_EQ (channelMatrix->m_generatedTime, Simulator::Now (), "Wrong generation time");
+      NS_TEST_ASSERT_MSG_EQ (channelMatrix->m_channel.GetNumRows (), m_antennas[b]->GetNumberOfElements (), "Wrong number of rows");
+      NS_TEST_ASSERT_MSG_EQ (channelMatrix->m_channel.GetNumCols (), m_antennas[a]->GetNumberOfElements (), "Wrong number of columns");
+    }
+  previous = channelMatrix;
+}
+
+void
+ThreeGppChannelMatrixCacheTest::DoRun (void)
+{
+  // create the ThreeGppChannelModel object, keeping two channels at most
+  // and pre-generating them 5 ms before they expire
+  m_channelModel = CreateObject<ThreeGppChannelModel> ();
+  m_channelModel->SetAttribute ("Frequency", DoubleValue (28.0e9));
+  m_channelModel->SetAttribute ("Scenario", StringValue ("UMa"));
+  m_channelModel->SetAttribute ("ChannelConditionModel", PointerValue (CreateObject<AlwaysLosChannelConditionModel> ()));
+  m_channelModel->SetAttribute ("UpdatePeriod", TimeValue (MilliSeconds (10)));
+  m_channelModel->SetAttribute ("MaxChannels", UintegerValue (2));
+  m_channelModel->SetAttribute ("PregenerationThreads", UintegerValue (2));
+  m_channelModel->SetAttribute ("PregenerationLead", TimeValue (MilliSeconds (5)));
+
+  // create three nodes with their mobility models and antennas
+  NodeContainer nodes;
+  nodes.Create (3);
+  for (uint32_t i = 0; i < 3; i++)
+    {
+      Ptr<MobilityModel> mobility = CreateObject<ConstantPositionMobilityModel> ();
+      mobility->SetPosition (Vector (50.0 * i, 10.0 * i, i == 0 ? 25.0 : 1.6));
+      nodes.Get (i)->AggregateObject (mobility);
+      m_mobility.push_back (mobility);
+      m_antennas.push_back (CreateObjectWithAttributes<UniformPlanarArray> ("NumColumns", UintegerValue (2),
+                                                                            "NumRows", UintegerValue (i + 1),
+                                                                            "AntennaElement", PointerValue (CreateObject<IsotropicAntennaModel> ())));
+    }
+
+  // generate the channels between 0-1 and 0-2, then request them again
+  Simulator::Schedule (MilliSeconds (1), &ThreeGppChannelMatrixCacheTest::DoGetChannel, this, 0, 1, true);
+  Simulator::Schedule (MilliSeconds (1), &ThreeGppChannelMatrixCacheTest::DoGetChannel, this, 0, 2, true);
+  Simulator::Schedule (MilliSeconds (2), &ThreeGppChannelMatrixCacheTest::DoGetChannel, this, 0, 1, false);
+  Simulator::Schedule (MilliSeconds (2), &ThreeGppChannelMatrixCacheTest::DoGetChannel, this, 0, 2, false);
+
+  // the channel between 1-2 evicts the least recently used one, 0-1
+  Simulator::Schedule (MilliSeconds (3), &ThreeGppChannelMatrixCacheTest::DoGetChannel, this, 1, 2, true);
+  Simulator::Schedule (MilliSeconds (4), &ThreeGppChannelMatrixCacheTest::DoGetChannel, this, 0, 2, false);
+  Simulator::Schedule (MilliSeconds (4), &ThreeGppChannelMatrixCacheTest::DoGetChannel, this, 0, 1, true);
+
+  // the channel between 0-2, pre-generated at 6 ms, replaces the expired one
+  Simulator::Schedule (MilliSeconds (12), &ThreeGppChannelMatrixCacheTest::DoGetChannel, this, 0, 2, true);
+  Simulator::Schedule (MilliSeconds (13), &ThreeGppChannelMatrixCacheTest::DoGetChannel, this, 0, 2, false);
+
+  Simulator::Run ();
+  Simulator::Destroy ();
+  m_channelModel->Dispose ();
+  m_channelModel = 0;
+}
+
 /**
  * Test case for the ThreeGppSpectrumPropagationLossModelTest class.
  * 1) checks if the long term components for the direct and the reverse link
@@ -559,6 +678,7 @@ ThreeGppChannelTestSuite::ThreeGppChannelTestSuite ()
 {
   AddTestCase (new ThreeGppChannelMatrixComputationTest, TestCase::QUICK);
   AddTestCase (new ThreeGppChannelMatrixUpdateTest, TestCase::QUICK);
+  AddTestCase (new ThreeGppChannelMatrixCacheTest, TestCase::QUICK);
   AddTestCase (new ThreeGppSpectrumPropagationLossModelTest, TestCase::QUICK);
 }
 
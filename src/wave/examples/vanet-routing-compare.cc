@@ -49,6 +49,8 @@
  * rate of 2.048 Kbps to one of 10 other nodes,
  * selected as sink nodes. The default routing protocol is AODV
  * and the Two-Ray Ground loss model is used.
+ * With batchMobility=1, the nodes use BatchMobilityModel instead,
+ * which follows the same random waypoints without per-node events.
  * The transmit power is set to 20 dBm and the transmission range
  * for safety message packet delivery is 145 m.
  *
@@ -1212,6 +1214,7 @@ private:
   std::string m_traceFile; ///< trace file 
   std::string m_logFile; ///< log file
   uint32_t m_mobility; ///< mobility
+  bool m_batchMobility; ///< advance the RWP nodes in batch
   uint32_t m_nNodes; ///< number of nodes
   double m_TotalSimTime; ///< total sim time
   std::string m_rate; ///< rate
@@ -1276,6 +1279,7 @@ VanetRoutingExperiment::VanetRoutingExperiment ()
     m_traceFile (""),
     m_logFile ("low99-ct-unterstrass-1day.filt.7.adj.log"),
     m_mobility (1),
+    m_batchMobility (false),
     m_nNodes (156),
     m_TotalSimTime (300.01),
     m_rate ("2048bps"),
@@ -1753,7 +1757,11 @@ VanetRoutingExperiment::Run ()
   CheckThroughput ();
 
   Simulator::Stop (Seconds (m_TotalSimTime));
+  SystemWallClockMs wallClock;
+  wallClock.Start ();
   Simulator::Run ();
+  int64_t ms = wallClock.End ();
+  NS_LOG_UNCOND ("Simulated " << Simulator::GetEventCount () << " events in " << ms << " ms");
   Simulator::Destroy ();
 }
 
@@ -2065,6 +2073,7 @@ VanetRoutingExperiment::CommandSetup (int argc, char **argv)
   cmd.AddValue ("traceFile", "Ns2 movement trace file", m_traceFile);
   cmd.AddValue ("logFile", "Log file", m_logFile);
   cmd.AddValue ("mobility", "1=trace;2=RWP", m_mobility);
+  cmd.AddValue ("batchMobility", "Advance the RWP nodes in batch (BatchMobilityModel)", m_batchMobility);
   cmd.AddValue ("rate", "Rate", m_rate);
   cmd.AddValue ("phyModeB", "Phy mode 802.11b", m_phyModeB);
   cmd.AddValue ("speed", "Node speed (m/s)", m_nodeSpeed);
@@ -2190,7 +2199,7 @@ VanetRoutingExperiment::SetupAdhocMobilityNodes ()
       ssSpeed << "ns3::UniformRandomVariable[Min=0.0|Max=" << m_nodeSpeed << "]";
       std::stringstream ssPause;
       ssPause << "ns3::ConstantRandomVariable[Constant=" << m_nodePause << "]";
-      mobilityAdhoc.SetMobilityModel ("ns3::RandomWaypointMobilityModel",
+      mobilityAdhoc.SetMobilityModel (m_batchMobility ? "ns3::BatchMobilityModel" : "ns3::RandomWaypointMobilityModel",
                                       "Speed", StringValue (ssSpeed.str ()),
                                       "Pause", StringValue (ssPause.str ()),
                                       "PositionAllocator", PointerValue (taPositionAlloc));
@@ -18,9 +18,14 @@
  * Author: Mathieu Lacage <mathieu.lacage@sophia.inria.fr>
  */
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include "ns3/double.h"
 #include "error-rate-model.h"
 #include "ns3/dsss-error-rate-model.h"
 #include "wifi-tx-vector.h"
+#include "wifi-utils.h"
 
 namespace ns3 {
 
@@ -31,10 +36,46 @@ TypeId ErrorRateModel::GetTypeId (void)
   static TypeId tid = TypeId ("ns3::ErrorRateModel")
     .SetParent<Object> ()
     .SetGroupName ("Wifi")
+    .AddAttribute ("LookupTableResolution",
+                   "The SNR step, in dB, of the tables in which the chunk success rates "
+                   "are looked up. 0 disables the tables: every success rate is computed. "
+                   "The attributes of the tables must be set before the first chunk.",
+                   DoubleValue (0),
+                   MakeDoubleAccessor (&ErrorRateModel::m_tableResolution),
+                   MakeDoubleChecker<double> (0))
+    .AddAttribute ("LookupTableMinSnr",
+                   "The smallest SNR, in dB, of the lookup tables. "
+                   "The success rates at lower SNRs are computed.",
+                   DoubleValue (-10),
+                   MakeDoubleAccessor (&ErrorRateModel::m_tableMinSnr),
+                   MakeDoubleChecker<double> ())
+    .AddAttribute ("LookupTableMaxSnr",
+                   "The largest SNR, in dB, of the lookup tables. "
+                   "The success rates at higher SNRs are computed.",
+                   DoubleValue (60),
+                   MakeDoubleAccessor (&ErrorRateModel::m_tableMaxSnr),
+                   MakeDoubleChecker<double> ())
+    .AddAttribute ("LookupTableMaxError",
+                   "The largest difference between an interpolated success rate and the "
+                   "computed one, checked in the middle of each cell of the lookup tables. "
+                   "The success rates of the cells with a larger difference are computed.",
+                   DoubleValue (1e-4),
+                   MakeDoubleAccessor (&ErrorRateModel::m_tableMaxError),
+                   MakeDoubleChecker<double> (0, 1))
   ;
   return tid;
 }
 
+ErrorRateModel::ErrorRateModel ()
+  : m_tableResolution (0),
+    m_tableMinSnr (-10),
+    m_tableMaxSnr (60),
+    m_tableMaxError (1e-4),
+    m_lastTableKey (0),
+    m_lastTable (0)
+{
+}
+
 double
 ErrorRateModel::CalculateSnr (const WifiTxVector& txVector, double ber) const
 {
@@ -78,6 +119,10 @@ ErrorRateModel::GetChunkSuccessRate (WifiMode mode, const WifiTxVector& txVector
             NS_ASSERT ("undefined DSSS/HR-DSSS datarate");
         }
     }
+  else if (m_tableResolution > 0)
+    {
+      return LookupChunkSuccessRate (mode, txVector, snr, nbits, numRxAntennas, field, staId);
+    }
   else
     {
       return DoGetChunkSuccessRate (mode, txVector, snr, nbits, numRxAntennas, field, staId);
@@ -85,6 +130,92 @@ ErrorRateModel::GetChunkSuccessRate (WifiMode mode, const WifiTxVector& txVector
   return 0;
 }
 
+double
+ErrorRateModel::LookupChunkSuccessRate (WifiMode mode, const WifiTxVector& txVector, double snr, uint64_t nbits,
+                                        uint8_t numRxAntennas, WifiPpduField field, uint16_t staId) const
+{
+  double snrDb = RatioToDb (snr);
+  if (nbits == 0 || !(snrDb >= m_tableMinSnr) || snrDb >= m_tableMaxSnr)
+    {
+      return DoGetChunkSuccessRate (mode, txVector, snr, nbits, numRxAntennas, field, staId);
+    }
+  uint8_t bucket = 0;
+  while ((nbits >> (bucket + 1)) != 0)
+    {
+      ++bucket;
+    }
+  uint64_t key = (static_cast<uint64_t> (mode.GetUid ()) << 44)
+    | (static_cast<uint64_t> (txVector.GetChannelWidth ()) << 28)
+    | (static_cast<uint64_t> (txVector.GetNss (staId)) << 20)
+    | (static_cast<uint64_t> (numRxAntennas) << 12)
+    | (static_cast<uint64_t> (field) << 8)
+    | (static_cast<uint64_t> (txVector.IsLdpc ()) << 7)
+    | bucket;
+  if (m_lastTable == 0 || key != m_lastTableKey)
+    {
+      m_lastTable = &m_tables[key];
+      m_lastTableKey = key;
+    }
+  LookupTable &table = *m_lastTable;
+  if (table.cells.empty ())
+    {
+      std::size_t nCells = std::max (1.0, std::ceil ((m_tableMaxSnr - m_tableMinSnr) / m_tableResolution));
+      table.perBitLog.assign (nCells + 1, std::numeric_limits<double>::quiet_NaN ());
+      table.cells.assign (nCells, LookupTable::UNKNOWN);
+    }
+
+  double position = (snrDb - m_tableMinSnr) / m_tableResolution;
+  std::size_t cell = std::min (static_cast<std::size_t> (position), table.cells.size () - 1);
+  uint64_t smallest = static_cast<uint64_t> (1) << bucket;
+  uint64_t largest = (smallest << 1) - 1;
+  auto computeSuccessRate = [&] (double snrDb, uint64_t nbits)
+    {
+      return DoGetChunkSuccessRate (mode, txVector, DbToRatio (snrDb), nbits, numRxAntennas, field, staId);
+    };
+  if (table.cells[cell] == LookupTable::UNKNOWN)
+    {
+      for (std::size_t i = cell; i <= cell + 1; ++i)
+        {
+          if (std::isnan (table.perBitLog[i]))
+            {
+              double successRate = computeSuccessRate (m_tableMinSnr + i * m_tableResolution, smallest);
+              table.perBitLog[i] = std::log (std::max (successRate, std::numeric_limits<double>::min ())) / smallest;
+            }
+        }
+      // Check the interpolation in the middle of the cell, where it is the
+      // least accurate, and at both ends, for the extreme sizes of the
+      // bucket.  For a success rate of exp (L * n), an error e on L gives
+      // an error of about n * e * exp (L * n), which is the largest for
+      // n = -1 / L: check that size as well in the middle.
+      // A success rate which drops to zero at one end of the cell only may
+      // do so anywhere in the cell, where the interpolation cannot follow.
+      double zero = std::log (std::numeric_limits<double>::min ()) / smallest;
+      double error = ((table.perBitLog[cell] == zero) != (table.perBitLog[cell + 1] == zero)) ? 1 : 0;
+      for (double offset : {0.0, 0.5, 1.0})
+        {
+          double perBitLog = table.perBitLog[cell] + offset * (table.perBitLog[cell + 1] - table.perBitLog[cell]);
+          uint64_t sensitive = largest;
+          if (perBitLog < -1.0 / largest)
+            {
+              sensitive = std::max (smallest, static_cast<uint64_t> (-1.0 / perBitLog));
+            }
+          for (uint64_t size : {smallest, largest, (offset == 0.5) ? sensitive : smallest})
+            {
+              double successRate = computeSuccessRate (m_tableMinSnr + (cell + offset) * m_tableResolution, size);
+              error = std::max (error, std::abs (std::exp (perBitLog * size) - successRate));
+            }
+        }
+      table.cells[cell] = (error <= m_tableMaxError) ? LookupTable::TABULATED : LookupTable::COMPUTED;
+    }
+  if (table.cells[cell] == LookupTable::COMPUTED)
+    {
+      return DoGetChunkSuccessRate (mode, txVector, snr, nbits, numRxAntennas, field, staId);
+    }
+  double fraction = position - cell;
+  double perBitLog = table.perBitLog[cell] + fraction * (table.perBitLog[cell + 1] - table.perBitLog[cell]);
+  return std::exp (perBitLog * nbits);
+}
+
 bool
 ErrorRateModel::IsAwgn (void) const
 {
@@ -21,6 +21,8 @@
 #ifndef ERROR_RATE_MODEL_H
 #define ERROR_RATE_MODEL_H
 
+#include <unordered_map>
+#include <vector>
 #include "ns3/object.h"
 #include "wifi-mode.h"
 
@@ -30,6 +32,20 @@ namespace ns3 {
  * \ingroup wifi
  * \brief the interface for Wifi's error models
  *
+ * The chunk success rates of the subclasses can be looked up in tables
+ * rather than computed, see the LookupTableResolution attribute.  A
+ * table is kept for each (mode, channel width, number of spatial
+ * streams, number of RX antennas, PPDU field, LDPC, chunk size bucket),
+ * the buckets holding the chunks of 2^k to 2^(k+1) - 1 bits.  Tables
+ * are filled lazily, one cell of LookupTableResolution dB at a time:
+ * a cell stores the logarithm of the success rate of a bit at both of
+ * its ends, and is only used if the interpolation at its ends and its
+ * middle is within LookupTableMaxError of the computed success rate,
+ * for the smallest and the largest chunks of the bucket, and, in the
+ * middle, for the chunk size whose success rate is the most sensitive
+ * to an error on the logarithm, and if the success rate does not drop
+ * to zero at one end only.  Otherwise, the success rates of the cell
+ * keep being computed.
  */
 class ErrorRateModel : public Object
 {
@@ -40,6 +56,8 @@ public:
    */
   static TypeId GetTypeId (void);
 
+  ErrorRateModel ();
+
   /**
    * \param txVector a specific transmission vector including WifiMode
    * \param ber a target BER
@@ -98,6 +116,39 @@ public:
 
 
 private:
+  /**
+   * A lookup table of chunk success rates.
+   */
+  struct LookupTable
+  {
+    /// The state of a cell
+    enum CellState : uint8_t
+    {
+      UNKNOWN = 0, //!< not checked yet
+      TABULATED,   //!< interpolated from the table
+      COMPUTED     //!< computed by the subclass
+    };
+    std::vector<double> perBitLog; //!< log of the success rate of a bit at each SNR, NaN if not computed yet
+    std::vector<uint8_t> cells;    //!< state of each cell between two SNRs
+  };
+
+  /**
+   * Get the chunk success rate from the lookup tables, filling them
+   * as needed.  The arguments are those of DoGetChunkSuccessRate.
+   *
+   * \param mode the Wi-Fi mode applicable to this chunk
+   * \param txVector TXVECTOR of the overall transmission
+   * \param snr the SNR of the chunk
+   * \param nbits the number of bits in this chunk
+   * \param numRxAntennas the number of active RX antennas
+   * \param field the PPDU field to which the chunk belongs to
+   * \param staId the station ID for MU
+   *
+   * \return probability of successfully receiving the chunk
+   */
+  double LookupChunkSuccessRate (WifiMode mode, const WifiTxVector& txVector, double snr, uint64_t nbits,
+                                 uint8_t numRxAntennas, WifiPpduField field, uint16_t staId) const;
+
   /**
    * A pure virtual method that must be implemented in the subclass.
    *
@@ -113,6 +164,19 @@ private:
    */
   virtual double DoGetChunkSuccessRate (WifiMode mode, const WifiTxVector& txVector, double snr, uint64_t nbits,
                                         uint8_t numRxAntennas, WifiPpduField field, uint16_t staId) const = 0;
+
+  double m_tableResolution;  //!< SNR step of the lookup tables in dB, 0 to compute every success rate
+  double m_tableMinSnr;      //!< smallest SNR of the lookup tables in dB
+  double m_tableMaxSnr;      //!< largest SNR of the lookup tables in dB
+  double m_tableMaxError;    //!< largest error of a lookup table cell
+  /**
+   * Lookup tables, by key.  The key packs the mode UID, the channel
+   * width, the number of spatial streams, the number of RX antennas,
+   * the PPDU field, LDPC and log2 of the smallest chunk of the bucket.
+   */
+  mutable std::unordered_map<uint64_t, LookupTable> m_tables;
+  mutable uint64_t m_lastTableKey;  //!< key of the last table used
+  mutable LookupTable *m_lastTable; //!< last table used, if any
 };
 
 } //namespace ns3
@@ -211,10 +211,6 @@ void
 InterferenceHelper::RemoveBands(void)
 {
   NS_LOG_FUNCTION (this);
-  for (auto it : m_niChangesPerBand)
-    {
-      it.second.clear ();
-    }
   m_niChangesPerBand.clear();
   m_firstPowerPerBand.clear();
 }
@@ -303,7 +299,11 @@ InterferenceHelper::AppendEvent (Ptr<Event> event, bool isStartOfdmaRxing)
           m_firstPowerPerBand.find (band)->second = previousPowerStart;
         }
       auto first = AddNiChangeEvent (event->GetStartTime (), NiChange (previousPowerStart, event), band);
+      std::size_t firstIndex = first - ni_it->second.begin ();
       auto last = AddNiChangeEvent (event->GetEndTime (), NiChange (previousPowerEnd, event), band);
+      // The second insertion moved the changes: the end of the event
+      // is inserted after its start, so the index of the start holds
+      first = ni_it->second.begin () + firstIndex;
       for (auto i = first; i != last; ++i)
         {
           i->second.AddPower (it.second);
@@ -366,22 +366,24 @@ InterferenceHelper::CalculateNoiseInterferenceW (Ptr<Event> event, NiChangesPerB
   double noiseInterferenceW = firstPower_it->second;
   auto ni_it = m_niChangesPerBand.find (band);
   NS_ASSERT (ni_it != m_niChangesPerBand.end ());
-  auto it = ni_it->second.find (event->GetStartTime ());
-  for (; it != ni_it->second.end () && it->first < Simulator::Now (); ++it)
+  const NiChanges &niChanges = ni_it->second;
+  auto start = std::lower_bound (niChanges.begin (), niChanges.end (), event->GetStartTime (), &InterferenceHelper::IsBefore);
+  NS_ASSERT (start != niChanges.end () && start->first == event->GetStartTime ());
+  auto it = start;
+  for (; it != niChanges.end () && it->first < Simulator::Now (); ++it)
     {
       noiseInterferenceW = it->second.GetPower () - event->GetRxPowerW (band);
     }
-  it = ni_it->second.find (event->GetStartTime ());
-  NS_ASSERT (it != ni_it->second.end ());
-  for (; it != ni_it->second.end () && it->second.GetEvent () != event; ++it);
-  NiChanges ni;
-  ni.emplace (event->GetStartTime (), NiChange (0, event));
-  while (++it != ni_it->second.end () && it->second.GetEvent () != event)
-    {
-      ni.insert (*it);
-    }
-  ni.emplace (event->GetEndTime (), NiChange (0, event));
-  nis->insert ({band, ni});
+  for (it = start; it != niChanges.end () && it->second.GetEvent () != event; ++it);
+  NS_ASSERT (it != niChanges.end ());
+  auto end = it + 1;
+  for (; end != niChanges.end () && end->second.GetEvent () != event; ++end);
+  NiChanges &ni = (*nis)[band];
+  ni.clear ();
+  ni.reserve ((end - it) + 1);
+  ni.emplace_back (event->GetStartTime (), NiChange (0, event));
+  ni.insert (ni.end (), it + 1, end);
+  ni.emplace_back (event->GetEndTime (), NiChange (0, event));
   NS_ASSERT_MSG (noiseInterferenceW >= 0, "CalculateNoiseInterferenceW returns negative value " << noiseInterferenceW);
   return noiseInterferenceW;
 }
@@ -421,7 +423,7 @@ InterferenceHelper::CalculatePayloadPer (Ptr<const Event> event, uint16_t channe
 {
   NS_LOG_FUNCTION (this << channelWidth << band.first << band.second << staId << window.first << window.second);
   double psr = 1.0; /* Packet Success Rate */
-  auto ni_it = nis->find (band)->second;
+  const NiChanges &ni_it = nis->find (band)->second;
   auto j = ni_it.begin ();
   Time previous = j->first;
   WifiMode payloadMode = event->GetTxVector ().GetMode (staId);
@@ -471,7 +473,7 @@ InterferenceHelper::CalculatePhyHeaderSectionPsr (Ptr<const Event> event, NiChan
 {
   NS_LOG_FUNCTION (this << band.first << band.second);
   double psr = 1.0; /* Packet Success Rate */
-  auto ni_it = nis->find (band)->second;
+  const NiChanges &ni_it = nis->find (band)->second;
   auto j = ni_it.begin ();
 
   NS_ASSERT (!phyHeaderSections.empty ());
@@ -523,7 +525,7 @@ InterferenceHelper::CalculatePhyHeaderPer (Ptr<const Event> event, NiChangesPerB
                                            WifiPpduField header) const
 {
   NS_LOG_FUNCTION (this << band.first << band.second << header);
-  auto ni_it = nis->find (band)->second;
+  const NiChanges &ni_it = nis->find (band)->second;
   auto phyEntity = WifiPhy::GetStaticPhyEntity (event->GetTxVector ().GetModulationClass ());
 
   PhyEntity::PhyHeaderSections sections;
@@ -598,7 +600,7 @@ InterferenceHelper::CalculatePhyHeaderSnrPer (Ptr<Event> event, uint16_t channel
 void
 InterferenceHelper::EraseEvents (void)
 {
-  for (auto it : m_niChangesPerBand)
+  for (auto &it : m_niChangesPerBand)
     {
       it.second.clear ();
       // Always have a zero power noise event in the list
@@ -608,12 +610,24 @@ InterferenceHelper::EraseEvents (void)
   m_rxing = false;
 }
 
+bool
+InterferenceHelper::IsBefore (const NiChanges::value_type &change, Time moment)
+{
+  return change.first < moment;
+}
+
+bool
+InterferenceHelper::IsAfter (Time moment, const NiChanges::value_type &change)
+{
+  return moment < change.first;
+}
+
 InterferenceHelper::NiChanges::iterator
 InterferenceHelper::GetNextPosition (Time moment, WifiSpectrumBand band)
 {
   auto it = m_niChangesPerBand.find (band);
   NS_ASSERT (it != m_niChangesPerBand.end ());
-  return it->second.upper_bound (moment);
+  return std::upper_bound (it->second.begin (), it->second.end (), moment, &InterferenceHelper::IsAfter);
 }
 
 InterferenceHelper::NiChanges::iterator
@@ -647,7 +661,7 @@ InterferenceHelper::NotifyRxEnd (Time endTime)
   NS_LOG_FUNCTION (this << endTime);
   m_rxing = false;
   //Update m_firstPowerPerBand for frame capture
-  for (auto ni : m_niChangesPerBand)
+  for (const auto &ni : m_niChangesPerBand)
     {
       NS_ASSERT (ni.second.size () > 1);
       auto it = GetPreviousPosition (endTime, ni.first);
@@ -347,9 +347,11 @@ private:
   };
 
   /**
-   * typedef for a multimap of NiChange
+   * typedef for a vector of NiChange sorted by time; the changes at the
+   * same time are kept in insertion order, and the power of a change is
+   * the total power from its time until the next change
    */
-  typedef std::multimap<Time, NiChange> NiChanges;
+  typedef std::vector<std::pair<Time, NiChange> > NiChanges;
 
   /**
    * Map of NiChanges per band
@@ -427,6 +429,23 @@ private:
   std::map <WifiSpectrumBand, double> m_firstPowerPerBand; //!< first power of each band in watts
   bool m_rxing;                                            //!< flag whether it is in receiving state
 
+  /**
+   * Compare the time of a NiChange with a moment.
+   *
+   * \param change the NiChange
+   * \param moment the moment
+   * \returns true if the NiChange is before the moment
+   */
+  static bool IsBefore (const NiChanges::value_type &change, Time moment);
+  /**
+   * Compare a moment with the time of a NiChange.
+   *
+   * \param moment the moment
+   * \param change the NiChange
+   * \returns true if the moment is before the NiChange
+   */
+  static bool IsAfter (Time moment, const NiChanges::value_type &change);
+
   /**
    * Returns an iterator to the first NiChange that is later than moment
    *
@@ -21,6 +21,7 @@
 #include "ns3/simulator.h"
 #include "ns3/log.h"
 #include "ns3/pointer.h"
+#include "ns3/double.h"
 #include "ns3/net-device.h"
 #include "ns3/node.h"
 #include "ns3/propagation-loss-model.h"
@@ -53,11 +54,22 @@ YansWifiChannel::GetTypeId (void)
                    PointerValue (),
                    MakePointerAccessor (&YansWifiChannel::m_delay),
                    MakePointerChecker<PropagationDelayModel> ())
+    .AddAttribute ("MaxRange",
+                   "If positive, a PPDU is only delivered to the PHYs within this distance, "
+                   "in meters, of the sender: the propagation loss and delay of the other PHYs "
+                   "are not computed and no reception is scheduled for them. The PHYs are found "
+                   "through a grid of the non-moving PHYs, updated on the course changes of "
+                   "their mobility model. The default value disables the cutoff.",
+                   DoubleValue (0),
+                   MakeDoubleAccessor (&YansWifiChannel::m_maxRange),
+                   MakeDoubleChecker<double> (0))
   ;
   return tid;
 }
 
 YansWifiChannel::YansWifiChannel ()
+  : m_maxRange (0),
+    m_nIndexedPhys (0)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -88,7 +100,13 @@ YansWifiChannel::Send (Ptr<YansWifiPhy> sender, Ptr<const WifiPpdu> ppdu, double
   NS_LOG_FUNCTION (this << sender << ppdu << txPowerDbm);
   Ptr<MobilityModel> senderMobility = sender->GetMobility ();
   NS_ASSERT (senderMobility != 0);
-  for (PhyList::const_iterator i = m_phyList.begin (); i != m_phyList.end (); i++)
+  const PhyList *receivers = &m_phyList;
+  if (m_maxRange > 0)
+    {
+      GetPhysInRange (senderMobility, m_physInRange);
+      receivers = &m_physInRange;
+    }
+  for (PhyList::const_iterator i = receivers->begin (); i != receivers->end (); i++)
     {
       if (sender != (*i))
         {
@@ -122,6 +140,28 @@ YansWifiChannel::Send (Ptr<YansWifiPhy> sender, Ptr<const WifiPpdu> ppdu, double
     }
 }
 
+void
+YansWifiChannel::GetPhysInRange (Ptr<const MobilityModel> senderMobility, PhyList &phys) const
+{
+  NS_LOG_FUNCTION (this << senderMobility);
+  if (m_nIndexedPhys == 0)
+    {
+      m_grid.SetCellSize (m_maxRange);
+    }
+  // The mobility model of a PHY is usually set after the PHY is added
+  // to the channel, so it is only looked up on the first transmission
+  for (; m_nIndexedPhys < m_phyList.size (); ++m_nIndexedPhys)
+    {
+      m_grid.Add (m_nIndexedPhys, m_phyList[m_nIndexedPhys]->GetMobility ());
+    }
+  m_grid.GetInRange (senderMobility->GetPosition (), m_maxRange, m_ids);
+  phys.clear ();
+  for (std::vector<uint32_t>::const_iterator i = m_ids.begin (); i != m_ids.end (); ++i)
+    {
+      phys.push_back (m_phyList[*i]);
+    }
+}
+
 void
 YansWifiChannel::Receive (Ptr<YansWifiPhy> phy, Ptr<WifiPpdu> ppdu, double rxPowerDbm)
 {
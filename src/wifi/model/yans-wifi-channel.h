@@ -22,6 +22,7 @@
 #define YANS_WIFI_CHANNEL_H
 
 #include "ns3/channel.h"
+#include "ns3/spatial-grid.h"
 
 namespace ns3 {
 
@@ -32,6 +33,7 @@ class YansWifiPhy;
 class Packet;
 class Time;
 class WifiPpdu;
+class MobilityModel;
 
 /**
  * \brief a channel to interconnect ns3::YansWifiPhy objects.
@@ -114,9 +116,22 @@ private:
    */
   static void Receive (Ptr<YansWifiPhy> receiver, Ptr<WifiPpdu> ppdu, double txPowerDbm);
 
+  /**
+   * Get the PHYs within MaxRange of a sender.
+   *
+   * \param senderMobility the mobility model of the sender
+   * \param phys the PHYs within range, in the order of the PHY list
+   */
+  void GetPhysInRange (Ptr<const MobilityModel> senderMobility, PhyList &phys) const;
+
   PhyList m_phyList;                   //!< List of YansWifiPhys connected to this YansWifiChannel
   Ptr<PropagationLossModel> m_loss;    //!< Propagation loss model
   Ptr<PropagationDelayModel> m_delay;  //!< Propagation delay model
+  double m_maxRange;                   //!< Maximum range (m), 0 if unlimited
+  mutable SpatialGrid m_grid;          //!< PHYs of the PHY list, by index
+  mutable std::size_t m_nIndexedPhys;  //!< Number of PHYs of the PHY list in the grid
+  mutable std::vector<uint32_t> m_ids; //!< Indices of the PHYs within range
+  mutable PhyList m_physInRange;       //!< PHYs within range of the current sender
 };
 
 } //namespace ns3
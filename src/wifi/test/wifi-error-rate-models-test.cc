@@ -21,6 +21,8 @@
 
 #include "ns3/log.h"
 #include "ns3/test.h"
+#include "ns3/double.h"
+#include "ns3/object-factory.h"
 #include "ns3/nist-error-rate-model.h"
 #include "ns3/yans-error-rate-model.h"
 #include "ns3/dsss-error-rate-model.h"
@@ -1527,6 +1529,74 @@ TableBasedErrorRateTestCase::DoRun (void)
     }
 }
 
+/**
+ * \ingroup wifi-test
+ * \ingroup tests
+ *
+ * \brief Wifi Error Rate Models Lookup Table Test Case
+ *
+ * Checks that the chunk success rates looked up in the tables of an
+ * error rate model stay close to the computed ones.
+ */
+class WifiErrorRateModelsTestCaseLookupTable : public TestCase
+{
+public:
+  /**
+   * Constructor
+   *
+   * \param tid the TypeId of the error rate model to test
+   * \param tolerance the largest difference between the looked up and
+   *        the computed success rates
+   */
+  WifiErrorRateModelsTestCaseLookupTable (TypeId tid, double tolerance);
+  virtual ~WifiErrorRateModelsTestCaseLookupTable ();
+
+private:
+  void DoRun (void) override;
+
+  TypeId m_tid;       ///< The TypeId of the error rate model
+  double m_tolerance; ///< The largest difference of the success rates
+};
+
+WifiErrorRateModelsTestCaseLookupTable::WifiErrorRateModelsTestCaseLookupTable (TypeId tid, double tolerance)
+  : TestCase ("WifiErrorRateModel lookup table test case " + tid.GetName ()),
+    m_tid (tid),
+    m_tolerance (tolerance)
+{
+}
+
+WifiErrorRateModelsTestCaseLookupTable::~WifiErrorRateModelsTestCaseLookupTable ()
+{
+}
+
+void
+WifiErrorRateModelsTestCaseLookupTable::DoRun (void)
+{
+  ObjectFactory factory;
+  factory.SetTypeId (m_tid);
+  Ptr<ErrorRateModel> computed = factory.Create<ErrorRateModel> ();
+  factory.Set ("LookupTableResolution", DoubleValue (0.1));
+  factory.Set ("LookupTableMaxError", DoubleValue (1e-4));
+  Ptr<ErrorRateModel> tabulated = factory.Create<ErrorRateModel> ();
+
+  for (uint8_t mcs = 0; mcs <= 7; mcs++)
+    {
+      WifiTxVector txVector;
+      txVector.SetMode (HtPhy::GetHtMcs (mcs));
+      for (uint64_t nbits : {1, 8, 333, 3199, 3200, 12000})
+        {
+          // SNRs which are not on the grid of the tables
+          for (double snr = -5.03; snr <= 35; snr += 0.37)
+            {
+              double expected = computed->GetChunkSuccessRate (txVector.GetMode (), txVector, DbToRatio (snr), nbits);
+              double ps = tabulated->GetChunkSuccessRate (txVector.GetMode (), txVector, DbToRatio (snr), nbits);
+              NS_TEST_EXPECT_MSG_EQ_TOL (ps, expected, m_tolerance, "Wrong success rate for MCS " << +mcs
+                                         << ", " << nbits << " bits at " << snr << " dB");
+            }
+        }
+    }
+}
+
 /**
  * \ingroup wifi-test
  * \ingroup tests
@@ -1545,6 +1615,11 @@ WifiErrorRateModelsTestSuite::WifiErrorRateModelsTestSuite ()
   AddTestCase (new WifiErrorRateModelsTestCaseDsss, TestCase::QUICK);
   AddTestCase (new WifiErrorRateModelsTestCaseNist, TestCase::QUICK);
   AddTestCase (new WifiErrorRateModelsTestCaseMimo, TestCase::QUICK);
+  AddTestCase (new WifiErrorRateModelsTestCaseLookupTable (NistErrorRateModel::GetTypeId (), 2e-4), TestCase::QUICK);
+  AddTestCase (new WifiErrorRateModelsTestCaseLookupTable (YansErrorRateModel::GetTypeId (), 2e-4), TestCase::QUICK);
+  // TableBasedErrorRateModel rounds the chunks down to whole bytes, which
+  // the per-bit interpolation of the tables does not reproduce exactly
+  AddTestCase (new WifiErrorRateModelsTestCaseLookupTable (TableBasedErrorRateModel::GetTypeId (), 2e-3), TestCase::QUICK);
   AddTestCase (new TableBasedErrorRateTestCase ("DefaultTableBasedHtMcs0-1458bytes", HtPhy::GetHtMcs0 (), 1458), TestCase::QUICK);
   AddTestCase (new TableBasedErrorRateTestCase ("DefaultTableBasedHtMcs0-32bytes", HtPhy::GetHtMcs0 (), 32), TestCase::QUICK);
   AddTestCase (new TableBasedErrorRateTestCase ("DefaultTableBasedHtMcs0-1000bytes", HtPhy::GetHtMcs0 (), 1000), TestCase::QUICK);
@@ -0,0 +1,156 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program benchmarks RandomWaypointMobilityModel against
+// BatchMobilityModel in the synthetic highway of the first scenario of
+// vanet-routing-compare: 'nodes' vehicles move between random waypoints
+// of a 1500 m x 300 m area, at a speed uniformly drawn between 0 and
+// 'speed' m/s, without pause, and each one broadcasts a safety message
+// every 'interval' seconds over an 802.11a channel, so that every
+// transmission reads the position of every other vehicle.  Both runs
+// use the same random streams, hence the same trajectories and the same
+// received packets; they only differ by the mobility events.
+// Sample usage:  ./waf --run 'bench-batch-mobility --nodes=40'
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/propagation-module.h"
+#include "ns3/wifi-module.h"
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+
+using namespace ns3;
+
+/// Number of packets received by the MACs.
+static uint64_t g_received = 0;
+
+/**
+ * Sink for the MacRx trace source.
+ * \param [in] p The received packet.
+ */
+static void
+MacRxSink (Ptr<const Packet> p)
+{
+  g_received++;
+}
+
+/**
+ * Broadcast a packet and schedule the next one.
+ * \param [in] device The sending device.
+ * \param [in] interval The interval between two packets.
+ */
+static void
+Broadcast (Ptr<NetDevice> device, Time interval)
+{
+  device->Send (Create<Packet> (200), device->GetBroadcast (), 0x0800);
+  Simulator::Schedule (interval, &Broadcast, device, interval);
+}
+
+/**
+ * Run the highway once and print its cost.
+ * \param [in] nodes Number of vehicles.
+ * \param [in] speed Maximum speed, in m/s.
+ * \param [in] interval Interval between two packets of a vehicle.
+ * \param [in] batch Whether to use BatchMobilityModel.
+ * \param [in] duration Simulated duration.
+ */
+static void
+RunOne (uint32_t nodes, uint32_t speed, Time interval, bool batch, Time duration)
+{
+  g_received = 0;
+  RngSeedManager::SetRun (1);
+
+  NodeContainer vehicles;
+  vehicles.Create (nodes);
+
+  ObjectFactory factory;
+  factory.SetTypeId ("ns3::RandomBoxPositionAllocator");
+  factory.Set ("X", StringValue ("ns3::UniformRandomVariable[Min=0.0|Max=1500.0]"));
+  factory.Set ("Y", StringValue ("ns3::UniformRandomVariable[Min=0.0|Max=300.0]"));
+  factory.Set ("Z", StringValue ("ns3::UniformRandomVariable[Min=1.0|Max=2.0]"));
+  Ptr<PositionAllocator> waypoints = factory.Create<PositionAllocator> ();
+  waypoints->AssignStreams (1);
+  std::ostringstream speedRv;
+  speedRv << "ns3::UniformRandomVariable[Min=0.0|Max=" << speed << "]";
+  MobilityHelper mobility;
+  mobility.SetMobilityModel (batch ? "ns3::BatchMobilityModel" : "ns3::RandomWaypointMobilityModel",
+                             "Speed", StringValue (speedRv.str ()),
+                             "Pause", StringValue ("ns3::ConstantRandomVariable[Constant=0.0]"),
+                             "PositionAllocator", PointerValue (waypoints));
+  mobility.SetPositionAllocator (waypoints);
+  mobility.Install (vehicles);
+  mobility.AssignStreams (vehicles, 10);
+
+  YansWifiChannelHelper channel = YansWifiChannelHelper::Default ();
+  YansWifiPhyHelper phy;
+  phy.SetChannel (channel.Create ());
+  WifiMacHelper mac;
+  mac.SetType ("ns3::AdhocWifiMac");
+  WifiHelper wifi;
+  wifi.SetStandard (WIFI_STANDARD_80211a);
+  wifi.SetRemoteStationManager ("ns3::ConstantRateWifiManager",
+                                "DataMode", StringValue ("OfdmRate6Mbps"));
+  NetDeviceContainer devices = wifi.Install (phy, mac, vehicles);
+  wifi.AssignStreams (devices, 1000);
+
+  Ptr<UniformRandomVariable> start = CreateObject<UniformRandomVariable> ();
+  start->SetStream (2);
+  for (uint32_t i = 0; i < devices.GetN (); i++)
+    {
+      Simulator::Schedule (Seconds (start->GetValue (0, interval.GetSeconds ())),
+                           &Broadcast, devices.Get (i), interval);
+    }
+  Config::ConnectWithoutContext ("/NodeList/*/DeviceList/*/$ns3::WifiNetDevice/Mac/MacRx",
+                                 MakeCallback (&MacRxSink));
+  Simulator::Stop (duration);
+
+  SystemWallClockMs time;
+  time.Start ();
+  Simulator::Run ();
+  uint64_t ms = time.End ();
+  uint64_t events = Simulator::GetEventCount ();
+  Simulator::Destroy ();
+
+  std::cout << std::left << std::setw (10) << (batch ? "batch" : "rwp")
+            << std::setw (12) << ms
+            << std::setw (12) << events
+            << g_received << std::endl;
+}
+
+int main (int argc, char *argv[])
+{
+  uint32_t nodes = 40;
+  uint32_t speed = 20;
+  double interval = 0.1;
+  double duration = 10;
+
+  CommandLine cmd (__FILE__);
+  cmd.AddValue ("nodes", "number of vehicles", nodes);
+  cmd.AddValue ("speed", "maximum speed of the vehicles, in m/s", speed);
+  cmd.AddValue ("interval", "interval between two packets of a vehicle, in seconds", interval);
+  cmd.AddValue ("duration", "simulated duration of each run, in seconds", duration);
+  cmd.Parse (argc, argv);
+
+  std::cout << std::left << std::setw (10) << "mobility"
+            << std::setw (12) << "wall (ms)"
+            << std::setw (12) << "events"
+            << "received" << std::endl;
+  RunOne (nodes, speed, Seconds (interval), false, Seconds (duration));
+  RunOne (nodes, speed, Seconds (interval), true, Seconds (duration));
+  return 0;
+}
@@ -0,0 +1,120 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program benchmarks the demultiplexing of TCP segments to many
+// concurrent connections: a client opens 'connections' TCP connections,
+// started within the first 10 ms, to a single PacketSink over a
+// point-to-point link, and sends 'bytes' bytes on each.  Runs with 1/100,
+// 1/10 and all the connections show how the cost per segment grows with
+// the number of endpoints of the sender and receiver.
+// Sample usage:  ./waf --run 'bench-endpoint-demux --connections=10000'
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/applications-module.h"
+#include <iostream>
+#include <iomanip>
+
+using namespace ns3;
+
+/// TCP segment size, in bytes.
+static const uint32_t g_segmentSize = 1448;
+
+/**
+ * Run the transfers of some connections and print their cost.
+ * \param [in] connections Number of connections.
+ * \param [in] bytes Number of bytes sent on each connection.
+ */
+static void
+RunOne (uint32_t connections, uint32_t bytes)
+{
+  Config::SetDefault ("ns3::TcpSocket::SegmentSize", UintegerValue (g_segmentSize));
+
+  NodeContainer nodes;
+  nodes.Create (2);
+
+  PointToPointHelper p2p;
+  p2p.SetDeviceAttribute ("DataRate", StringValue ("10Gbps"));
+  p2p.SetChannelAttribute ("Delay", StringValue ("10us"));
+  p2p.SetQueue ("ns3::DropTailQueue", "MaxSize", StringValue ("100000p"));
+  NetDeviceContainer devices = p2p.Install (nodes);
+
+  InternetStackHelper stack;
+  stack.Install (nodes);
+  Ipv4AddressHelper address;
+  address.SetBase ("10.1.1.0", "255.255.255.0");
+  Ipv4InterfaceContainer interfaces = address.Assign (devices);
+
+  uint16_t port = 50000;
+  PacketSinkHelper sink ("ns3::TcpSocketFactory",
+                         InetSocketAddress (Ipv4Address::GetAny (), port));
+  ApplicationContainer sinkApp = sink.Install (nodes.Get (1));
+  sinkApp.Start (Seconds (0));
+
+  Ptr<UniformRandomVariable> start = CreateObject<UniformRandomVariable> ();
+  start->SetStream (1);
+  BulkSendHelper source ("ns3::TcpSocketFactory",
+                         InetSocketAddress (interfaces.GetAddress (1), port));
+  source.SetAttribute ("MaxBytes", UintegerValue (bytes));
+  for (uint32_t i = 0; i < connections; i++)
+    {
+      ApplicationContainer sourceApp = source.Install (nodes.Get (0));
+      sourceApp.Start (MicroSeconds (start->GetInteger (1, 10000)));
+    }
+  Simulator::Stop (Seconds (10));
+
+  SystemWallClockMs time;
+  time.Start ();
+  Simulator::Run ();
+  uint64_t ms = time.End ();
+
+  uint64_t rx = DynamicCast<PacketSink> (sinkApp.Get (0))->GetTotalRx ();
+  uint64_t segments = (rx + g_segmentSize - 1) / g_segmentSize;
+  Simulator::Destroy ();
+  NS_ABORT_MSG_IF (rx != static_cast<uint64_t> (connections) * bytes, "Some bytes were not received");
+
+  double s = std::max<uint64_t> (ms, 1) / 1000.0;
+  std::cout << std::left << std::setw (14) << connections
+            << std::setw (12) << ms
+            << std::setw (14) << segments
+            << static_cast<uint64_t> (segments / s) << std::endl;
+}
+
+int main (int argc, char *argv[])
+{
+  uint32_t connections = 10000;
+  uint32_t bytes = 4 * g_segmentSize;
+
+  CommandLine cmd (__FILE__);
+  cmd.AddValue ("connections", "largest number of concurrent connections", connections);
+  cmd.AddValue ("bytes", "number of bytes sent on each connection", bytes);
+  cmd.Parse (argc, argv);
+
+  std::cout << std::left << std::setw (14) << "connections"
+            << std::setw (12) << "wall (ms)"
+            << std::setw (14) << "segments"
+            << "segments/s" << std::endl;
+  for (uint32_t n : {connections / 100, connections / 10, connections})
+    {
+      if (n > 0)
+        {
+          RunOne (n, bytes);
+        }
+    }
+  return 0;
+}
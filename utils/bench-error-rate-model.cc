@@ -0,0 +1,115 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program compares the chunk success rates computed by the Wi-Fi
+// error rate models with those looked up in their tables (see the
+// LookupTableResolution attribute of ErrorRateModel).  For each model,
+// it draws 'chunks' chunks with a random HE MCS, SNR and size, and
+// prints the time taken by both and the largest and mean differences.
+// Sample usage:  ./waf --run 'bench-error-rate-model --resolution=0.05'
+
+#include "ns3/core-module.h"
+#include "ns3/wifi-module.h"
+#include <iostream>
+#include <iomanip>
+
+using namespace ns3;
+
+/**
+ * Compare an error rate model with and without lookup tables.
+ * \param [in] name The name of the model.
+ * \param [in] tid The TypeId of the model.
+ * \param [in] chunks The number of chunks.
+ * \param [in] resolution The SNR step of the lookup tables, in dB.
+ * \param [in] maxError The largest error of a lookup table cell.
+ */
+static void
+RunOne (std::string name, TypeId tid, uint32_t chunks, double resolution, double maxError)
+{
+  ObjectFactory factory;
+  factory.SetTypeId (tid);
+  Ptr<ErrorRateModel> computed = factory.Create<ErrorRateModel> ();
+  factory.Set ("LookupTableResolution", DoubleValue (resolution));
+  factory.Set ("LookupTableMaxError", DoubleValue (maxError));
+  Ptr<ErrorRateModel> tabulated = factory.Create<ErrorRateModel> ();
+
+  Ptr<UniformRandomVariable> random = CreateObject<UniformRandomVariable> ();
+  random->SetStream (1);
+  std::vector<WifiTxVector> txVectors;
+  std::vector<double> snrs;
+  std::vector<uint64_t> sizes;
+  for (uint32_t i = 0; i < chunks; i++)
+    {
+      uint8_t mcs = random->GetInteger (0, 11);
+      txVectors.push_back (WifiTxVector (HePhy::GetHeMcs (mcs), 0, WIFI_PREAMBLE_HE_SU, 800, 1, 1, 0, 20, false, false));
+      snrs.push_back (DbToRatio (random->GetValue (-5, 40)));
+      sizes.push_back (random->GetInteger (1, 12000));
+    }
+
+  std::vector<double> exact (chunks);
+  SystemWallClockMs time;
+  time.Start ();
+  for (uint32_t i = 0; i < chunks; i++)
+    {
+      exact[i] = computed->GetChunkSuccessRate (txVectors[i].GetMode (), txVectors[i], snrs[i], sizes[i]);
+    }
+  uint64_t computedMs = time.End ();
+
+  std::vector<double> looked (chunks);
+  time.Start ();
+  for (uint32_t i = 0; i < chunks; i++)
+    {
+      looked[i] = tabulated->GetChunkSuccessRate (txVectors[i].GetMode (), txVectors[i], snrs[i], sizes[i]);
+    }
+  uint64_t tabulatedMs = time.End ();
+
+  double maxDiff = 0;
+  double sumDiff = 0;
+  for (uint32_t i = 0; i < chunks; i++)
+    {
+      double diff = std::abs (exact[i] - looked[i]);
+      maxDiff = std::max (maxDiff, diff);
+      sumDiff += diff;
+    }
+  std::cout << std::left << std::setw (12) << name
+            << std::setw (15) << computedMs
+            << std::setw (15) << tabulatedMs
+            << std::setw (14) << maxDiff
+            << sumDiff / chunks << std::endl;
+}
+
+int main (int argc, char *argv[])
+{
+  uint32_t chunks = 1000000;
+  double resolution = 0.1;
+  double maxError = 1e-4;
+
+  CommandLine cmd (__FILE__);
+  cmd.AddValue ("chunks", "number of chunks per model", chunks);
+  cmd.AddValue ("resolution", "SNR step of the lookup tables, in dB", resolution);
+  cmd.AddValue ("maxError", "largest error of a lookup table cell", maxError);
+  cmd.Parse (argc, argv);
+
+  std::cout << std::left << std::setw (12) << "model"
+            << std::setw (15) << "computed (ms)"
+            << std::setw (15) << "tabulated (ms)"
+            << std::setw (14) << "max error"
+            << "mean error" << std::endl;
+  RunOne ("Nist", NistErrorRateModel::GetTypeId (), chunks, resolution, maxError);
+  RunOne ("Yans", YansErrorRateModel::GetTypeId (), chunks, resolution, maxError);
+  RunOne ("TableBased", TableBasedErrorRateModel::GetTypeId (), chunks, resolution, maxError);
+  return 0;
+}
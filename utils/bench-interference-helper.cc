@@ -0,0 +1,179 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program benchmarks the InterferenceHelper of a Wi-Fi PHY
+// receiving HE multi-user traffic.  The receiver tracks 'bands' bands
+// (e.g., the 26-tone RUs of a channel), a new PPDU spanning all of
+// them arrives every 'interval' microseconds and lasts 'duration'
+// microseconds, so that about duration / interval PPDUs overlap.  The
+// receiver locks on the first PPDU which arrives while it is idle and,
+// at the end of the PPDU, computes the PHY header and payload SNR and
+// PER of every band, as the HE PHY does for an UL OFDMA reception.
+// Sample usage:  ./waf --run 'bench-interference-helper --bands=37'
+
+#include "ns3/core-module.h"
+#include "ns3/wifi-module.h"
+#include <iostream>
+#include <iomanip>
+
+using namespace ns3;
+
+namespace {
+
+/**
+ * \ingroup wifi
+ * \brief Receive a stream of overlapping PPDUs with an InterferenceHelper.
+ */
+class InterferenceBench
+{
+public:
+  /**
+   * \param bands Number of bands.
+   * \param interval Interval between the start of two PPDUs.
+   * \param duration Duration of a PPDU.
+   */
+  InterferenceBench (uint32_t bands, Time interval, Time duration);
+
+  /// Arrival of a PPDU.
+  void Arrive (void);
+  /**
+   * End of a received PPDU.
+   * \param event The received PPDU.
+   */
+  void EndRx (Ptr<Event> event);
+
+  /// \return The number of PPDUs received.
+  uint64_t GetReceived (void) const;
+  /// \return The mean payload PER of the bands of the received PPDUs.
+  double GetMeanPer (void) const;
+
+private:
+  InterferenceHelper m_helper;                 //!< The helper
+  std::vector<WifiSpectrumBand> m_bands;       //!< The bands
+  Time m_interval;                             //!< Interval between two PPDUs
+  Time m_duration;                             //!< Duration of a PPDU
+  WifiTxVector m_txVector;                     //!< TXVECTOR of the PPDUs
+  Ptr<UniformRandomVariable> m_power;          //!< Received power, in dBm
+  bool m_rxing;                                //!< Whether a PPDU is being received
+  uint64_t m_received;                         //!< Number of PPDUs received
+  double m_per;                                //!< Sum of the payload PERs
+};
+
+InterferenceBench::InterferenceBench (uint32_t bands, Time interval, Time duration)
+  : m_interval (interval),
+    m_duration (duration),
+    m_txVector (HePhy::GetHeMcs0 (), 0, WIFI_PREAMBLE_HE_SU, 800, 1, 1, 0, 20, false, false),
+    m_power (CreateObject<UniformRandomVariable> ()),
+    m_rxing (false),
+    m_received (0),
+    m_per (0)
+{
+  m_helper.SetNoiseFigure (DbToRatio (7));
+  m_helper.SetErrorRateModel (CreateObject<NistErrorRateModel> ());
+  for (uint32_t i = 0; i < bands; i++)
+    {
+      WifiSpectrumBand band (i * 26, i * 26 + 25);
+      m_helper.AddBand (band);
+      m_bands.push_back (band);
+    }
+  m_power->SetStream (1);
+}
+
+void
+InterferenceBench::Arrive (void)
+{
+  RxPowerWattPerChannelBand rxPower;
+  for (const auto & band : m_bands)
+    {
+      rxPower.insert ({band, DbmToW (m_power->GetValue (-100, -50))});
+    }
+  WifiMacHeader hdr;
+  hdr.SetType (WIFI_MAC_QOSDATA);
+  Ptr<WifiPpdu> ppdu = Create<WifiPpdu> (Create<WifiPsdu> (Create<Packet> (1000), hdr), m_txVector);
+  Ptr<Event> event = m_helper.Add (ppdu, m_txVector, m_duration, rxPower);
+  if (!m_rxing)
+    {
+      m_rxing = true;
+      m_helper.NotifyRxStart ();
+      Simulator::Schedule (m_duration, &InterferenceBench::EndRx, this, event);
+    }
+  Simulator::Schedule (m_interval, &InterferenceBench::Arrive, this);
+}
+
+void
+InterferenceBench::EndRx (Ptr<Event> event)
+{
+  Time payload = m_duration - WifiPhy::CalculatePhyPreambleAndHeaderDuration (m_txVector);
+  for (const auto & band : m_bands)
+    {
+      m_helper.CalculatePhyHeaderSnrPer (event, 20, band, WIFI_PPDU_FIELD_SIG_A);
+      m_per += m_helper.CalculatePayloadSnrPer (event, 20, band, SU_STA_ID,
+                                                std::make_pair (Seconds (0), payload)).per;
+    }
+  m_helper.NotifyRxEnd (Simulator::Now ());
+  m_rxing = false;
+  m_received++;
+}
+
+uint64_t
+InterferenceBench::GetReceived (void) const
+{
+  return m_received;
+}
+
+double
+InterferenceBench::GetMeanPer (void) const
+{
+  return m_received ? m_per / m_received / m_bands.size () : 0;
+}
+
+} // unnamed namespace
+
+int main (int argc, char *argv[])
+{
+  uint32_t bands = 9;
+  uint32_t interval = 50;
+  uint32_t duration = 500;
+  double stop = 10;
+
+  CommandLine cmd (__FILE__);
+  cmd.AddValue ("bands", "number of bands", bands);
+  cmd.AddValue ("interval", "interval between the start of two PPDUs, in microseconds", interval);
+  cmd.AddValue ("duration", "duration of a PPDU, in microseconds", duration);
+  cmd.AddValue ("stop", "simulated duration, in seconds", stop);
+  cmd.Parse (argc, argv);
+
+  InterferenceBench bench (bands, MicroSeconds (interval), MicroSeconds (duration));
+  Simulator::Schedule (Seconds (0), &InterferenceBench::Arrive, &bench);
+  Simulator::Stop (Seconds (stop));
+
+  SystemWallClockMs time;
+  time.Start ();
+  Simulator::Run ();
+  uint64_t ms = time.End ();
+  Simulator::Destroy ();
+
+  double s = std::max<uint64_t> (ms, 1) / 1000.0;
+  std::cout << std::left << std::setw (12) << "wall (ms)"
+            << std::setw (12) << "received"
+            << std::setw (14) << "received/s"
+            << "mean PER" << std::endl;
+  std::cout << std::left << std::setw (12) << ms
+            << std::setw (12) << bench.GetReceived ()
+            << std::setw (14) << static_cast<uint64_t> (bench.GetReceived () / s)
+            << bench.GetMeanPer () << std::endl;
+  return 0;
+}
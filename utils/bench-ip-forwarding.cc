@@ -0,0 +1,115 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program benchmarks the IPv4 forwarding path: a UDP client sends
+// 'packets' packets to a server through a chain of 'routers' routers,
+// connected by CSMA links (which resolve their next hops with ARP) or by
+// point-to-point links, with global routing.  It prints the number of
+// packets forwarded by the routers per wall-clock second.
+// Sample usage:  ./waf --run 'bench-ip-forwarding --routers=8 --link=csma'
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/csma-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/applications-module.h"
+#include <iostream>
+#include <iomanip>
+
+using namespace ns3;
+
+static uint64_t g_forwarded = 0; //!< the number of forwarded packets
+
+/**
+ * Count a forwarded packet.
+ * \param [in] header The IPv4 header.
+ * \param [in] packet The packet.
+ * \param [in] interface The output interface.
+ */
+static void
+Forward (const Ipv4Header &header, Ptr<const Packet> packet, uint32_t interface)
+{
+  g_forwarded++;
+}
+
+int main (int argc, char *argv[])
+{
+  uint32_t routers = 8;
+  uint32_t packets = 20000;
+  std::string link = "csma";
+
+  CommandLine cmd (__FILE__);
+  cmd.AddValue ("routers", "number of routers between the client and the server", routers);
+  cmd.AddValue ("packets", "number of packets sent by the client", packets);
+  cmd.AddValue ("link", "type of the links: csma or p2p", link);
+  cmd.Parse (argc, argv);
+
+  NodeContainer nodes;
+  nodes.Create (routers + 2);
+  InternetStackHelper internet;
+  internet.Install (nodes);
+
+  CsmaHelper csma;
+  csma.SetChannelAttribute ("DataRate", StringValue ("10Gbps"));
+  csma.SetChannelAttribute ("Delay", StringValue ("1us"));
+  PointToPointHelper p2p;
+  p2p.SetDeviceAttribute ("DataRate", StringValue ("10Gbps"));
+  p2p.SetChannelAttribute ("Delay", StringValue ("1us"));
+  Ipv4AddressHelper address;
+  address.SetBase ("10.0.0.0", "255.255.255.0");
+  Ipv4InterfaceContainer last;
+  for (uint32_t i = 0; i <= routers; i++)
+    {
+      NodeContainer pair (nodes.Get (i), nodes.Get (i + 1));
+      NetDeviceContainer devices = link == "csma" ? csma.Install (pair) : p2p.Install (pair);
+      last = address.Assign (devices);
+      address.NewNetwork ();
+    }
+  Ipv4GlobalRoutingHelper::PopulateRoutingTables ();
+
+  uint16_t port = 9;
+  UdpServerHelper server (port);
+  ApplicationContainer serverApp = server.Install (nodes.Get (routers + 1));
+  UdpClientHelper client (last.GetAddress (1), port);
+  client.SetAttribute ("MaxPackets", UintegerValue (packets));
+  client.SetAttribute ("Interval", TimeValue (MicroSeconds (10)));
+  client.SetAttribute ("PacketSize", UintegerValue (1000));
+  ApplicationContainer clientApp = client.Install (nodes.Get (0));
+  clientApp.Start (Seconds (1));
+  Config::ConnectWithoutContext ("/NodeList/*/$ns3::Ipv4L3Protocol/UnicastForward", MakeCallback (&Forward));
+
+  SystemWallClockMs clock;
+  clock.Start ();
+  Simulator::Run ();
+  int64_t ms = clock.End ();
+  uint64_t received = DynamicCast<UdpServer> (serverApp.Get (0))->GetReceived ();
+  Simulator::Destroy ();
+
+  std::cout << std::left << std::setw (8) << "link"
+            << std::setw (10) << "routers"
+            << std::setw (12) << "received"
+            << std::setw (12) << "forwarded"
+            << std::setw (12) << "wall (ms)"
+            << "forwarded/s" << std::endl;
+  std::cout << std::left << std::setw (8) << link
+            << std::setw (10) << routers
+            << std::setw (12) << received
+            << std::setw (12) << g_forwarded
+            << std::setw (12) << ms
+            << static_cast<uint64_t> (g_forwarded * 1000.0 / std::max<int64_t> (ms, 1)) << std::endl;
+  return 0;
+}
@@ -0,0 +1,184 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program benchmarks the forwarding rate of Ipv4StaticRouting and
+// Ipv4GlobalRouting on a fat-tree switch: 'ports' interfaces, 'hosts'
+// host routes spread over the ports, one /24 network route per 256
+// hosts and a default route.  Each routing protocol forwards 'packets'
+// packets to random hosts through RouteInput, with its routes looked
+// up in the trie (UseFib=true) and in the lists (UseFib=false).
+// Sample usage:
+//   ./waf --run 'bench-ipv4-fib --hosts=8192 --packets=1000000'
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/internet-module.h"
+#include <iostream>
+#include <iomanip>
+
+using namespace ns3;
+
+static uint64_t g_forwarded = 0; //!< the number of forwarded packets
+
+/**
+ * Count a forwarded packet.
+ * \param [in] route The route.
+ * \param [in] packet The packet.
+ * \param [in] header The IPv4 header.
+ */
+static void
+Forward (Ptr<Ipv4Route> route, Ptr<const Packet> packet, const Ipv4Header &header)
+{
+  g_forwarded++;
+}
+
+/**
+ * Forward packets to random hosts.
+ * \param [in] routing The routing protocol.
+ * \param [in] idev The input device.
+ * \param [in] dests The destinations.
+ * \param [in] packets The number of packets.
+ * \return the wall clock time, in ms.
+ */
+static int64_t
+Run (Ptr<Ipv4RoutingProtocol> routing, Ptr<NetDevice> idev,
+     const std::vector<Ipv4Address> &dests, uint32_t packets)
+{
+  Ptr<Packet> packet = Create<Packet> (100);
+  Ipv4Header header;
+  Ipv4RoutingProtocol::UnicastForwardCallback ucb = MakeCallback (&Forward);
+  Ipv4RoutingProtocol::MulticastForwardCallback mcb;
+  Ipv4RoutingProtocol::LocalDeliverCallback lcb;
+  Ipv4RoutingProtocol::ErrorCallback ecb;
+  g_forwarded = 0;
+  SystemWallClockMs clock;
+  clock.Start ();
+  for (uint32_t i = 0; i < packets; i++)
+    {
+      header.SetDestination (dests[i % dests.size ()]);
+      routing->RouteInput (packet, header, idev, ucb, mcb, lcb, ecb);
+    }
+  int64_t ms = clock.End ();
+  NS_ABORT_MSG_IF (g_forwarded != packets, "Some packets were not forwarded");
+  return ms;
+}
+
+int main (int argc, char *argv[])
+{
+  uint32_t ports = 48;
+  uint32_t hosts = 8192;
+  uint32_t packets = 1000000;
+
+  CommandLine cmd (__FILE__);
+  cmd.AddValue ("ports", "number of interfaces of the switch", ports);
+  cmd.AddValue ("hosts", "number of host routes", hosts);
+  cmd.AddValue ("packets", "number of packets forwarded by each configuration", packets);
+  cmd.Parse (argc, argv);
+
+  Ptr<Node> node = CreateObject<Node> ();
+  InternetStackHelper internet;
+  internet.SetRoutingHelper (Ipv4StaticRoutingHelper ());
+  internet.Install (node);
+  Ptr<Ipv4> ipv4 = node->GetObject<Ipv4> ();
+  for (uint32_t i = 0; i < ports; i++)
+    {
+      Ptr<SimpleNetDevice> device = CreateObject<SimpleNetDevice> ();
+      device->SetAddress (Mac48Address::Allocate ());
+      node->AddDevice (device);
+      int32_t interface = ipv4->AddInterface (device);
+      ipv4->AddAddress (interface, Ipv4InterfaceAddress (Ipv4Address ((172 << 24) | (16 << 16) | (i << 2) | 1),
+                                                        Ipv4Mask ("/30")));
+      ipv4->SetForwarding (interface, true);
+      ipv4->SetUp (interface);
+    }
+
+  Ptr<UniformRandomVariable> random = CreateObject<UniformRandomVariable> ();
+  random->SetStream (1);
+  std::vector<Ipv4Address> dests;
+  for (uint32_t i = 0; i < 4096; i++)
+    {
+      dests.push_back (Ipv4Address ((10 << 24) | random->GetInteger (0, hosts - 1)));
+    }
+
+  std::cout << "switch of " << ports << " ports, " << hosts << " host routes, "
+            << packets << " packets" << std::endl;
+  std::cout << std::left << std::setw (10) << "routing"
+            << std::setw (8) << "lookup"
+            << std::setw (12) << "setup (ms)"
+            << std::setw (12) << "wall (ms)"
+            << "Mpps" << std::endl;
+  for (std::string protocol : {"static", "global"})
+    {
+      for (bool useFib : {false, true})
+        {
+          SystemWallClockMs clock;
+          clock.Start ();
+          Ptr<Ipv4RoutingProtocol> routing;
+          if (protocol == "static")
+            {
+              Ptr<Ipv4StaticRouting> staticRouting = CreateObject<Ipv4StaticRouting> ();
+              staticRouting->SetAttribute ("UseFib", BooleanValue (useFib));
+              staticRouting->SetIpv4 (ipv4);
+              for (uint32_t h = 0; h < hosts; h++)
+                {
+                  uint32_t port = 1 + h % ports;
+                  staticRouting->AddHostRouteTo (Ipv4Address ((10 << 24) | h),
+                                                 ipv4->GetAddress (port, 0).GetLocal (), port);
+                }
+              for (uint32_t n = 0; n < (hosts + 255) / 256; n++)
+                {
+                  uint32_t port = 1 + n % ports;
+                  staticRouting->AddNetworkRouteTo (Ipv4Address ((10 << 24) | (n << 8)), Ipv4Mask ("/24"),
+                                                    ipv4->GetAddress (port, 0).GetLocal (), port);
+                }
+              staticRouting->SetDefaultRoute (ipv4->GetAddress (1, 0).GetLocal (), 1);
+              routing = staticRouting;
+            }
+          else
+            {
+              Ptr<Ipv4GlobalRouting> globalRouting = CreateObject<Ipv4GlobalRouting> ();
+              globalRouting->SetAttribute ("UseFib", BooleanValue (useFib));
+              globalRouting->SetIpv4 (ipv4);
+              for (uint32_t h = 0; h < hosts; h++)
+                {
+                  uint32_t port = 1 + h % ports;
+                  globalRouting->AddHostRouteTo (Ipv4Address ((10 << 24) | h),
+                                                 ipv4->GetAddress (port, 0).GetLocal (), port);
+                }
+              for (uint32_t n = 0; n < (hosts + 255) / 256; n++)
+                {
+                  uint32_t port = 1 + n % ports;
+                  globalRouting->AddNetworkRouteTo (Ipv4Address ((10 << 24) | (n << 8)), Ipv4Mask ("/24"),
+                                                    ipv4->GetAddress (port, 0).GetLocal (), port);
+                }
+              globalRouting->AddASExternalRouteTo (Ipv4Address::GetZero (), Ipv4Mask::GetZero (),
+                                                   ipv4->GetAddress (1, 0).GetLocal (), 1);
+              routing = globalRouting;
+            }
+          int64_t setupMs = clock.End ();
+          int64_t ms = Run (routing, ipv4->GetNetDevice (1), dests, packets);
+          std::cout << std::left << std::setw (10) << protocol
+                    << std::setw (8) << (useFib ? "trie" : "list")
+                    << std::setw (12) << setupMs
+                    << std::setw (12) << ms
+                    << std::fixed << std::setprecision (3)
+                    << (ms > 0 ? packets / 1000.0 / ms : 0) << std::endl;
+          routing->Dispose ();
+        }
+    }
+  Simulator::Destroy ();
+  return 0;
+}
@@ -0,0 +1,394 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program benchmarks the TTI throughput of the FF MAC schedulers,
+// called directly or through the FfMacSchedulerExecutor.  Each of
+// 'cells' schedulers, of type 'scheduler', serves 'ues' saturated UEs
+// on 100 RBs, as the MAC of an eNB would: every 'cqiPeriod' TTIs, each
+// UE reports random wideband and subband DL CQIs and a BSR, and every
+// TTI the DL and UL triggers are run.  Only the schedulers are
+// simulated, without PHY nor MAC, so that their cost is not hidden by
+// the rest of an LTE simulation.  All the runs draw the same CQIs,
+// hence allocate the same number of bytes.
+// Sample usage:
+//   ./waf --run 'bench-lte-scheduler --cells=50 --ues=100 --threads=0,1,4'
+
+#include "ns3/core-module.h"
+#include "ns3/lte-module.h"
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+
+using namespace ns3;
+
+/**
+ * The MAC of a cell: the SAP user of its scheduler, which counts the
+ * allocated bytes.
+ */
+class BenchCell : public FfMacSchedSapUser, public FfMacCschedSapUser
+{
+public:
+  /**
+   * Create the scheduler of the cell and its UEs.
+   * \param [in] scheduler The type of the scheduler.
+   * \param [in] ues The number of UEs.
+   * \param [in] cqi The random variable drawing the CQIs.
+   */
+  BenchCell (std::string scheduler, uint32_t ues, Ptr<UniformRandomVariable> cqi);
+
+  /**
+   * Report the CQIs and BSRs of the UEs to the scheduler.
+   */
+  void Report (void);
+  /**
+   * Run the DL and UL triggers of a TTI.  The indications received
+   * while a trigger is run by the executor are buffered.
+   */
+  void Trigger (void);
+  /**
+   * Count the bytes of the buffered indications.
+   */
+  void Apply (void);
+  /**
+   * \param [in] tti The TTI to schedule.
+   */
+  void SetTti (uint32_t tti);
+
+  /** \return the bytes allocated in DL */
+  uint64_t GetDlBytes (void) const;
+  /** \return the bytes allocated in UL */
+  uint64_t GetUlBytes (void) const;
+
+  virtual void SchedDlConfigInd (const struct SchedDlConfigIndParameters& params);
+  virtual void SchedUlConfigInd (const struct SchedUlConfigIndParameters& params);
+  virtual void CschedCellConfigCnf (const struct CschedCellConfigCnfParameters& params) {}
+  virtual void CschedUeConfigCnf (const struct CschedUeConfigCnfParameters& params) {}
+  virtual void CschedLcConfigCnf (const struct CschedLcConfigCnfParameters& params) {}
+  virtual void CschedLcReleaseCnf (const struct CschedLcReleaseCnfParameters& params) {}
+  virtual void CschedUeReleaseCnf (const struct CschedUeReleaseCnfParameters& params) {}
+  virtual void CschedUeConfigUpdateInd (const struct CschedUeConfigUpdateIndParameters& params) {}
+  virtual void CschedCellConfigUpdateInd (const struct CschedCellConfigUpdateIndParameters& params) {}
+
+private:
+  Ptr<FfMacScheduler> m_scheduler; //!< the scheduler
+  Ptr<LteFfrAlgorithm> m_ffr; //!< the (no-op) frequency reuse algorithm
+  uint32_t m_ues; //!< the number of UEs
+  Ptr<UniformRandomVariable> m_cqi; //!< the random variable drawing the CQIs
+  uint32_t m_tti; //!< the TTI to schedule
+  bool m_buffered; //!< whether the indications are buffered
+  std::vector<SchedDlConfigIndParameters> m_dlInds; //!< the buffered DL indications
+  std::vector<SchedUlConfigIndParameters> m_ulInds; //!< the buffered UL indications
+  uint64_t m_dlBytes; //!< the bytes allocated in DL
+  uint64_t m_ulBytes; //!< the bytes allocated in UL
+};
+
+/// Number of RBs of the cells
+static const uint16_t BANDWIDTH = 100;
+/// Number of RBGs of the cells
+static const uint16_t RBGS = 25;
+
+BenchCell::BenchCell (std::string scheduler, uint32_t ues, Ptr<UniformRandomVariable> cqi)
+  : m_ues (ues),
+    m_cqi (cqi),
+    m_tti (0),
+    m_buffered (false),
+    m_dlBytes (0),
+    m_ulBytes (0)
+{
+  ObjectFactory factory;
+  factory.SetTypeId (scheduler);
+  // without PHY, there is no HARQ feedback
+  factory.Set ("HarqEnabled", BooleanValue (false));
+  m_scheduler = factory.Create<FfMacScheduler> ();
+  m_ffr = CreateObject<LteFrNoOpAlgorithm> ();
+  m_ffr->SetUlBandwidth (BANDWIDTH);
+  m_ffr->SetDlBandwidth (BANDWIDTH);
+  m_scheduler->SetLteFfrSapProvider (m_ffr->GetLteFfrSapProvider ());
+  m_ffr->SetLteFfrSapUser (m_scheduler->GetLteFfrSapUser ());
+  m_scheduler->SetFfMacSchedSapUser (this);
+  m_scheduler->SetFfMacCschedSapUser (this);
+
+  FfMacCschedSapProvider::CschedCellConfigReqParameters cell;
+  cell.m_ulBandwidth = BANDWIDTH;
+  cell.m_dlBandwidth = BANDWIDTH;
+  m_scheduler->GetFfMacCschedSapProvider ()->CschedCellConfigReq (cell);
+  for (uint16_t rnti = 1; rnti <= m_ues; rnti++)
+    {
+      FfMacCschedSapProvider::CschedUeConfigReqParameters ue;
+      ue.m_rnti = rnti;
+      ue.m_transmissionMode = 0;
+      ue.m_reconfigureFlag = false;
+      m_scheduler->GetFfMacCschedSapProvider ()->CschedUeConfigReq (ue);
+
+      FfMacCschedSapProvider::CschedLcConfigReqParameters lc;
+      lc.m_rnti = rnti;
+      lc.m_reconfigureFlag = false;
+      LogicalChannelConfigListElement_s lcle;
+      lcle.m_logicalChannelIdentity = 3;
+      lcle.m_logicalChannelGroup = 0;
+      lcle.m_direction = LogicalChannelConfigListElement_s::DIR_BOTH;
+      lcle.m_qosBearerType = LogicalChannelConfigListElement_s::QBT_NON_GBR;
+      lcle.m_qci = EpsBearer::NGBR_VIDEO_TCP_DEFAULT;
+      lcle.m_eRabMaximulBitrateUl = 0;
+      lcle.m_eRabMaximulBitrateDl = 0;
+      lcle.m_eRabGuaranteedBitrateUl = 0;
+      lcle.m_eRabGuaranteedBitrateDl = 0;
+      lc.m_logicalChannelConfigList.push_back (lcle);
+      m_scheduler->GetFfMacCschedSapProvider ()->CschedLcConfigReq (lc);
+
+      FfMacSchedSapProvider::SchedDlRlcBufferReqParameters rlc;
+      rlc.m_rnti = rnti;
+      rlc.m_logicalChannelIdentity = 3;
+      rlc.m_rlcTransmissionQueueSize = 1 << 30;
+      rlc.m_rlcTransmissionQueueHolDelay = 0;
+      rlc.m_rlcRetransmissionQueueSize = 0;
+      rlc.m_rlcRetransmissionHolDelay = 0;
+      rlc.m_rlcStatusPduSize = 0;
+      m_scheduler->GetFfMacSchedSapProvider ()->SchedDlRlcBufferReq (rlc);
+    }
+}
+
+void
+BenchCell::SetTti (uint32_t tti)
+{
+  m_tti = tti;
+}
+
+void
+BenchCell::Report (void)
+{
+  FfMacSchedSapProvider::SchedDlCqiInfoReqParameters dlCqi;
+  FfMacSchedSapProvider::SchedUlMacCtrlInfoReqParameters bsr;
+  for (uint16_t rnti = 1; rnti <= m_ues; rnti++)
+    {
+      CqiListElement_s wideband;
+      wideband.m_rnti = rnti;
+      wideband.m_ri = 1;
+      wideband.m_cqiType = CqiListElement_s::P10;
+      wideband.m_wbCqi.push_back (m_cqi->GetInteger (1, 15));
+      dlCqi.m_cqiList.push_back (wideband);
+
+      CqiListElement_s subband;
+      subband.m_rnti = rnti;
+      subband.m_ri = 1;
+      subband.m_cqiType = CqiListElement_s::A30;
+      subband.m_wbCqi.push_back (wideband.m_wbCqi.at (0));
+      for (uint16_t rbg = 0; rbg < RBGS; rbg++)
+        {
+          HigherLayerSelected_s hls;
+          hls.m_sbCqi.push_back (m_cqi->GetInteger (1, 15));
+          subband.m_sbMeasResult.m_higherLayerSelected.push_back (hls);
+        }
+      dlCqi.m_cqiList.push_back (subband);
+
+      MacCeListElement_s ce;
+      ce.m_rnti = rnti;
+      ce.m_macCeType = MacCeListElement_s::BSR;
+      ce.m_macCeValue.m_bufferStatus.push_back (63);
+      ce.m_macCeValue.m_bufferStatus.push_back (0);
+      ce.m_macCeValue.m_bufferStatus.push_back (0);
+      ce.m_macCeValue.m_bufferStatus.push_back (0);
+      bsr.m_macCeList.push_back (ce);
+    }
+  m_scheduler->GetFfMacSchedSapProvider ()->SchedDlCqiInfoReq (dlCqi);
+  m_scheduler->GetFfMacSchedSapProvider ()->SchedUlMacCtrlInfoReq (bsr);
+}
+
+void
+BenchCell::Trigger (void)
+{
+  m_buffered = true;
+  uint32_t frame = 1 + m_tti / 10;
+  uint32_t subframe = 1 + m_tti % 10;
+  FfMacSchedSapProvider::SchedDlTriggerReqParameters dl;
+  dl.m_sfnSf = ((0x3FF & frame) << 4) | (0xF & subframe);
+  m_scheduler->GetFfMacSchedSapProvider ()->SchedDlTriggerReq (dl);
+  FfMacSchedSapProvider::SchedUlTriggerReqParameters ul;
+  ul.m_sfnSf = dl.m_sfnSf;
+  m_scheduler->GetFfMacSchedSapProvider ()->SchedUlTriggerReq (ul);
+  m_buffered = false;
+}
+
+void
+BenchCell::Apply (void)
+{
+  for (auto &ind : m_dlInds)
+    {
+      SchedDlConfigInd (ind);
+    }
+  m_dlInds.clear ();
+  for (auto &ind : m_ulInds)
+    {
+      SchedUlConfigInd (ind);
+    }
+  m_ulInds.clear ();
+}
+
+void
+BenchCell::SchedDlConfigInd (const struct SchedDlConfigIndParameters& params)
+{
+  if (m_buffered)
+    {
+      m_dlInds.push_back (params);
+      return;
+    }
+  for (auto &data : params.m_buildDataList)
+    {
+      for (auto size : data.m_dci.m_tbsSize)
+        {
+          m_dlBytes += size;
+        }
+    }
+}
+
+void
+BenchCell::SchedUlConfigInd (const struct SchedUlConfigIndParameters& params)
+{
+  if (m_buffered)
+    {
+      m_ulInds.push_back (params);
+      return;
+    }
+  for (auto &dci : params.m_dciList)
+    {
+      m_ulBytes += dci.m_tbSize;
+    }
+}
+
+uint64_t
+BenchCell::GetDlBytes (void) const
+{
+  return m_dlBytes;
+}
+
+uint64_t
+BenchCell::GetUlBytes (void) const
+{
+  return m_ulBytes;
+}
+
+/**
+ * Schedule a TTI of all the cells, and the next TTI.
+ * \param [in] cells The cells.
+ * \param [in] tti The TTI.
+ * \param [in] cqiPeriod The period of the CQI and BSR reports, in TTIs.
+ */
+static void
+Tti (std::vector<BenchCell *> *cells, uint32_t tti, uint32_t cqiPeriod)
+{
+  Ptr<FfMacSchedulerExecutor> executor = FfMacSchedulerExecutor::Get ();
+  for (auto cell : *cells)
+    {
+      if (tti % cqiPeriod == 0)
+        {
+          cell->Report ();
+        }
+      cell->SetTti (tti);
+      if (executor->GetThreads () > 0)
+        {
+          executor->Submit (MakeCallback (&BenchCell::Trigger, cell),
+                            MakeCallback (&BenchCell::Apply, cell));
+        }
+      else
+        {
+          cell->Trigger ();
+          cell->Apply ();
+        }
+    }
+  Simulator::Schedule (MilliSeconds (1), &Tti, cells, tti + 1, cqiPeriod);
+}
+
+/**
+ * Run the benchmark once and print its TTI throughput.
+ * \param [in] scheduler The type of the schedulers.
+ * \param [in] cells The number of cells.
+ * \param [in] ues The number of UEs per cell.
+ * \param [in] ttis The number of TTIs.
+ * \param [in] cqiPeriod The period of the CQI and BSR reports, in TTIs.
+ * \param [in] threads The value of FfMacSchedulerExecutor::Threads.
+ */
+static void
+RunOne (std::string scheduler, uint32_t cells, uint32_t ues, uint32_t ttis,
+        uint32_t cqiPeriod, uint32_t threads)
+{
+  Config::SetDefault ("ns3::FfMacSchedulerExecutor::Threads", UintegerValue (threads));
+  Ptr<UniformRandomVariable> cqi = CreateObject<UniformRandomVariable> ();
+  cqi->SetStream (1);
+  std::vector<BenchCell *> cellList;
+  for (uint32_t i = 0; i < cells; i++)
+    {
+      cellList.push_back (new BenchCell (scheduler, ues, cqi));
+    }
+  Simulator::Schedule (Seconds (0), &Tti, &cellList, 0, cqiPeriod);
+  Simulator::Stop (MilliSeconds (ttis));
+
+  SystemWallClockMs time;
+  time.Start ();
+  Simulator::Run ();
+  uint64_t ms = time.End ();
+  uint64_t dlBytes = 0;
+  uint64_t ulBytes = 0;
+  for (auto cell : cellList)
+    {
+      dlBytes += cell->GetDlBytes ();
+      ulBytes += cell->GetUlBytes ();
+    }
+  Simulator::Destroy ();
+  for (auto cell : cellList)
+    {
+      delete cell;
+    }
+
+  std::cout << std::left << std::setw (10) << threads
+            << std::setw (12) << ms
+            << std::setw (14) << std::fixed << std::setprecision (1) << (ms > 0 ? ttis * 1000.0 / ms : 0)
+            << std::setw (16) << dlBytes
+            << ulBytes << std::endl;
+}
+
+int main (int argc, char *argv[])
+{
+  std::string scheduler = "ns3::PfFfMacScheduler";
+  uint32_t cells = 50;
+  uint32_t ues = 100;
+  uint32_t ttis = 200;
+  uint32_t cqiPeriod = 10;
+  std::string threads = "0,1,2,4";
+
+  CommandLine cmd (__FILE__);
+  cmd.AddValue ("scheduler", "type of the schedulers", scheduler);
+  cmd.AddValue ("cells", "number of cells (eNBs or component carriers)", cells);
+  cmd.AddValue ("ues", "number of UEs per cell", ues);
+  cmd.AddValue ("ttis", "number of TTIs of each run", ttis);
+  cmd.AddValue ("cqiPeriod", "period of the CQI and BSR reports, in TTIs", cqiPeriod);
+  cmd.AddValue ("threads", "comma-separated values of FfMacSchedulerExecutor::Threads, 0 for direct calls", threads);
+  cmd.Parse (argc, argv);
+
+  std::cout << scheduler << ", " << cells << " cells x " << ues << " UEs, "
+            << ttis << " TTIs" << std::endl;
+  std::cout << std::left << std::setw (10) << "threads"
+            << std::setw (12) << "wall (ms)"
+            << std::setw (14) << "TTIs/s"
+            << std::setw (16) << "DL bytes"
+            << "UL bytes" << std::endl;
+  std::istringstream iss (threads);
+  std::string value;
+  while (std::getline (iss, value, ','))
+    {
+      RunOne (scheduler, cells, ues, ttis, cqiPeriod, std::stoul (value));
+    }
+  return 0;
+}
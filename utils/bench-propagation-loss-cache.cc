@@ -0,0 +1,170 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program benchmarks a static Wi-Fi mesh with and without a
+// CachedPropagationLossModel around its propagation loss model.
+// 'stations' static stations are placed 10 m high on a square grid,
+// 'spacing' meters apart, and each one broadcasts a packet every
+// 'interval' seconds.  The propagation loss is that of the 3GPP
+// UMi-Street Canyon scenario at 5.18 GHz, with its channel condition
+// model and shadowing, so that each transmission computes the distance,
+// the LOS probability and the path loss towards every other station.
+// Since the stations do not move, the cached run computes each link
+// once.  Without 'shadowing', both runs receive the same packets; with
+// it, the uncached run draws a new, fully correlated, shadowing value
+// at every transmission, which shifts the random draws of the links
+// computed afterwards.
+// Sample usage:  ./waf --run 'bench-propagation-loss-cache --stations=500'
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/propagation-module.h"
+#include "ns3/wifi-module.h"
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+
+using namespace ns3;
+
+/// Number of packets received by the MACs.
+static uint64_t g_received = 0;
+
+/**
+ * Sink for the MacRx trace source.
+ * \param [in] p The received packet.
+ */
+static void
+MacRxSink (Ptr<const Packet> p)
+{
+  g_received++;
+}
+
+/**
+ * Broadcast a packet and schedule the next one.
+ * \param [in] device The sending device.
+ * \param [in] interval The interval between two packets.
+ */
+static void
+Broadcast (Ptr<NetDevice> device, Time interval)
+{
+  device->Send (Create<Packet> (100), device->GetBroadcast (), 0x0800);
+  Simulator::Schedule (interval, &Broadcast, device, interval);
+}
+
+/**
+ * Run the mesh once and print its cost.
+ * \param [in] stations Number of stations.
+ * \param [in] spacing Distance between two neighbor stations, in meters.
+ * \param [in] interval Interval between two packets of a station.
+ * \param [in] shadowing Whether to enable the shadowing.
+ * \param [in] cached Whether to cache the propagation losses.
+ * \param [in] duration Simulated duration.
+ */
+static void
+RunOne (uint32_t stations, double spacing, Time interval, bool shadowing, bool cached, Time duration)
+{
+  g_received = 0;
+  RngSeedManager::SetRun (1);
+
+  NodeContainer nodes;
+  nodes.Create (stations);
+
+  MobilityHelper mobility;
+  mobility.SetPositionAllocator ("ns3::GridPositionAllocator",
+                                 "DeltaX", DoubleValue (spacing),
+                                 "DeltaY", DoubleValue (spacing),
+                                 "Z", DoubleValue (10),
+                                 "GridWidth", UintegerValue (std::ceil (std::sqrt (stations))));
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.Install (nodes);
+
+  Ptr<ChannelConditionModel> condition = CreateObject<ThreeGppUmiStreetCanyonChannelConditionModel> ();
+  condition->AssignStreams (2);
+  Ptr<PropagationLossModel> loss = CreateObjectWithAttributes<ThreeGppUmiStreetCanyonPropagationLossModel>
+      ("Frequency", DoubleValue (5.18e9),
+       "ShadowingEnabled", BooleanValue (shadowing),
+       "ChannelConditionModel", PointerValue (condition));
+  loss->AssignStreams (10);
+  if (cached)
+    {
+      loss = CreateObjectWithAttributes<CachedPropagationLossModel> ("PropagationLossModel", PointerValue (loss));
+    }
+  Ptr<YansWifiChannel> channel = CreateObject<YansWifiChannel> ();
+  channel->SetPropagationLossModel (loss);
+  channel->SetPropagationDelayModel (CreateObject<ConstantSpeedPropagationDelayModel> ());
+  YansWifiPhyHelper phy;
+  phy.SetChannel (channel);
+  WifiMacHelper mac;
+  mac.SetType ("ns3::AdhocWifiMac");
+  WifiHelper wifi;
+  wifi.SetStandard (WIFI_STANDARD_80211a);
+  wifi.SetRemoteStationManager ("ns3::ConstantRateWifiManager",
+                                "DataMode", StringValue ("OfdmRate6Mbps"));
+  NetDeviceContainer devices = wifi.Install (phy, mac, nodes);
+  wifi.AssignStreams (devices, 100);
+
+  Ptr<UniformRandomVariable> start = CreateObject<UniformRandomVariable> ();
+  start->SetStream (1);
+  for (uint32_t i = 0; i < devices.GetN (); i++)
+    {
+      Simulator::Schedule (Seconds (start->GetValue (0, interval.GetSeconds ())),
+                           &Broadcast, devices.Get (i), interval);
+    }
+  Config::ConnectWithoutContext ("/NodeList/*/DeviceList/*/$ns3::WifiNetDevice/Mac/MacRx",
+                                 MakeCallback (&MacRxSink));
+  Simulator::Stop (duration);
+
+  SystemWallClockMs time;
+  time.Start ();
+  Simulator::Run ();
+  uint64_t ms = time.End ();
+  uint64_t events = Simulator::GetEventCount ();
+  Simulator::Destroy ();
+
+  double s = std::max<uint64_t> (ms, 1) / 1000.0;
+  std::cout << std::left << std::setw (10) << (cached ? "yes" : "no")
+            << std::setw (12) << ms
+            << std::setw (12) << events
+            << std::setw (14) << static_cast<uint64_t> (events / s)
+            << g_received << std::endl;
+}
+
+int main (int argc, char *argv[])
+{
+  uint32_t stations = 500;
+  double spacing = 50;
+  double interval = 0.1;
+  double duration = 1.0;
+  bool shadowing = true;
+
+  CommandLine cmd (__FILE__);
+  cmd.AddValue ("stations", "number of stations", stations);
+  cmd.AddValue ("spacing", "distance between two neighbor stations, in meters", spacing);
+  cmd.AddValue ("interval", "interval between two packets of a station, in seconds", interval);
+  cmd.AddValue ("duration", "simulated duration of each run, in seconds", duration);
+  cmd.AddValue ("shadowing", "enable the shadowing", shadowing);
+  cmd.Parse (argc, argv);
+
+  std::cout << std::left << std::setw (10) << "cached"
+            << std::setw (12) << "wall (ms)"
+            << std::setw (12) << "events"
+            << std::setw (14) << "events/s"
+            << "received" << std::endl;
+  RunOne (stations, spacing, Seconds (interval), shadowing, false, Seconds (duration));
+  RunOne (stations, spacing, Seconds (interval), shadowing, true, Seconds (duration));
+  return 0;
+}
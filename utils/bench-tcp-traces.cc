@@ -0,0 +1,182 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program benchmarks TCP ACK processing with the per-ACK trace
+// sources of the sender socket (CongestionWindow, BytesInFlight,
+// HighestSequence, RTT and Rx) disconnected, connected to one sink
+// each and connected to several sinks each.  A single bulk TCP flow
+// runs over a point-to-point link for 'duration' simulated seconds.
+// Sample usage:  ./waf --run 'bench-tcp-traces --duration=2 --sinks=2'
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/applications-module.h"
+#include <iostream>
+#include <iomanip>
+
+using namespace ns3;
+
+/// TCP segment size, in bytes.
+static const uint32_t g_segmentSize = 1448;
+/// Number of trace sink invocations.
+static uint64_t g_calls = 0;
+
+/**
+ * Sink for TracedValue<uint32_t> sources.
+ * \param [in] oldValue Old value.
+ * \param [in] newValue New value.
+ */
+static void
+Uint32Sink (uint32_t oldValue, uint32_t newValue)
+{
+  g_calls++;
+}
+
+/**
+ * Sink for TracedValue<SequenceNumber32> sources.
+ * \param [in] oldValue Old value.
+ * \param [in] newValue New value.
+ */
+static void
+SeqSink (SequenceNumber32 oldValue, SequenceNumber32 newValue)
+{
+  g_calls++;
+}
+
+/**
+ * Sink for TracedValue<Time> sources.
+ * \param [in] oldValue Old value.
+ * \param [in] newValue New value.
+ */
+static void
+TimeSink (Time oldValue, Time newValue)
+{
+  g_calls++;
+}
+
+/**
+ * Sink for the Rx trace source.
+ * \param [in] p The received packet.
+ * \param [in] h The TCP header.
+ * \param [in] s The receiving socket.
+ */
+static void
+RxSink (Ptr<const Packet> p, const TcpHeader &h, Ptr<const TcpSocketBase> s)
+{
+  g_calls++;
+}
+
+/**
+ * Connect \p n sinks to each per-ACK trace source of the sender socket.
+ * \param [in] n Number of sinks per trace source.
+ */
+static void
+ConnectSinks (uint32_t n)
+{
+  std::string base = "/NodeList/0/$ns3::TcpL4Protocol/SocketList/0/";
+  for (uint32_t i = 0; i < n; i++)
+    {
+      Config::ConnectWithoutContext (base + "CongestionWindow", MakeCallback (&Uint32Sink));
+      Config::ConnectWithoutContext (base + "BytesInFlight", MakeCallback (&Uint32Sink));
+      Config::ConnectWithoutContext (base + "HighestSequence", MakeCallback (&SeqSink));
+      Config::ConnectWithoutContext (base + "RTT", MakeCallback (&TimeSink));
+      Config::ConnectWithoutContext (base + "Rx", MakeCallback (&RxSink));
+    }
+}
+
+/**
+ * Run one bulk transfer and print its cost.
+ * \param [in] sinks Number of sinks per trace source.
+ * \param [in] duration Simulated duration.
+ */
+static void
+RunOne (uint32_t sinks, Time duration)
+{
+  g_calls = 0;
+  Config::SetDefault ("ns3::TcpSocket::SegmentSize", UintegerValue (g_segmentSize));
+
+  NodeContainer nodes;
+  nodes.Create (2);
+
+  PointToPointHelper p2p;
+  p2p.SetDeviceAttribute ("DataRate", StringValue ("10Gbps"));
+  p2p.SetChannelAttribute ("Delay", StringValue ("10us"));
+  NetDeviceContainer devices = p2p.Install (nodes);
+
+  InternetStackHelper stack;
+  stack.Install (nodes);
+  Ipv4AddressHelper address;
+  address.SetBase ("10.1.1.0", "255.255.255.0");
+  Ipv4InterfaceContainer interfaces = address.Assign (devices);
+
+  uint16_t port = 50000;
+  BulkSendHelper source ("ns3::TcpSocketFactory",
+                         InetSocketAddress (interfaces.GetAddress (1), port));
+  source.SetAttribute ("MaxBytes", UintegerValue (0));
+  ApplicationContainer sourceApp = source.Install (nodes.Get (0));
+  sourceApp.Start (Seconds (0));
+  sourceApp.Stop (duration);
+
+  PacketSinkHelper sink ("ns3::TcpSocketFactory",
+                         InetSocketAddress (Ipv4Address::GetAny (), port));
+  ApplicationContainer sinkApp = sink.Install (nodes.Get (1));
+  sinkApp.Start (Seconds (0));
+  sinkApp.Stop (duration);
+
+  // The sender socket only exists once the application has started.
+  Simulator::Schedule (NanoSeconds (1), &ConnectSinks, sinks);
+  Simulator::Stop (duration);
+
+  SystemWallClockMs time;
+  time.Start ();
+  Simulator::Run ();
+  uint64_t ms = time.End ();
+
+  uint64_t segments = DynamicCast<PacketSink> (sinkApp.Get (0))->GetTotalRx () / g_segmentSize;
+  Simulator::Destroy ();
+
+  double s = std::max<uint64_t> (ms, 1) / 1000.0;
+  std::cout << std::left << std::setw (8) << sinks
+            << std::setw (12) << ms
+            << std::setw (14) << segments
+            << std::setw (16) << static_cast<uint64_t> (segments / s)
+            << g_calls << std::endl;
+}
+
+int main (int argc, char *argv[])
+{
+  double duration = 1.0;
+  uint32_t sinks = 4;
+
+  CommandLine cmd (__FILE__);
+  cmd.AddValue ("duration", "simulated duration of each run, in seconds", duration);
+  cmd.AddValue ("sinks", "largest number of sinks per trace source", sinks);
+  cmd.Parse (argc, argv);
+
+  std::cout << std::left << std::setw (8) << "sinks"
+            << std::setw (12) << "wall (ms)"
+            << std::setw (14) << "segments"
+            << std::setw (16) << "segments/s"
+            << "sink calls" << std::endl;
+  RunOne (0, Seconds (duration));
+  for (uint32_t n = 1; n <= sinks; n *= 2)
+    {
+      RunOne (n, Seconds (duration));
+    }
+  return 0;
+}
@@ -0,0 +1,157 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program benchmarks the TCP segmentation offload on an incast
+// scenario: 'senders' bulk TCP senders ('transport', with ECN) send to
+// one receiver through a switch whose bottleneck port runs RED with
+// ECN marking, over 10 Gbps point-to-point links, for 'duration'
+// simulated seconds.  It runs once without TSO and once with
+// TcpSocketBase::TsoMaxSegments set to 'tso', and prints the number of
+// simulator events, the number of packets handed to the traffic control
+// layers, the wall-clock time and the received bytes of each run.
+// Sample usage:  ./waf --run 'bench-tcp-tso --senders=20 --tso=44'
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/internet-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/traffic-control-module.h"
+#include "ns3/applications-module.h"
+#include <iostream>
+#include <iomanip>
+
+using namespace ns3;
+
+static uint64_t g_enqueued = 0; //!< the number of packets enqueued in the queue discs
+
+/**
+ * Count a packet enqueued in a queue disc.
+ * \param [in] item The queue disc item.
+ */
+static void
+Enqueue (Ptr<const QueueDiscItem> item)
+{
+  g_enqueued++;
+}
+
+/**
+ * Run the incast scenario and print its cost.
+ * \param [in] senders Number of senders.
+ * \param [in] transport TCP congestion control.
+ * \param [in] duration Simulated time.
+ * \param [in] tso Maximum number of segments of a super-segment.
+ */
+static void
+RunOne (uint32_t senders, std::string transport, Time duration, uint32_t tso)
+{
+  Config::SetDefault ("ns3::TcpL4Protocol::SocketType", StringValue ("ns3::" + transport));
+  // segments with the timestamp option fit the 1500 bytes MTU
+  Config::SetDefault ("ns3::TcpSocket::SegmentSize", UintegerValue (1448));
+  Config::SetDefault ("ns3::TcpSocket::DelAckCount", UintegerValue (1));
+  Config::SetDefault ("ns3::TcpSocket::SndBufSize", UintegerValue (1 << 20));
+  Config::SetDefault ("ns3::TcpSocketBase::MinRto", TimeValue (MilliSeconds (25)));
+  Config::SetDefault ("ns3::TcpSocketBase::UseEcn", StringValue ("On"));
+  Config::SetDefault ("ns3::TcpSocketBase::TsoMaxSegments", UintegerValue (tso));
+  Config::SetDefault ("ns3::RedQueueDisc::UseEcn", BooleanValue (true));
+  Config::SetDefault ("ns3::RedQueueDisc::MaxSize", QueueSizeValue (QueueSize ("250p")));
+  Config::SetDefault ("ns3::RedQueueDisc::MeanPktSize", UintegerValue (1500));
+  Config::SetDefault ("ns3::RedQueueDisc::QW", DoubleValue (1));
+  Config::SetDefault ("ns3::RedQueueDisc::MinTh", DoubleValue (65));
+  Config::SetDefault ("ns3::RedQueueDisc::MaxTh", DoubleValue (65));
+  Config::SetDefault ("ns3::RedQueueDisc::Gentle", BooleanValue (false));
+  Config::SetDefault ("ns3::RedQueueDisc::UseHardDrop", BooleanValue (false));
+  GlobalValue::Bind ("ChecksumEnabled", BooleanValue (false));
+
+  NodeContainer senderNodes;
+  senderNodes.Create (senders);
+  Ptr<Node> sw = CreateObject<Node> ();
+  Ptr<Node> receiver = CreateObject<Node> ();
+  InternetStackHelper stack;
+  stack.InstallAll ();
+
+  PointToPointHelper p2p;
+  p2p.SetDeviceAttribute ("DataRate", StringValue ("10Gbps"));
+  p2p.SetChannelAttribute ("Delay", StringValue ("10us"));
+  TrafficControlHelper red;
+  red.SetRootQueueDisc ("ns3::RedQueueDisc");
+  QueueDiscContainer queueDiscs;
+  Ipv4AddressHelper address;
+  address.SetBase ("10.0.0.0", "255.255.255.0");
+  for (uint32_t i = 0; i < senders; i++)
+    {
+      NetDeviceContainer devices = p2p.Install (senderNodes.Get (i), sw);
+      queueDiscs.Add (red.Install (devices));
+      address.Assign (devices);
+      address.NewNetwork ();
+    }
+  NetDeviceContainer devices = p2p.Install (sw, receiver);
+  queueDiscs.Add (red.Install (devices));
+  Ipv4InterfaceContainer interfaces = address.Assign (devices);
+  Ipv4GlobalRoutingHelper::PopulateRoutingTables ();
+
+  uint16_t port = 50000;
+  PacketSinkHelper sink ("ns3::TcpSocketFactory", InetSocketAddress (Ipv4Address::GetAny (), port));
+  ApplicationContainer sinkApp = sink.Install (receiver);
+  BulkSendHelper source ("ns3::TcpSocketFactory", InetSocketAddress (interfaces.GetAddress (1), port));
+  source.SetAttribute ("SendSize", UintegerValue (64 * 1024));
+  source.Install (senderNodes);
+  for (QueueDiscContainer::ConstIterator it = queueDiscs.Begin (); it != queueDiscs.End (); it++)
+    {
+      (*it)->TraceConnectWithoutContext ("Enqueue", MakeCallback (&Enqueue));
+    }
+  Simulator::Stop (duration);
+
+  g_enqueued = 0;
+  SystemWallClockMs clock;
+  clock.Start ();
+  Simulator::Run ();
+  int64_t ms = clock.End ();
+  uint64_t events = Simulator::GetEventCount ();
+  uint64_t rx = DynamicCast<PacketSink> (sinkApp.Get (0))->GetTotalRx ();
+  Simulator::Destroy ();
+
+  std::cout << std::left << std::setw (6) << tso
+            << std::setw (12) << events
+            << std::setw (12) << g_enqueued
+            << std::setw (12) << ms
+            << std::setw (14) << static_cast<uint64_t> (events * 1000.0 / std::max<int64_t> (ms, 1))
+            << rx << std::endl;
+}
+
+int main (int argc, char *argv[])
+{
+  uint32_t senders = 20;
+  std::string transport = "TcpDctcp";
+  Time duration = MilliSeconds (100);
+  uint32_t tso = 44;
+
+  CommandLine cmd (__FILE__);
+  cmd.AddValue ("senders", "number of senders", senders);
+  cmd.AddValue ("transport", "TCP congestion control, e.g. TcpDctcp or TcpDsdcc", transport);
+  cmd.AddValue ("duration", "simulated time", duration);
+  cmd.AddValue ("tso", "maximum number of segments of a super-segment", tso);
+  cmd.Parse (argc, argv);
+
+  std::cout << std::left << std::setw (6) << "tso"
+            << std::setw (12) << "events"
+            << std::setw (12) << "enqueued"
+            << std::setw (12) << "wall (ms)"
+            << std::setw (14) << "events/s"
+            << "received (B)" << std::endl;
+  RunOne (senders, transport, duration, 1);
+  RunOne (senders, transport, duration, tso);
+  return 0;
+}
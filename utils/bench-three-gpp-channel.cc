@@ -0,0 +1,225 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program benchmarks the 3GPP channel model with phased arrays.
+// Every 'pairs' gNB-UE pair uses UPAs of 'rows' x 'rows' elements.  At
+// each of 'updates' updates, one every 'interval' ms, it gets the channel
+// matrix of every pair, which is regenerated once per 'period' ms, then
+// applies it to a PSD of 'bands' bands 'psds' times (the first
+// application also computes the long term component).  With 'threads'
+// worker threads, the channels are pre-generated 'lead' ms before they
+// expire.  It prints the time per pair and update spent getting channels,
+// computing the long term components and applying the PSDs, the total
+// time and a checksum of the received PSDs.
+// Sample usage:  ./waf --run 'bench-three-gpp-channel --rows=8 --threads=4'
+
+#include "ns3/core-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/network-module.h"
+#include "ns3/spectrum-module.h"
+#include "ns3/uniform-planar-array.h"
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+
+using namespace ns3;
+
+namespace {
+
+/**
+ * \ingroup spectrum
+ * \brief Generate and apply 3GPP channels between gNB-UE pairs.
+ */
+class ThreeGppChannelBench
+{
+public:
+  /**
+   * \param pairs Number of gNB-UE pairs.
+   * \param rows Number of rows and columns of the UPAs.
+   * \param bands Number of bands of the PSD.
+   * \param psds Number of PSDs applied per pair and update.
+   */
+  ThreeGppChannelBench (uint32_t pairs, uint32_t rows, uint32_t bands, uint32_t psds);
+
+  /// Get the channels and apply the PSDs of all the pairs.
+  void Update (void);
+  /// Print the results.
+  void Print (void) const;
+
+private:
+  Ptr<ThreeGppSpectrumPropagationLossModel> m_loss; //!< The model
+  std::vector<Ptr<MobilityModel> > m_gnbs;          //!< Mobility of the gNBs
+  std::vector<Ptr<MobilityModel> > m_ues;           //!< Mobility of the UEs
+  std::vector<Ptr<PhasedArrayModel> > m_antennas;   //!< Antennas of the gNBs then UEs
+  Ptr<SpectrumValue> m_txPsd;                       //!< The TX PSD
+  uint32_t m_psds;                                  //!< PSDs per pair and update
+  double m_channelNs;                               //!< Time getting channels
+  double m_longTermNs;                              //!< Time of the first PSD
+  double m_psdNs;                                   //!< Time of the other PSDs
+  uint64_t m_updates;                               //!< Pair updates
+  double m_checksum;                                //!< Sum of the RX PSDs
+};
+
+ThreeGppChannelBench::ThreeGppChannelBench (uint32_t pairs, uint32_t rows, uint32_t bands, uint32_t psds)
+  : m_psds (psds),
+    m_channelNs (0),
+    m_longTermNs (0),
+    m_psdNs (0),
+    m_updates (0),
+    m_checksum (0)
+{
+  m_loss = CreateObject<ThreeGppSpectrumPropagationLossModel> ();
+  m_loss->SetChannelModelAttribute ("Frequency", DoubleValue (28e9));
+  m_loss->SetChannelModelAttribute ("Scenario", StringValue ("UMi-StreetCanyon"));
+  m_loss->SetChannelModelAttribute ("ChannelConditionModel",
+                                    PointerValue (CreateObject<ThreeGppUmiStreetCanyonChannelConditionModel> ()));
+
+  NodeContainer nodes;
+  nodes.Create (2 * pairs);
+  for (uint32_t i = 0; i < 2 * pairs; i++)
+    {
+      Ptr<SimpleNetDevice> device = CreateObject<SimpleNetDevice> ();
+      nodes.Get (i)->AddDevice (device);
+      device->SetNode (nodes.Get (i));
+      Ptr<MobilityModel> mobility = CreateObject<ConstantVelocityMobilityModel> ();
+      nodes.Get (i)->AggregateObject (mobility);
+      Ptr<PhasedArrayModel> antenna = CreateObjectWithAttributes<UniformPlanarArray> ("NumColumns", UintegerValue (rows),
+                                                                                      "NumRows", UintegerValue (rows));
+      m_loss->AddDevice (device, antenna);
+      m_antennas.push_back (antenna);
+      if (i < pairs)
+        {
+          mobility->SetPosition (Vector (0, 50.0 * i, 10));
+          m_gnbs.push_back (mobility);
+        }
+      else
+        {
+          mobility->SetPosition (Vector (30 + 10.0 * (i - pairs), 50.0 * (i - pairs), 1.5));
+          DynamicCast<ConstantVelocityMobilityModel> (mobility)->SetVelocity (Vector (0, 1, 0));
+          m_ues.push_back (mobility);
+        }
+    }
+  // Point the beams of each pair at each other
+  for (uint32_t i = 0; i < 2 * pairs; i++)
+    {
+      Ptr<MobilityModel> self = (i < pairs) ? m_gnbs[i] : m_ues[i - pairs];
+      Ptr<MobilityModel> other = (i < pairs) ? m_ues[i] : m_gnbs[i - pairs];
+      Angles angles (other->GetPosition (), self->GetPosition ());
+      PhasedArrayModel::ComplexVector weights;
+      uint64_t elements = m_antennas[i]->GetNumberOfElements ();
+      for (uint64_t e = 0; e < elements; e++)
+        {
+          Vector loc = m_antennas[i]->GetElementLocation (e);
+          double phase = -2 * M_PI * (sin (angles.GetInclination ()) * cos (angles.GetAzimuth ()) * loc.x
+                                      + sin (angles.GetInclination ()) * sin (angles.GetAzimuth ()) * loc.y
+                                      + cos (angles.GetInclination ()) * loc.z);
+          weights.push_back (exp (std::complex<double> (0, phase)) / std::sqrt (elements));
+        }
+      m_antennas[i]->SetBeamformingVector (weights);
+    }
+
+  std::vector<double> centerFrequencies;
+  for (uint32_t i = 0; i < bands; i++)
+    {
+      centerFrequencies.push_back (28e9 + (i - bands / 2.0) * 360e3);
+    }
+  m_txPsd = Create<SpectrumValue> (Create<SpectrumModel> (centerFrequencies));
+  (*m_txPsd) = 1e-9;
+}
+
+void
+ThreeGppChannelBench::Update (void)
+{
+  Ptr<MatrixBasedChannelModel> channelModel = m_loss->GetChannelModel ();
+  for (uint32_t i = 0; i < m_gnbs.size (); i++)
+    {
+      auto start = std::chrono::steady_clock::now ();
+      channelModel->GetChannel (m_gnbs[i], m_ues[i], m_antennas[i], m_antennas[m_gnbs.size () + i]);
+      auto gotten = std::chrono::steady_clock::now ();
+      Ptr<SpectrumValue> rxPsd = m_loss->CalcRxPowerSpectralDensity (m_txPsd, m_gnbs[i], m_ues[i]);
+      m_checksum += Sum (*rxPsd);
+      auto longTerm = std::chrono::steady_clock::now ();
+      for (uint32_t j = 1; j < m_psds; j++)
+        {
+          rxPsd = m_loss->CalcRxPowerSpectralDensity (m_txPsd, m_gnbs[i], m_ues[i]);
+          m_checksum += Sum (*rxPsd);
+        }
+      auto end = std::chrono::steady_clock::now ();
+      m_channelNs += std::chrono::duration<double, std::nano> (gotten - start).count ();
+      m_longTermNs += std::chrono::duration<double, std::nano> (longTerm - gotten).count ();
+      m_psdNs += std::chrono::duration<double, std::nano> (end - longTerm).count ();
+      m_updates++;
+    }
+}
+
+void
+ThreeGppChannelBench::Print (void) const
+{
+  std::cout << std::left << std::setw (16) << "channel (us)"
+            << std::setw (16) << "long term (us)"
+            << std::setw (12) << "psd (us)"
+            << std::setw (12) << "total (ms)"
+            << "checksum" << std::endl;
+  std::cout << std::left << std::setw (16) << m_channelNs / m_updates / 1e3
+            << std::setw (16) << m_longTermNs / m_updates / 1e3
+            << std::setw (12) << (m_psds > 1 ? m_psdNs / m_updates / (m_psds - 1) / 1e3 : 0)
+            << std::setw (12) << (m_channelNs + m_longTermNs + m_psdNs) / 1e6
+            << std::setprecision (17) << m_checksum << std::endl;
+}
+
+} // unnamed namespace
+
+int main (int argc, char *argv[])
+{
+  uint32_t pairs = 4;
+  uint32_t rows = 8;
+  uint32_t bands = 275;
+  uint32_t updates = 20;
+  uint32_t psds = 10;
+  uint32_t interval = 1;
+  uint32_t period = 5;
+  uint32_t threads = 0;
+  uint32_t lead = 4;
+
+  CommandLine cmd (__FILE__);
+  cmd.AddValue ("pairs", "number of gNB-UE pairs", pairs);
+  cmd.AddValue ("rows", "number of rows and columns of the UPAs", rows);
+  cmd.AddValue ("bands", "number of bands of the PSD", bands);
+  cmd.AddValue ("updates", "number of channel updates", updates);
+  cmd.AddValue ("psds", "number of PSDs applied per pair and update", psds);
+  cmd.AddValue ("interval", "time between updates, in ms", interval);
+  cmd.AddValue ("period", "channel update period, in ms", period);
+  cmd.AddValue ("threads", "number of threads pre-generating the channels", threads);
+  cmd.AddValue ("lead", "how long before expiration the pre-generation starts, in ms", lead);
+  cmd.Parse (argc, argv);
+
+  Config::SetDefault ("ns3::ThreeGppChannelModel::UpdatePeriod", TimeValue (MilliSeconds (period)));
+  Config::SetDefault ("ns3::ThreeGppChannelModel::PregenerationThreads", UintegerValue (threads));
+  Config::SetDefault ("ns3::ThreeGppChannelModel::PregenerationLead", TimeValue (MilliSeconds (lead)));
+  Config::SetDefault ("ns3::ThreeGppChannelConditionModel::UpdatePeriod", TimeValue (MilliSeconds (0)));
+  RngSeedManager::SetSeed (1);
+  RngSeedManager::SetRun (1);
+
+  ThreeGppChannelBench bench (pairs, rows, bands, psds);
+  for (uint32_t i = 0; i < updates; i++)
+    {
+      Simulator::Schedule (MilliSeconds (interval * i), &ThreeGppChannelBench::Update, &bench);
+    }
+  Simulator::Run ();
+  Simulator::Destroy ();
+  bench.Print ();
+  return 0;
+}
@@ -0,0 +1,177 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program benchmarks the installation of a vehicular ns-2 trace
+// with Ns2MobilityHelper against its binary waypoint trace with
+// WaypointTraceHelper.  Since the memory used by a process cannot be
+// measured twice, each mode runs in its own process:
+//  - 'generate' writes a SUMO-like ns-2 trace: 'nodes' vehicles which
+//    receive a new setdest every second for 'duration' seconds;
+//  - 'convert' converts it to a binary waypoint trace;
+//  - 'ns2' and 'binary' install the ns-2 or the binary trace, run the
+//    simulation for 'run' seconds, and print the installation and run
+//    times, the peak resident memory and a checksum of the positions.
+// Sample usage:
+//   ./waf --run 'bench-waypoint-trace --mode=generate --nodes=10000'
+//   ./waf --run 'bench-waypoint-trace --mode=convert'
+//   ./waf --run 'bench-waypoint-trace --mode=ns2'
+//   ./waf --run 'bench-waypoint-trace --mode=binary'
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/mobility-module.h"
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+
+using namespace ns3;
+
+/**
+ * \return the peak resident memory of the process, in kB, or 0 if unknown.
+ */
+static uint64_t
+GetPeakMemory (void)
+{
+  std::ifstream status ("/proc/self/status");
+  std::string key;
+  while (status >> key)
+    {
+      if (key == "VmHWM:")
+        {
+          uint64_t kb;
+          status >> kb;
+          return kb;
+        }
+    }
+  return 0;
+}
+
+/**
+ * Write a SUMO-like ns-2 trace.
+ * \param [in] filename The name of the trace.
+ * \param [in] nodes The number of vehicles.
+ * \param [in] duration The duration of the trace, in seconds.
+ */
+static void
+Generate (std::string filename, uint32_t nodes, uint32_t duration)
+{
+  Ptr<UniformRandomVariable> position = CreateObject<UniformRandomVariable> ();
+  position->SetStream (1);
+  std::ofstream file (filename.c_str ());
+  file << std::fixed << std::setprecision (2);
+  for (uint32_t i = 0; i < nodes; i++)
+    {
+      file << "$node_(" << i << ") set X_ " << position->GetValue (0, 5000) << "\n"
+           << "$node_(" << i << ") set Y_ " << position->GetValue (0, 5000) << "\n"
+           << "$node_(" << i << ") set Z_ 1.5\n";
+    }
+  for (uint32_t t = 0; t < duration; t++)
+    {
+      for (uint32_t i = 0; i < nodes; i++)
+        {
+          file << "$ns_ at " << t << ".0 \"$node_(" << i << ") setdest "
+               << position->GetValue (0, 5000) << " " << position->GetValue (0, 5000) << " "
+               << position->GetValue (5, 30) << "\"\n";
+        }
+    }
+}
+
+int main (int argc, char *argv[])
+{
+  std::string mode = "ns2";
+  std::string trace = "bench-waypoint-trace.ns_movements";
+  std::string binary = "bench-waypoint-trace.wpt";
+  uint32_t nodes = 1000;
+  uint32_t duration = 300;
+  double run = 10;
+
+  CommandLine cmd (__FILE__);
+  cmd.AddValue ("mode", "generate, convert, ns2 or binary", mode);
+  cmd.AddValue ("trace", "name of the ns-2 trace", trace);
+  cmd.AddValue ("binary", "name of the binary waypoint trace", binary);
+  cmd.AddValue ("nodes", "number of vehicles of the generated trace", nodes);
+  cmd.AddValue ("duration", "duration of the generated trace, in seconds", duration);
+  cmd.AddValue ("run", "simulated duration, in seconds", run);
+  cmd.Parse (argc, argv);
+
+  SystemWallClockMs time;
+  time.Start ();
+  if (mode == "generate")
+    {
+      Generate (trace, nodes, duration);
+      std::cout << "generated " << trace << " in " << time.End () << " ms" << std::endl;
+      return 0;
+    }
+  if (mode == "convert")
+    {
+      Ns2MobilityHelper (trace).ConvertToWaypointTrace (binary);
+      std::cout << "converted " << trace << " to " << binary << " in " << time.End ()
+                << " ms, peak memory " << GetPeakMemory () << " kB" << std::endl;
+      return 0;
+    }
+
+  NodeContainer vehicles;
+  if (mode == "ns2")
+    {
+      Ns2MobilityHelper helper (trace);
+      // the ns-2 trace does not tell its number of nodes
+      vehicles.Create (nodes);
+      helper.Install ();
+    }
+  else if (mode == "binary")
+    {
+      WaypointTraceHelper helper (binary);
+      vehicles.Create (helper.GetNNodes ());
+      helper.Install (vehicles);
+    }
+  else
+    {
+      NS_FATAL_ERROR ("Unknown mode " << mode);
+    }
+  uint64_t installMs = time.End ();
+  uint64_t installMemory = GetPeakMemory ();
+
+  time.Start ();
+  Simulator::Stop (Seconds (run));
+  Simulator::Run ();
+  uint64_t runMs = time.End ();
+  double checksum = 0;
+  for (uint32_t i = 0; i < vehicles.GetN (); i++)
+    {
+      Vector position = vehicles.Get (i)->GetObject<MobilityModel> ()->GetPosition ();
+      checksum += position.x + position.y;
+    }
+  uint64_t events = Simulator::GetEventCount ();
+  Simulator::Destroy ();
+
+  std::cout << std::left << std::setw (8) << "mode"
+            << std::setw (10) << "nodes"
+            << std::setw (14) << "install (ms)"
+            << std::setw (18) << "install mem (kB)"
+            << std::setw (10) << "run (ms)"
+            << std::setw (12) << "events"
+            << std::setw (14) << "peak mem (kB)"
+            << "checksum" << std::endl;
+  std::cout << std::left << std::setw (8) << mode
+            << std::setw (10) << vehicles.GetN ()
+            << std::setw (14) << installMs
+            << std::setw (18) << installMemory
+            << std::setw (10) << runMs
+            << std::setw (12) << events
+            << std::setw (14) << GetPeakMemory ()
+            << std::fixed << std::setprecision (3) << checksum << std::endl;
+  return 0;
+}
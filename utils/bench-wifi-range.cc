@@ -0,0 +1,150 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// This program benchmarks a dense ad hoc Wi-Fi network with and
+// without the MaxRange cutoff of YansWifiChannel.  'stations' static
+// stations are placed on a square grid, 'spacing' meters apart, and
+// each one broadcasts a packet every 'interval' seconds.  With the
+// default log-distance propagation loss the received power drops
+// below the RX sensitivity about 220 m away from the sender, so a
+// cutoff beyond that distance only drops PPDUs which would not have
+// been received; the packets received only change through the weak
+// interference those PPDUs would have added.
+// Sample usage:  ./waf --run 'bench-wifi-range --stations=1000 --range=250'
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/mobility-module.h"
+#include "ns3/wifi-module.h"
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+
+using namespace ns3;
+
+/// Number of packets received by the MACs.
+static uint64_t g_received = 0;
+
+/**
+ * Sink for the MacRx trace source.
+ * \param [in] p The received packet.
+ */
+static void
+MacRxSink (Ptr<const Packet> p)
+{
+  g_received++;
+}
+
+/**
+ * Broadcast a packet and schedule the next one.
+ * \param [in] device The sending device.
+ * \param [in] interval The interval between two packets.
+ */
+static void
+Broadcast (Ptr<NetDevice> device, Time interval)
+{
+  device->Send (Create<Packet> (100), device->GetBroadcast (), 0x0800);
+  Simulator::Schedule (interval, &Broadcast, device, interval);
+}
+
+/**
+ * Run the network once and print its cost.
+ * \param [in] stations Number of stations.
+ * \param [in] spacing Distance between two neighbor stations, in meters.
+ * \param [in] interval Interval between two packets of a station.
+ * \param [in] range Maximum range of the channel, in meters, 0 for none.
+ * \param [in] duration Simulated duration.
+ */
+static void
+RunOne (uint32_t stations, double spacing, Time interval, double range, Time duration)
+{
+  g_received = 0;
+  RngSeedManager::SetRun (1);
+
+  NodeContainer nodes;
+  nodes.Create (stations);
+
+  MobilityHelper mobility;
+  mobility.SetPositionAllocator ("ns3::GridPositionAllocator",
+                                 "DeltaX", DoubleValue (spacing),
+                                 "DeltaY", DoubleValue (spacing),
+                                 "GridWidth", UintegerValue (std::ceil (std::sqrt (stations))));
+  mobility.SetMobilityModel ("ns3::ConstantPositionMobilityModel");
+  mobility.Install (nodes);
+
+  YansWifiChannelHelper channelHelper = YansWifiChannelHelper::Default ();
+  Ptr<YansWifiChannel> channel = channelHelper.Create ();
+  channel->SetAttribute ("MaxRange", DoubleValue (range));
+  YansWifiPhyHelper phy;
+  phy.SetChannel (channel);
+  WifiMacHelper mac;
+  mac.SetType ("ns3::AdhocWifiMac");
+  WifiHelper wifi;
+  wifi.SetRemoteStationManager ("ns3::ConstantRateWifiManager",
+                                "DataMode", StringValue ("OfdmRate6Mbps"));
+  NetDeviceContainer devices = wifi.Install (phy, mac, nodes);
+
+  Ptr<UniformRandomVariable> start = CreateObject<UniformRandomVariable> ();
+  start->SetStream (1);
+  for (uint32_t i = 0; i < devices.GetN (); i++)
+    {
+      Simulator::Schedule (Seconds (start->GetValue (0, interval.GetSeconds ())),
+                           &Broadcast, devices.Get (i), interval);
+    }
+  Config::ConnectWithoutContext ("/NodeList/*/DeviceList/*/$ns3::WifiNetDevice/Mac/MacRx",
+                                 MakeCallback (&MacRxSink));
+  Simulator::Stop (duration);
+
+  SystemWallClockMs time;
+  time.Start ();
+  Simulator::Run ();
+  uint64_t ms = time.End ();
+  uint64_t events = Simulator::GetEventCount ();
+  Simulator::Destroy ();
+
+  double s = std::max<uint64_t> (ms, 1) / 1000.0;
+  std::cout << std::left << std::setw (10) << range
+            << std::setw (12) << ms
+            << std::setw (12) << events
+            << std::setw (14) << static_cast<uint64_t> (events / s)
+            << g_received << std::endl;
+}
+
+int main (int argc, char *argv[])
+{
+  uint32_t stations = 400;
+  double spacing = 50;
+  double interval = 0.1;
+  double range = 250;
+  double duration = 1.0;
+
+  CommandLine cmd (__FILE__);
+  cmd.AddValue ("stations", "number of stations", stations);
+  cmd.AddValue ("spacing", "distance between two neighbor stations, in meters", spacing);
+  cmd.AddValue ("interval", "interval between two packets of a station, in seconds", interval);
+  cmd.AddValue ("range", "maximum range of the channel, in meters", range);
+  cmd.AddValue ("duration", "simulated duration of each run, in seconds", duration);
+  cmd.Parse (argc, argv);
+
+  std::cout << std::left << std::setw (10) << "range (m)"
+            << std::setw (12) << "wall (ms)"
+            << std::setw (12) << "events"
+            << std::setw (14) << "events/s"
+            << "received" << std::endl;
+  RunOne (stations, spacing, Seconds (interval), 0, Seconds (duration));
+  RunOne (stations, spacing, Seconds (interval), range, Seconds (duration));
+  return 0;
+}